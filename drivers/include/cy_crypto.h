@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides the public interface for the Crypto driver.
@@ -40,9 +40,9 @@
 *
 * Mixing these usage models will result in undefined behaviour.
 *
-* The Crypto driver supports these standards: DES, TDES, AES (128, 192, 256 bits), CMAC-AES, SHA,
+* The Crypto driver supports these standards: DES, TDES, AES (128, 192, 256 bits), AES-GCM, CMAC-AES, SHA,
 * HMAC, PRNG, TRNG, CRC, RSA, ECP, and ECDSA.
-* \note ECP and ECDSA are only implemented for the \ref group_crypto_lld_api model.
+* \note ECP, ECDSA and AES-GCM are only implemented for the \ref group_crypto_lld_api model.
 *
 * \section group_crypto_configuration_considerations Configuration Considerations
 *
@@ -140,6 +140,16 @@
 *   </tr>
 *
 *   <tr>
+*     <td>Galois/Counter Mode (GCM)</td>
+*     <td>An authenticated encryption mode of a block cipher. It combines the
+*     counter mode encryption with the GHASH authentication over the cipher
+*     text and the additional authenticated data.
+*     For more information see [Recommendation for Block Cipher Modes of Operation: GCM]
+*     (https://nvlpubs.nist.gov/nistpubs/Legacy/SP/nistspecialpublication800-38d.pdf).
+*     </td>
+*   </tr>
+*
+*   <tr>
 *     <td>Secure Hash Algorithm (SHA)</td>
 *     <td>A cryptographic hash function.
 *     This function takes a message of an arbitrary length and reduces it to a
@@ -291,6 +301,39 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td>2.40</td>
+*     <td>
+*         <ul>
+*         <li>Added the streaming AES-GCM functions with the scatter-gather
+*             buffers support (Crypto hardware version 2 only).</li>
+*         <li>Added \ref Cy_Crypto_Core_Sha_UpdateList to hash a message
+*             given as a scatter-gather list with one context save/restore.
+*             The version 1 SHA update hashes the 4-Byte aligned blocks in
+*             place and queues the next block while the current one is
+*             compressed.</li>
+*         <li>Added the optional fixed-base comb tables for the ECC base
+*             point, see \ref Cy_Crypto_Core_ECC_SetCombTable. With a table
+*             registered, \ref Cy_Crypto_Core_ECC_MakePublicKey and
+*             \ref Cy_Crypto_Core_ECC_SignHash need about five times fewer
+*             point doublings.</li>
+*         <li>Added \ref Cy_Crypto_Core_Rsa_ProcWindow and
+*             \ref Cy_Crypto_Core_Rsa_ProcCrt for the RSA private key
+*             operations with the fixed window exponentiation and the
+*             Chinese Remainder Theorem key form.</li>
+*         <li>Added \ref Cy_Crypto_Core_ECC_VerifyHashBatch to verify a list
+*             of ECDSA signatures with one setup and a joint scalar
+*             multiplication per signature.</li>
+*         <li>Added the Crypto client request queue: \ref Cy_Crypto_Queue_Init,
+*             \ref Cy_Crypto_Queue_Prepare and \ref Cy_Crypto_Queue_Process.
+*             Several operations can be in flight at once and the server
+*             processes them in batches.</li>
+*         </ul>
+*     </td>
+*     <td>
+*         New functionality.
+*     </td>
+*   </tr>
+*   <tr>
 *     <td>2.30.4</td>
 *     <td>
 *         Updated code snippets for client-server usage model.
@@ -838,6 +881,15 @@
 * enabled, your callback function is called when the operation is complete.
 * This lets you avoid blocking calls to \ref Cy_Crypto_Sync.
 *
+* <b>Request queue:</b> The client can keep several operations in flight with
+* the request queue, initialized by \ref Cy_Crypto_Queue_Init. Call
+* \ref Cy_Crypto_Queue_Prepare before a client function to submit the operation
+* to the queue instead of the IPC channel. The server drains all submitted
+* requests in one batch and sends a single release notification per batch.
+* Completed requests are retired by \ref Cy_Crypto_Queue_Process, which calls
+* the per-request callbacks; the isComplete flag of the request can be polled
+* instead.
+*
 * <b>Error Interrupt:</b> The Crypto server has a default ISR to handle this
 * interrupt. It clears the interrupt and sets an internal flag that an error
 * has occurred.
@@ -972,6 +1024,85 @@ cy_en_crypto_status_t Cy_Crypto_Sync(bool isBlocking);
 *******************************************************************************/
 cy_en_crypto_status_t Cy_Crypto_GetErrorStatus(cy_stc_crypto_hw_error_t *hwErrorCause);
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Queue_Init
+****************************************************************************//**
+*
+* This function initializes the request queue and registers it with the
+* Crypto Server. After this call, Crypto operations can be submitted to the
+* queue with \ref Cy_Crypto_Queue_Prepare without waiting for the previous
+* operation to complete.
+*
+* The queue and the ring of request pointers must be located in memory
+* accessible by both the client and the server cores.
+*
+* \param queue
+* The pointer to the \ref cy_stc_crypto_queue_t structure that stores
+* the queue state.
+*
+* \param requests
+* The pointer to the ring of request pointers of size entries.
+*
+* \param size
+* The number of requests that can be in flight at once. It must be a power of
+* two, as the free-running queue indices are wrapped by masking.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Queue_Init(cy_stc_crypto_queue_t *queue,
+                                           cy_stc_crypto_request_t **requests,
+                                           uint32_t size);
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Queue_Prepare
+****************************************************************************//**
+*
+* This function arms the request for the next Crypto client function call.
+* Instead of sending the operation through the IPC channel, the next call
+* submits it to the request queue and returns immediately. The call returns
+* CY_CRYPTO_SERVER_BUSY if the queue is full. The request is armed for one call
+* only, and the call disarms it also when it fails.
+*
+* Each request in flight must use its own function specific context structure
+* (for example \ref cy_stc_crypto_context_sha_t). Requests are processed in
+* submission order. \ref Cy_Crypto_Enable and \ref Cy_Crypto_Disable cannot be
+* queued.
+*
+* \param request
+* The pointer to the \ref cy_stc_crypto_request_t structure. The isComplete
+* field is set when the request is processed and resp holds the result.
+*
+* \param callback
+* The function called by \ref Cy_Crypto_Queue_Process when the request is
+* complete, or NULL.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Queue_Prepare(cy_stc_crypto_request_t *request,
+                                              cy_crypto_request_callback_t callback);
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Queue_Process
+****************************************************************************//**
+*
+* This function retires the requests completed by the Crypto Server, frees
+* their queue slots and calls their completion callbacks.
+*
+* The function is called from the release interrupt handler when the
+* \link cy_stc_crypto_config_t::userCompleteCallback userCompleteCallback
+* \endlink is configured. Otherwise, call it periodically. Do not call it from
+* both contexts at once.
+*
+* \return
+* The number of requests still in flight.
+*
+*******************************************************************************/
+uint32_t Cy_Crypto_Queue_Process(void);
+
 #if (CPUSS_CRYPTO_PR == 1)
 /*******************************************************************************
 * Function Name: Cy_Crypto_Prng_Init
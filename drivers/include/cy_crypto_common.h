@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_common.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides common constants and parameters
@@ -62,7 +62,7 @@ extern "C" {
 #define CY_CRYPTO_DRV_VERSION_MAJOR         2
 
 /** Driver minor version */
-#define CY_CRYPTO_DRV_VERSION_MINOR         30
+#define CY_CRYPTO_DRV_VERSION_MINOR         40
 
 /**
 * \addtogroup group_crypto_cli_srv_macros
@@ -105,6 +105,18 @@ extern "C" {
 /** Defines size of the AES block, in four-byte words */
 #define CY_CRYPTO_AES_BLOCK_SIZE_U32      (uint32_t)(CY_CRYPTO_AES_BLOCK_SIZE / 4ul)
 
+/** Defines the Crypto AES-GCM recommended initial vector size (in bytes) */
+#define CY_CRYPTO_AES_GCM_IV_SIZE         (12u)
+
+/** Defines the Crypto AES-GCM maximum authentication tag size (in bytes) */
+#define CY_CRYPTO_AES_GCM_TAG_SIZE        (16u)
+
+/** Defines the Crypto AES-GCM minimum authentication tag size (in bytes) */
+#define CY_CRYPTO_AES_GCM_MIN_TAG_SIZE    (4u)
+
+/** Defines the number of AES blocks processed in one AES-GCM pipeline step */
+#define CY_CRYPTO_AES_GCM_CHUNK_BLOCKS    (8u)
+
 #if (CPUSS_CRYPTO_SHA == 1)
 
 /* Defines for the SHA algorithm */
@@ -176,6 +188,12 @@ extern "C" {
 /** Processed message size for the RSA 4096Bit mode (in bytes) */
 #define CY_CRYPTO_RSA4096_MESSAGE_SIZE      CY_CRYPTO_BYTE_SIZE_OF_BITS(4096u)
 
+/** The exponentiation window width for the RSA private key operations (in bits) */
+#define CY_CRYPTO_RSA_EXP_WINDOW            (4u)
+/** The powers table size for the RSA private key operations with the modulus
+*   (or prime for the CRT form) of x Bits (in bytes) */
+#define CY_CRYPTO_RSA_EXP_TABLE_SIZE(x)     ((1uL << CY_CRYPTO_RSA_EXP_WINDOW) * 4u * CY_CRYPTO_WORD_SIZE_OF_BITS(x))
+
 #endif /* #if (CPUSS_CRYPTO_VU == 1) */
 
 
@@ -309,6 +327,37 @@ typedef struct
 /** \endcond */
 } cy_stc_crypto_rsa_pub_key_t;
 
+/**
+* All fields for the context structure are internal. Firmware never reads or
+* writes these values. Firmware allocates the structure and provides the
+* address of the structure to the driver in the function calls.
+*
+* The driver uses this structure to store the RSA private key in the Chinese
+* Remainder Theorem (CRT) form:
+*  - p, q - the modulus prime factors, of the same length
+*  - dP = d mod (p - 1), dQ = d mod (q - 1) - the exponents
+*  - qInv = (1 / q) mod p - the coefficient.
+*
+* \note All values must be in little-endian order.
+*/
+typedef struct
+{
+    /** \cond INTERNAL */
+    /** The pointer to the prime p */
+    uint8_t *pPtr;
+    /** The pointer to the prime q */
+    uint8_t *qPtr;
+    /** The length of each prime, in bits, the half of the modulus length */
+    uint32_t primeLength;
+    /** The pointer to the exponent dP, primeLength bits */
+    uint8_t *dPPtr;
+    /** The pointer to the exponent dQ, primeLength bits */
+    uint8_t *dQPtr;
+    /** The pointer to the coefficient qInv, primeLength bits */
+    uint8_t *qInvPtr;
+    /** \endcond */
+} cy_stc_crypto_rsa_crt_key_t;
+
 #endif /* #if (CPUSS_CRYPTO_VU == 1) */
 
 /** \} group_crypto_data_structures */
@@ -533,6 +582,7 @@ typedef enum
     CY_CRYPTO_INSTR_RSA_VER      = 0x19u,
 #endif /* #if (CPUSS_CRYPTO_SHA == 1) */
 
+    CY_CRYPTO_INSTR_QUEUE_INIT   = 0x54u,
     CY_CRYPTO_INSTR_SRV_INFO     = 0x55u,
 
 #if (CPUSS_CRYPTO_VU == 1)
@@ -558,6 +608,21 @@ typedef enum
 * \{
 */
 
+/** The scatter-gather list entry used by the streaming AES-GCM and SHA
+* functions. Each entry describes one fragment of the processed message.
+* The dst field is not used for the additional authenticated data and for
+* the hashed data.
+*/
+typedef struct
+{
+    /** The pointer to the source fragment */
+    uint8_t const *src;
+    /** The pointer to the destination fragment, can be equal to src */
+    uint8_t *dst;
+    /** The size of the fragment (in bytes) */
+    uint32_t size;
+} cy_stc_crypto_sg_entry_t;
+
 #if (CPUSS_CRYPTO_AES == 1)
 
 /** The structure for storing the AES state.
@@ -591,6 +656,45 @@ typedef struct
     uint32_t blockIdx;
     /** \endcond */
 } cy_stc_crypto_aes_state_t;
+
+/** The structure for storing the AES-GCM state.
+* All fields for this structure are internal. Firmware never reads or
+* writes these values. Firmware allocates the structure and provides the
+* address of the structure to the driver in the function calls. Firmware must
+* ensure that the defined instance of this structure remains in scope
+* while the drive is in use.
+*/
+typedef struct
+{
+    /** \cond INTERNAL */
+    /** AES state data */
+    cy_stc_crypto_aes_state_t aesState;
+    /** Operation direction (Encrypt / Decrypt) */
+    cy_en_crypto_dir_mode_t dirMode;
+    /** GHASH multiplication table, low halves of the H multiples */
+    uint64_t hTableL[16];
+    /** GHASH multiplication table, high halves of the H multiples */
+    uint64_t hTableH[16];
+    /** Current GHASH value */
+    uint8_t ghash[CY_CRYPTO_AES_BLOCK_SIZE];
+    /** Encrypted pre-counter block E(K, J0) */
+    uint8_t ekj0[CY_CRYPTO_AES_BLOCK_SIZE];
+    /** Current counter block */
+    uint8_t counter[CY_CRYPTO_AES_BLOCK_SIZE];
+    /** Key stream of the last non-complete block */
+    uint8_t keyStream[CY_CRYPTO_AES_BLOCK_SIZE];
+    /** Cipher text of the last non-complete block, pending for GHASH */
+    uint8_t pending[CY_CRYPTO_AES_BLOCK_SIZE];
+    /** Counter blocks streamed to the Crypto FIFO */
+    uint32_t ctrBlocks[CY_CRYPTO_AES_GCM_CHUNK_BLOCKS * CY_CRYPTO_AES_BLOCK_SIZE_U32];
+    /** Number of bytes in the last non-complete block */
+    uint32_t pendingSize;
+    /** Size of the additional authenticated data (in bytes) */
+    uint64_t aadSize;
+    /** Size of the processed text (in bytes) */
+    uint64_t textSize;
+    /** \endcond */
+} cy_stc_crypto_aes_gcm_state_t;
 #endif /* #if (CPUSS_CRYPTO_AES == 1) */
 
 #if (CPUSS_CRYPTO_SHA == 1)
@@ -648,12 +752,98 @@ typedef struct {
     void *k;
 } cy_stc_crypto_ecc_key;
 
+/** A fixed-base comb table holding precomputed multiples of an ECC base point */
+typedef struct {
+    /** See \ref cy_en_crypto_ecc_curve_id_t */
+    cy_en_crypto_ecc_curve_id_t curveID;
+    /** The comb teeth spacing in bits */
+    uint32_t spacing;
+    /** The points buffer holds valid precomputed points */
+    bool valid;
+    /** The caller-supplied points buffer, \ref CY_CRYPTO_ECC_COMB_POINTS affine
+    *   points, each stored as X followed by Y */
+    uint8_t *points;
+} cy_stc_crypto_ecc_comb_table_t;
+
+/** An ECDSA signature verification entry, see \ref Cy_Crypto_Core_ECC_VerifyHashBatch */
+typedef struct {
+    /** The signature to verify, 'R' followed by 'S' */
+    const uint8_t *sig;
+    /** The hash (message digest) that was signed */
+    const uint8_t *hash;
+    /** The length of the hash (octets) */
+    uint32_t hashlen;
+    /** The corresponding public ECC key. See \ref cy_stc_crypto_ecc_key */
+    const cy_stc_crypto_ecc_key *key;
+} cy_stc_crypto_ecc_verify_t;
+
 /** \} group_crypto_data_structures */
 
 /*************************************************************
 *  Structures used for communication between Client and Server
 ***************************************************************/
 
+/**
+* \addtogroup group_crypto_cli_data_structures
+* \{
+*/
+
+struct cy_stc_crypto_request;
+
+/** The queued Crypto request completion callback function type.
+    Callback is called on the client core when the request is retired by
+    \ref Cy_Crypto_Queue_Process. */
+typedef void (*cy_crypto_request_callback_t)(struct cy_stc_crypto_request *request);
+
+/** The structure for storing one queued Crypto request.
+* The request is armed by \ref Cy_Crypto_Queue_Prepare and filled by the
+* next Crypto client function call. Firmware must keep the request and the
+* function specific context structure in scope until the request is complete.
+*/
+typedef struct cy_stc_crypto_request
+{
+    /** \cond INTERNAL */
+    /** Operation instruction code */
+    cy_en_crypto_comm_instr_t instr;
+    /** Pointer to the crypto function specific context data */
+    void *xdata;
+    /** \endcond */
+    /** The completion callback, may be NULL */
+    cy_crypto_request_callback_t callback;
+    /** User data pointer, not used by the driver */
+    void *userData;
+    /** Response from the executed crypto function, valid when isComplete is set */
+    volatile cy_en_crypto_status_t resp;
+    /** Set by the server when the request is processed */
+    volatile bool isComplete;
+    /** Hardware processing errors */
+    cy_stc_crypto_hw_error_t hwErrorStatus;
+} cy_stc_crypto_request_t;
+
+/** The structure for storing the Crypto request queue.
+* The queue is shared between the client and the server cores and must be
+* located in memory accessible by both of them. All fields are internal.
+*/
+typedef struct
+{
+    /** \cond INTERNAL */
+    /** The ring of request pointers */
+    cy_stc_crypto_request_t **requests;
+    /** The number of entries in the ring, a power of two */
+    uint32_t size;
+    /** IPC release interrupt channel number */
+    uint32_t releaseNotifierChannel;
+    /** The running index of the next submitted request, written by the client */
+    volatile uint32_t head;
+    /** The running index of the next request to process, written by the server */
+    volatile uint32_t done;
+    /** The running index of the next request to retire, written by the client */
+    volatile uint32_t tail;
+    /** \endcond */
+} cy_stc_crypto_queue_t;
+
+/** \} group_crypto_cli_data_structures */
+
 /**
 * \addtogroup group_crypto_srv_data_structures
 * \{
@@ -685,6 +875,8 @@ typedef struct
     bool            isHwErrorOccured;
     /** Hardware processing errors */
     cy_stc_crypto_hw_error_t hwErrorStatus;
+    /** The request queue registered by the client */
+    cy_stc_crypto_queue_t *queue;
     /** \endcond */
 } cy_stc_crypto_server_context_t;
 
@@ -723,6 +915,12 @@ typedef struct
     cy_stc_sysint_t releaseNotifierConfig;
     /** Pointer to the crypto function specific context data */
     void *xdata;
+    /** The request queue, NULL if not initialized */
+    cy_stc_crypto_queue_t *queue;
+    /** The request armed for the next client function call */
+    cy_stc_crypto_request_t *request;
+    /** The request sent through the locked IPC channel is not completed */
+    volatile bool isPending;
     /** \endcond */
 } cy_stc_crypto_context_t;
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_aes.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constant and parameters for the API for the AES method
@@ -425,6 +425,206 @@ __STATIC_INLINE cy_en_crypto_status_t Cy_Crypto_Core_Aes_Ctr(CRYPTO_Type *base,
     return tmpResult;
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Aes_Gcm_Init
+****************************************************************************//**
+*
+* Starts the AES-GCM authenticated encryption or decryption and processes the
+* additional authenticated data (AAD) given as a scatter-gather list.
+*
+* The CTR key stream is generated by the AES engine from counter blocks
+* streamed through the load FIFO, while GHASH is calculated by the CPU in
+* parallel, so the message is processed in one pass.
+*
+* \note AES-GCM is supported by the Crypto hardware version 2 only. For the
+* version 1 the function returns \ref CY_CRYPTO_NOT_SUPPORTED.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param dirMode
+* Can be \ref CY_CRYPTO_ENCRYPT or \ref CY_CRYPTO_DECRYPT
+* (\ref cy_en_crypto_dir_mode_t).
+*
+* \param key
+* The pointer to the encryption/decryption key.
+*
+* \param keyLength
+* \ref cy_en_crypto_aes_key_length_t
+*
+* \param iv
+* The pointer to the initial vector.
+*
+* \param ivSize
+* The size of the initial vector, \ref CY_CRYPTO_AES_GCM_IV_SIZE is
+* recommended.
+*
+* \param aadList
+* The scatter-gather list of the additional authenticated data fragments.
+* Can be NULL when aadCount is zero.
+*
+* \param aadCount
+* The number of entries in aadList.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+__STATIC_INLINE cy_en_crypto_status_t Cy_Crypto_Core_Aes_Gcm_Init(CRYPTO_Type *base,
+                                                cy_en_crypto_dir_mode_t dirMode,
+                                                uint8_t const *key,
+                                                cy_en_crypto_aes_key_length_t keyLength,
+                                                uint8_t const *iv,
+                                                uint32_t ivSize,
+                                                cy_stc_crypto_sg_entry_t const *aadList,
+                                                uint32_t aadCount,
+                                                cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    cy_en_crypto_status_t tmpResult;
+
+    cy_stc_crypto_aes_buffers_t *aesBuffers = (cy_stc_crypto_aes_buffers_t *)Cy_Crypto_Core_GetVuMemoryAddress(base);
+
+    if (CY_CRYPTO_V1)
+    {
+        tmpResult = CY_CRYPTO_NOT_SUPPORTED;
+    }
+    else
+    {
+        tmpResult = Cy_Crypto_Core_V2_Aes_Gcm_Init(base, dirMode, key, keyLength, iv, ivSize,
+                                                   aadList, aadCount, gcmState, aesBuffers);
+    }
+
+    return tmpResult;
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Aes_Gcm_Update
+****************************************************************************//**
+*
+* Encrypts or decrypts the next part of the message given as a scatter-gather
+* list of fragments and adds the cipher text to the authentication tag.
+* The fragments can have any size and are processed in place, without copying
+* to an intermediate buffer. The source and destination of one fragment
+* can be the same.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param sgList
+* The scatter-gather list of the processed message fragments.
+*
+* \param sgCount
+* The number of entries in sgList.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+__STATIC_INLINE cy_en_crypto_status_t Cy_Crypto_Core_Aes_Gcm_Update(CRYPTO_Type *base,
+                                                cy_stc_crypto_sg_entry_t const *sgList,
+                                                uint32_t sgCount,
+                                                cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    cy_en_crypto_status_t tmpResult;
+
+    if (CY_CRYPTO_V1)
+    {
+        tmpResult = CY_CRYPTO_NOT_SUPPORTED;
+    }
+    else
+    {
+        tmpResult = Cy_Crypto_Core_V2_Aes_Gcm_Update(base, sgList, sgCount, gcmState);
+    }
+
+    return tmpResult;
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Aes_Gcm_Finish
+****************************************************************************//**
+*
+* Completes the AES-GCM operation and calculates the authentication tag.
+* On decryption the caller compares the calculated tag with the received one.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param tag
+* The pointer to the buffer for the authentication tag.
+*
+* \param tagSize
+* The size of the authentication tag, from \ref CY_CRYPTO_AES_GCM_MIN_TAG_SIZE
+* to \ref CY_CRYPTO_AES_GCM_TAG_SIZE bytes.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+__STATIC_INLINE cy_en_crypto_status_t Cy_Crypto_Core_Aes_Gcm_Finish(CRYPTO_Type *base,
+                                                uint8_t *tag,
+                                                uint32_t tagSize,
+                                                cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    cy_en_crypto_status_t tmpResult;
+
+    if (CY_CRYPTO_V1)
+    {
+        tmpResult = CY_CRYPTO_NOT_SUPPORTED;
+    }
+    else
+    {
+        tmpResult = Cy_Crypto_Core_V2_Aes_Gcm_Finish(base, tag, tagSize, gcmState);
+    }
+
+    return tmpResult;
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Aes_Gcm_Free
+****************************************************************************//**
+*
+* Clears the AES-GCM operation context.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+__STATIC_INLINE cy_en_crypto_status_t Cy_Crypto_Core_Aes_Gcm_Free(CRYPTO_Type *base,
+                                                cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    cy_en_crypto_status_t tmpResult;
+
+    if (CY_CRYPTO_V1)
+    {
+        tmpResult = CY_CRYPTO_NOT_SUPPORTED;
+    }
+    else
+    {
+        tmpResult = Cy_Crypto_Core_V2_Aes_Gcm_Free(base, gcmState);
+    }
+
+    return tmpResult;
+}
+
 /** \} group_crypto_lld_symmetric_functions */
 
 #endif /* #if (CPUSS_CRYPTO_AES == 1) */
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_aes_v2.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constant and parameters for the API for the AES method
@@ -81,6 +81,29 @@ cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Ctr(CRYPTO_Type *base,
                                                 uint8_t const *src,
                                                 cy_stc_crypto_aes_state_t *aesState);
 
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Init(CRYPTO_Type *base,
+                                                cy_en_crypto_dir_mode_t dirMode,
+                                                uint8_t const *key,
+                                                cy_en_crypto_aes_key_length_t keyLength,
+                                                uint8_t const *iv,
+                                                uint32_t ivSize,
+                                                cy_stc_crypto_sg_entry_t const *aadList,
+                                                uint32_t aadCount,
+                                                cy_stc_crypto_aes_gcm_state_t *gcmState,
+                                                cy_stc_crypto_aes_buffers_t *aesBuffers);
+
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Update(CRYPTO_Type *base,
+                                                cy_stc_crypto_sg_entry_t const *sgList,
+                                                uint32_t sgCount,
+                                                cy_stc_crypto_aes_gcm_state_t *gcmState);
+
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Finish(CRYPTO_Type *base,
+                                                uint8_t *tag,
+                                                uint32_t tagSize,
+                                                cy_stc_crypto_aes_gcm_state_t *gcmState);
+
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Free(CRYPTO_Type *base, cy_stc_crypto_aes_gcm_state_t *gcmState);
+
 
 #endif /* #if (CPUSS_CRYPTO_AES == 1) */
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_ecc.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constant and parameters for the API for the ECC
@@ -69,6 +69,7 @@ typedef struct {
 
 
 cy_stc_crypto_ecc_dp_type *Cy_Crypto_Core_ECC_GetCurveParams(cy_en_crypto_ecc_curve_id_t curveId);
+cy_stc_crypto_ecc_comb_table_t *Cy_Crypto_Core_ECC_GetCombTable(cy_en_crypto_ecc_curve_id_t curveId);
 
 /**
 * \addtogroup group_crypto_lld_asymmetric_functions
@@ -94,6 +95,11 @@ cy_en_crypto_status_t Cy_Crypto_Core_ECC_VerifyHash(CRYPTO_Type *base,
                                     uint32_t hashlen,
                                     uint8_t *stat,
                                     const cy_stc_crypto_ecc_key *key);
+cy_en_crypto_status_t Cy_Crypto_Core_ECC_VerifyHashBatch(CRYPTO_Type *base,
+                                    cy_en_crypto_ecc_curve_id_t curveID,
+                                    const cy_stc_crypto_ecc_verify_t *verifyList,
+                                    uint32_t verifyCount,
+                                    uint32_t *validMap);
 
 cy_en_crypto_status_t Cy_Crypto_Core_ECC_MakePrivateKey(CRYPTO_Type *base,
         cy_en_crypto_ecc_curve_id_t curveID, uint8_t *key,
@@ -102,6 +108,9 @@ cy_en_crypto_status_t Cy_Crypto_Core_ECC_MakePublicKey(CRYPTO_Type *base,
         cy_en_crypto_ecc_curve_id_t curveID,
         const uint8_t *privateKey, cy_stc_crypto_ecc_key *publicKey);
 
+cy_en_crypto_status_t Cy_Crypto_Core_ECC_SetCombTable(cy_en_crypto_ecc_curve_id_t curveID,
+        cy_stc_crypto_ecc_comb_table_t *table, uint8_t *points, uint32_t pointsSize);
+
 /** \} group_crypto_lld_asymmetric_functions */
 
 /* Sizes for NIST P-curves */
@@ -123,6 +132,15 @@ cy_en_crypto_status_t Cy_Crypto_Core_ECC_MakePublicKey(CRYPTO_Type *base,
 #define CY_CRYPTO_ECC_MAX_SIZE             (CY_CRYPTO_ECC_P521_SIZE)
 #define CY_CRYPTO_ECC_MAX_BYTE_SIZE        (CY_CRYPTO_ECC_P521_BYTE_SIZE)
 
+/* Fixed-base comb parameters */
+#define CY_CRYPTO_ECC_COMB_WIDTH           (5u)        /* comb teeth count */
+#define CY_CRYPTO_ECC_COMB_POINTS          (1uL << (CY_CRYPTO_ECC_COMB_WIDTH - 1u))
+#define CY_CRYPTO_ECC_COMB_SPACING(bits)   (((bits) + CY_CRYPTO_ECC_COMB_WIDTH - 1u) / CY_CRYPTO_ECC_COMB_WIDTH)
+#define CY_CRYPTO_ECC_COMB_MAX_SPACING     (CY_CRYPTO_ECC_COMB_SPACING(CY_CRYPTO_ECC_MAX_SIZE))
+
+/** The points buffer size in bytes required by \ref Cy_Crypto_Core_ECC_SetCombTable for a curve of bits size */
+#define CY_CRYPTO_ECC_COMB_TABLE_SIZE(bits) (CY_CRYPTO_ECC_COMB_POINTS * 2u * CY_CRYPTO_BYTE_SIZE_OF_BITS(bits))
+
 /* "Global" vector unit registers. */
 #define VR_D                               10u
 #define VR_S_X                             11u
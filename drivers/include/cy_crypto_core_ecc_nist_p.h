@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_ecc_nist_p.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constant and parameters for the API for the ECC
@@ -50,6 +50,8 @@ cy_en_crypto_status_t Cy_Crypto_Core_EC_NistP_PointMultiplication(CRYPTO_Type *b
     const uint8_t *ecpD,
     uint8_t *ecpQX,
     uint8_t *ecpQY);
+cy_en_crypto_status_t Cy_Crypto_Core_EC_NistP_MakeCombTable(CRYPTO_Type *base,
+    cy_stc_crypto_ecc_comb_table_t *table);
 /** \} group_crypto_lld_asymmetric_functions */
 
 void Cy_Crypto_Core_EC_MulMod( CRYPTO_Type *base, uint32_t z, uint32_t a, uint32_t b, uint32_t size);
@@ -69,6 +71,8 @@ void Cy_Crypto_Core_JacobianTransform(CRYPTO_Type *base, uint32_t s_x, uint32_t
 void Cy_Crypto_Core_JacobianInvTransform(CRYPTO_Type *base, uint32_t s_x, uint32_t s_y, uint32_t s_z, uint32_t size);
 
 void Cy_Crypto_Core_EC_NistP_PointMul(CRYPTO_Type *base, uint32_t p_x, uint32_t p_y, uint32_t p_d, uint32_t p_order, uint32_t bitsize);
+void Cy_Crypto_Core_EC_NistP_CombPointMul(CRYPTO_Type *base, uint32_t p_x, uint32_t p_y, const uint8_t *p_d,
+    const cy_stc_crypto_ecc_comb_table_t *table, uint32_t bitsize);
 
 #endif /* #if (CPUSS_CRYPTO_VU == 1) */
 
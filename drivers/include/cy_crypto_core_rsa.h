@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_rsa.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides provides constant and parameters
@@ -62,6 +62,20 @@ cy_en_crypto_status_t Cy_Crypto_Core_Rsa_Proc(CRYPTO_Type *base,
 cy_en_crypto_status_t Cy_Crypto_Core_Rsa_Coef(CRYPTO_Type *base,
                                               cy_stc_crypto_rsa_pub_key_t const *key);
 
+cy_en_crypto_status_t Cy_Crypto_Core_Rsa_ProcWindow(CRYPTO_Type *base,
+                                              cy_stc_crypto_rsa_pub_key_t const *key,
+                                              uint8_t const *message,
+                                              uint32_t messageSize,
+                                              uint8_t *processedMessage,
+                                              uint32_t *expTable);
+
+cy_en_crypto_status_t Cy_Crypto_Core_Rsa_ProcCrt(CRYPTO_Type *base,
+                                              cy_stc_crypto_rsa_crt_key_t const *key,
+                                              uint8_t const *message,
+                                              uint32_t messageSize,
+                                              uint8_t *processedMessage,
+                                              uint32_t *expTable);
+
 #endif /* #if (CPUSS_CRYPTO_VU == 1) */
 
 cy_en_crypto_status_t Cy_Crypto_Core_Rsa_Verify(CRYPTO_Type *base,
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_sha.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constants and function prototypes
@@ -216,6 +216,56 @@ __STATIC_INLINE cy_en_crypto_status_t Cy_Crypto_Core_Sha_Update(CRYPTO_Type *bas
     return tmpResult;
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Sha_UpdateList
+****************************************************************************//**
+*
+* Performs the SHA calculation on the message given as a scatter-gather list
+* of fragments of any size.
+*
+* For the Crypto hardware version 2 the fragments are streamed through the
+* load FIFO one after another, the hash and the not completed block stay in
+* the register buffer for the whole list, and the compression of a block is
+* queued without waiting for the previous one. For the version 1 the
+* 4-Byte aligned blocks are hashed in place, without copying to the context
+* buffer, with the next SHA instruction queued while the current block is
+* compressed.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param hashState
+* The pointer to the SHA context.
+*
+* \param sgList
+* The scatter-gather list of the message fragments. The dst fields are not used.
+*
+* \param sgCount
+* The number of entries in sgList.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+__STATIC_INLINE cy_en_crypto_status_t Cy_Crypto_Core_Sha_UpdateList(CRYPTO_Type *base,
+                               cy_stc_crypto_sha_state_t *hashState,
+                               cy_stc_crypto_sg_entry_t const *sgList,
+                               uint32_t sgCount)
+{
+    cy_en_crypto_status_t tmpResult;
+
+    if (CY_CRYPTO_V1)
+    {
+        tmpResult = Cy_Crypto_Core_V1_Sha_UpdateList(base, hashState, sgList, sgCount);
+    }
+    else
+    {
+        tmpResult = Cy_Crypto_Core_V2_Sha_UpdateList(base, hashState, sgList, sgCount);
+    }
+
+    return tmpResult;
+}
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_Core_V1_Sha_Finish
 ****************************************************************************//**
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_sha.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constants and function prototypes
@@ -93,6 +93,11 @@ cy_en_crypto_status_t Cy_Crypto_Core_V1_Sha_Update(CRYPTO_Type *base,
                                 uint8_t const *message,
                                 uint32_t messageSize);
 
+cy_en_crypto_status_t Cy_Crypto_Core_V1_Sha_UpdateList(CRYPTO_Type *base,
+                                cy_stc_crypto_sha_state_t *hashState,
+                                cy_stc_crypto_sg_entry_t const *sgList,
+                                uint32_t sgCount);
+
 cy_en_crypto_status_t Cy_Crypto_Core_V1_Sha_Finish(CRYPTO_Type *base,
                                 cy_stc_crypto_sha_state_t *hashState,
                                 uint8_t *digest);
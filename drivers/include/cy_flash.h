@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_flash.h
-* \version 3.40
+* \version 3.50
 *
 * Provides the API declarations of the Flash driver.
 *
@@ -219,6 +219,22 @@
 *    before any flash write/erase operations:
 * \snippet flash/snippet/main.c Flash Initialization
 *
+* \subsection group_flash_config_region Programming a Region:
+* To write an image region (for example, an OTA update) without waiting for
+* each row, fill the \ref cy_stc_flash_region_t structure and call
+* \ref Cy_Flash_StartProgramRegion. The driver erases and programs the rows
+* one by one with the non-blocking Cy_Flash_StartEraseRow() and
+* Cy_Flash_StartProgram() sequence. Call \ref Cy_Flash_ProgramRegionProcess
+* from a periodic interrupt (for example, SysTick) or from the application
+* loop: it starts the next step as soon as the previous flash operation is
+* complete and returns immediately otherwise. The region callback reports the
+* progress after each row. The flash cache is cleared once, when the whole
+* region is written.
+*
+* \note Cy_Flash_ProgramRegionProcess() executes from flash, so do not call it
+* from Cy_Flash_ResumeIrqHandler() or other code that runs while the flash
+* is blocked.
+*
 * \subsection group_flash_config_emeeprom EEPROM section use:
 * If you plan to use "cy_em_eeprom" section for different purposes for both of
 * device cores or use <b>Em_EEPROM Middleware</b> together with flash driver
@@ -256,6 +272,13 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th style="width: 52%;">Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="1">3.50</td>
+*     <td>Added the region programming functions \ref Cy_Flash_StartProgramRegion
+*         and \ref Cy_Flash_ProgramRegionProcess, the \ref cy_stc_flash_region_t
+*         structure.</td>
+*     <td>Write several flash rows in the background.</td>
+*   </tr>
+*   <tr>
 *     <td rowspan="1">3.40</td>
 *     <td>Updated Cy_Flash_OperationStatus() to access protected registers.</td>
 *     <td>Added PSoC 64 device support.</td>
@@ -400,7 +423,7 @@ extern "C" {
 #define CY_FLASH_DRV_VERSION_MAJOR       3
 
 /** Driver minor version */
-#define CY_FLASH_DRV_VERSION_MINOR       40
+#define CY_FLASH_DRV_VERSION_MINOR       50
 
 #define CY_FLASH_ID               (CY_PDL_DRV_ID(0x14UL))                          /**< FLASH PDL ID */
 
@@ -457,6 +480,32 @@ typedef enum cy_en_flashdrv_status
     } cy_stc_flash_notify_t;
 #endif /* !defined(CY_FLASH_RWW_DRV_SUPPORT_DISABLED) */
 
+struct cy_stc_flash_region;
+
+/** The region programming progress callback. It is called from
+* \ref Cy_Flash_ProgramRegionProcess after each programmed row and when
+* the region is complete or failed.
+*/
+typedef void (*cy_flash_region_cb_t)(struct cy_stc_flash_region *region);
+
+/** Flash region programming structure, see \ref Cy_Flash_StartProgramRegion */
+typedef struct cy_stc_flash_region
+{
+    uint32_t             rowAddr;        /**< The address of the first flash row */
+    const uint32_t       *data;          /**< The data in SRAM, numberOfRows * \ref CY_FLASH_SIZEOF_ROW bytes */
+    uint32_t             numberOfRows;   /**< The number of rows to write */
+    cy_flash_region_cb_t callback;       /**< The progress callback, may be NULL */
+    void                 *userData;      /**< User data pointer, not used by the driver */
+    volatile uint32_t    rowsDone;       /**< The number of rows written */
+    volatile cy_en_flashdrv_status_t status; /**< \ref CY_FLASH_DRV_OPCODE_BUSY while the region
+                                              * is being written, then the result
+                                              */
+    /** \cond INTERNAL */
+    bool                 programPhase;   /**< The current row is being programmed (not erased) */
+    bool                 retryStart;     /**< The next operation start failed with the busy IPC */
+    /** \endcond */
+} cy_stc_flash_region_t;
+
 /** \} group_flash_enumerated_types */
 
 /***************************************
@@ -482,6 +531,8 @@ cy_en_flashdrv_status_t Cy_Flash_IsOperationComplete(void);
 cy_en_flashdrv_status_t Cy_Flash_RowChecksum(uint32_t rowAddr, uint32_t* checksumPtr);
 cy_en_flashdrv_status_t Cy_Flash_CalculateHash(const uint32_t* data, uint32_t numberOfBytes, uint32_t* hashPtr);
 uint32_t Cy_Flash_GetExternalStatus(void);
+cy_en_flashdrv_status_t Cy_Flash_StartProgramRegion(cy_stc_flash_region_t *region);
+cy_en_flashdrv_status_t Cy_Flash_ProgramRegionProcess(cy_stc_flash_region_t *region);
 
 #if !defined(CY_FLASH_RWW_DRV_SUPPORT_DISABLED)
     void Cy_Flash_InitExt(cy_stc_flash_notify_t *ipcWaitMessageAddr);
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_ipc_drv.h
-* \version 1.40.2
+* \version 1.50
 *
 * Provides an API declaration of the IPC driver.
 *
@@ -167,6 +167,19 @@
 * After the callback function is returned by the receiver, it invokes the release
 * callback function defined by the sender of the message.
 *
+* Cy_IPC_Pipe_SendMessage() keeps the IPC channel locked until the receiver
+* processes the message, so only one message per channel is in flight. To send
+* many messages without waiting, use a message ring. The ring is a pool of
+* fixed-size buffers and a ring of posted buffer descriptors, both located in
+* memory shared by the cores. The number of buffers must be a power of two. The sender initializes the ring with
+* Cy_IPC_Pipe_RingInit() and the receiver attaches it to its endpoint with
+* Cy_IPC_Pipe_RegisterRing(). The sender gets a buffer with
+* Cy_IPC_Pipe_RingAlloc(), fills the message in place (the first word is the
+* client ID as usual) and posts it with Cy_IPC_Pipe_RingPost(). The receiver
+* interrupt handler dispatches all posted messages in one pass of
+* Cy_IPC_Pipe_ExecuteCallback() and returns each buffer to the pool after its
+* callback returns. The release callbacks are not called for the ring messages.
+*
 * \section group_ipc_sema_layer SEMA Layer
 *
 * A semaphore is a flag the application uses to control access to a shared
@@ -263,6 +276,28 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td>1.50</td>
+*     <td>
+*         <ul>
+*         <li>Added the pipe message rings with a shared buffer pool, see
+*             \ref Cy_IPC_Pipe_RingInit. Senders post messages without
+*             waiting for the receiver to release the IPC channel, and the
+*             receiver processes all posted messages in one interrupt.</li>
+*         <li>Added the optional pipe statistics, enabled by
+*             \ref CY_IPC_PIPE_STATS: message counters, busy rejections and
+*             the callback time and send-to-callback latency histograms per
+*             endpoint, see \ref Cy_IPC_Pipe_GetStats.</li>
+*         <li>Added \ref Cy_IPC_Sema_Acquire to wait for a semaphore with an
+*             exponential back-off and a timeout, and the optional turn
+*             flags and contention counters, see
+*             \ref Cy_IPC_Sema_InitContention. They are registered in the
+*             separate \ref cy_stc_ipc_sema_contention_t structure, and the
+*             layout of \ref cy_stc_ipc_sema_t is unchanged.</li>
+*         </ul>
+*     </td>
+*     <td>New functionality.</td>
+*   </tr>
+*   <tr>
 *     <td>1.40.2</td>
 *     <td>Updated information about IPC resources reserved for the system usage
 *         in \ref group_ipc_pipe_layer section.
@@ -367,7 +402,7 @@
 #define CY_IPC_DRV_VERSION_MAJOR       1
 
 /** Driver minor version */
-#define CY_IPC_DRV_VERSION_MINOR       40
+#define CY_IPC_DRV_VERSION_MINOR       50
 
 /** Defines a value to indicate that no notification events are needed */
 #define CY_IPC_NO_NOTIFICATION         (uint32_t)(0x00000000ul)
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_ipc_pipe.h
-* \version 1.40.2
+* \version 1.50
 *
 *  Description:
 *   IPC Pipe Driver - This header file contains all the function prototypes,
@@ -82,6 +82,9 @@ typedef void (* cy_ipc_pipe_relcallback_ptr_t)(void);
 /** Typedef for array of callback function pointers */
 typedef cy_ipc_pipe_callback_ptr_t *cy_ipc_pipe_callback_array_ptr_t;
 
+/** Typedef for a timestamp function pointer used by the pipe statistics */
+typedef uint32_t (* cy_ipc_pipe_timestamp_ptr_t)(void);
+
 
 /**
 * \addtogroup group_ipc_pipe_macros
@@ -120,6 +123,25 @@ typedef cy_ipc_pipe_callback_ptr_t *cy_ipc_pipe_callback_array_ptr_t;
 /** Denotes that a release interrupt is not pending */
 #define CY_IPC_PIPE_ENDPOINT_NOTBUSY   (0UL)
 
+/** The pipe statistics flag. Enables the per-endpoint message counters and
+* the callback time and latency histograms, see \ref Cy_IPC_Pipe_GetStats.
+* Must be set the same way on all cores. */
+#ifndef CY_IPC_PIPE_STATS
+    #define CY_IPC_PIPE_STATS              (0U) /* Disabled by default */
+#endif
+
+/** The number of histogram bins. Bin N counts the durations from 2^N to
+* 2^(N+1)-1 timestamp ticks, the last bin counts all longer durations. */
+#define CY_IPC_PIPE_STATS_HIST_BINS    (16UL)
+
+#if (CY_IPC_PIPE_STATS != 0U)
+/** The number of 32-bit words of descriptors required by a message ring of blockCount buffers */
+#define CY_IPC_PIPE_RING_DESCR_SIZE(blockCount)    (3UL * (blockCount))
+#else
+/** The number of 32-bit words of descriptors required by a message ring of blockCount buffers */
+#define CY_IPC_PIPE_RING_DESCR_SIZE(blockCount)    (2UL * (blockCount))
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
+
 /** \} group_ipc_pipe_macros */
 
 /**
@@ -127,6 +149,48 @@ typedef cy_ipc_pipe_callback_ptr_t *cy_ipc_pipe_callback_array_ptr_t;
 * \{
 */
 
+/**
+* The pipe message ring. It carries messages in one direction between the
+* endpoints of a pipe. The messages are stored in a pool of fixed-size buffers,
+* which the sender fills in place. The structure, the buffers and the
+* descriptors must be located in memory shared by the cores. All fields are
+* internal.
+*/
+typedef struct
+{
+    uint8_t          *buffers;          /**< Pool of blockCount buffers of blockSize bytes                          */
+    uint32_t          blockSize;        /**< Size of one buffer in bytes                                            */
+    uint32_t          blockCount;       /**< Number of buffers in the pool and entries in each descriptor ring      */
+    uint32_t         *postRing;         /**< Indexes of the posted buffers, sender to receiver                      */
+    uint32_t         *freeRing;         /**< Indexes of the free buffers, receiver to sender                        */
+    volatile uint32_t postHead;         /**< Running index of the next posted buffer, written by the sender         */
+    volatile uint32_t postTail;         /**< Running index of the next buffer to process, written by the receiver   */
+    volatile uint32_t freeHead;         /**< Running index of the next freed buffer, written by the receiver        */
+    volatile uint32_t freeTail;         /**< Running index of the next buffer to allocate, written by the sender    */
+#if (CY_IPC_PIPE_STATS != 0U)
+    uint32_t         *stampRing;        /**< Send timestamps of the posted buffers                                  */
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
+} cy_stc_ipc_pipe_ring_t;
+
+#if (CY_IPC_PIPE_STATS != 0U)
+/**
+* The pipe endpoint statistics. The counters of an endpoint describe the
+* messages sent to this endpoint by the current CPU and the messages received
+* by this endpoint. The durations are measured in the ticks of the timestamp
+* function set by \ref Cy_IPC_Pipe_SetTimestampSource.
+*/
+typedef struct
+{
+    uint32_t sent;                                           /**< Messages sent to the endpoint                       */
+    uint32_t received;                                       /**< Messages received by the endpoint                   */
+    uint32_t busy;                                           /**< Messages rejected because the pipe was busy         */
+    uint32_t callbackMax;                                    /**< Longest callback execution time                     */
+    uint32_t latencyMax;                                     /**< Longest send-to-callback latency                    */
+    uint32_t callbackHist[CY_IPC_PIPE_STATS_HIST_BINS];      /**< Callback execution time histogram                   */
+    uint32_t latencyHist[CY_IPC_PIPE_STATS_HIST_BINS];       /**< Send-to-callback latency histogram                  */
+} cy_stc_ipc_pipe_stats_t;
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
+
 /**
 * This is the definition of a pipe endpoint.  There is one endpoint structure
 * for each CPU in a pipe.  It contains all the information to process a message
@@ -147,6 +211,10 @@ typedef struct
     cy_ipc_pipe_callback_array_ptr_t callbackArray; /**< Pointer to array of callback functions, one for each Client  */
     cy_ipc_pipe_relcallback_ptr_t releaseCallbackPtr;  /**< Pointer to release callback function                      */
     cy_ipc_pipe_relcallback_ptr_t defaultReleaseCallbackPtr; /**< Pointer to default release callback function              */
+    cy_stc_ipc_pipe_ring_t *ringPtr;   /**< Pointer to the message ring received by this endpoint, or NULL             */
+#if (CY_IPC_PIPE_STATS != 0U)
+    cy_stc_ipc_pipe_stats_t stats;     /**< Endpoint statistics                                                         */
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
 } cy_stc_ipc_pipe_ep_t;
 
 /** The Pipe endpoint configuration structure. */
@@ -277,6 +345,18 @@ void                     Cy_IPC_Pipe_Init(cy_stc_ipc_pipe_config_t const *config
 cy_en_ipc_pipe_status_t  Cy_IPC_Pipe_EndpointPause(uint32_t epAddr);
 cy_en_ipc_pipe_status_t  Cy_IPC_Pipe_EndpointResume(uint32_t epAddr);
 
+void                     Cy_IPC_Pipe_RingInit(cy_stc_ipc_pipe_ring_t *ring, void *buffers, uint32_t blockSize,
+                              uint32_t blockCount, uint32_t *descriptors);
+void                     Cy_IPC_Pipe_RegisterRing(uint32_t epAddr, cy_stc_ipc_pipe_ring_t *ring);
+void *                   Cy_IPC_Pipe_RingAlloc(cy_stc_ipc_pipe_ring_t *ring);
+cy_en_ipc_pipe_status_t  Cy_IPC_Pipe_RingPost(uint32_t toAddr, cy_stc_ipc_pipe_ring_t *ring, void *msgPtr);
+
+#if (CY_IPC_PIPE_STATS != 0U)
+void                     Cy_IPC_Pipe_SetTimestampSource(cy_ipc_pipe_timestamp_ptr_t timestampPtr);
+cy_en_ipc_pipe_status_t  Cy_IPC_Pipe_GetStats(uint32_t epAddr, cy_stc_ipc_pipe_stats_t *stats);
+void                     Cy_IPC_Pipe_ClearStats(uint32_t epAddr);
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
+
 /* This function is obsolete and will be removed in the next releases */
 void                     Cy_IPC_Pipe_ExecCallback(cy_stc_ipc_pipe_ep_t * endpoint);
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_ipc_sema.h
-* \version 1.40.2
+* \version 1.50
 *
 * \brief
 * Header file for IPC SEM functions
@@ -69,6 +69,14 @@
 
 #define CY_IPC_SEMA_PER_WORD    (uint32_t)32u   /**< 32 semaphores per word */
 
+#define CY_IPC_SEMA_CORES       (2ul)           /**< Number of CPU cores that use the semaphores */
+
+/** The timeout value of \ref Cy_IPC_Sema_Acquire that waits without a limit */
+#define CY_IPC_SEMA_WAIT_FOREVER    (0xFFFFFFFFul)
+
+/** The version of \ref cy_stc_ipc_sema_contention_t, set when it is registered */
+#define CY_IPC_SEMA_CONTENTION_VERSION  (0x53430100ul)
+
 /** \} group_ipc_sema_macros */
 
 /**
@@ -102,6 +110,17 @@ typedef enum
 } cy_en_ipcsema_status_t;
 
 
+/** IPC semaphore contention counters. Each core updates its own entries. */
+typedef struct
+{
+    /** Successful acquisitions */
+    uint32_t acquired[CY_IPC_SEMA_CORES];
+    /** Attempts that found the semaphore set or the semaphores IPC channel locked */
+    uint32_t contended[CY_IPC_SEMA_CORES];
+    /** \ref Cy_IPC_Sema_Acquire calls that timed out */
+    uint32_t timeouts[CY_IPC_SEMA_CORES];
+} cy_stc_ipc_sema_stats_t;
+
 /** IPC semaphore control data structure. */
 typedef struct
 {
@@ -111,6 +130,35 @@ typedef struct
     uint32_t *arrayPtr;
 } cy_stc_ipc_sema_t;
 
+/**
+* IPC semaphore contention data shared by the CPUs. It is separate from
+* \ref cy_stc_ipc_sema_t, so the semaphores stay compatible with the CPU images
+* built with the previous driver versions. The fields are set by
+* \ref Cy_IPC_Sema_InitContention.
+*/
+typedef struct
+{
+    /** \ref CY_IPC_SEMA_CONTENTION_VERSION when the structure is registered */
+    uint32_t version;
+    /** The number of semaphores covered by the arrays */
+    uint32_t maxSema;
+    /** Pointer to the array of maxSema turn flags used by \ref Cy_IPC_Sema_Acquire, or NULL */
+    uint8_t *turnPtr;
+    /** Pointer to the array of maxSema contention counters, or NULL */
+    cy_stc_ipc_sema_stats_t *statsPtr;
+} cy_stc_ipc_sema_contention_t;
+
+/** The configuration of \ref Cy_IPC_Sema_Acquire. */
+typedef struct
+{
+    /** The delay after the first failed attempt, in microseconds. Must not be 0. */
+    uint16_t minDelayUs;
+    /** The limit of the delay, which doubles after each failed attempt, in microseconds */
+    uint16_t maxDelayUs;
+    /** The total wait time limit in microseconds, or \ref CY_IPC_SEMA_WAIT_FOREVER */
+    uint32_t timeoutUs;
+} cy_stc_ipc_sema_acquire_t;
+
 /** \} group_ipc_sema_enums */
 
 /**
@@ -128,6 +176,11 @@ cy_en_ipcsema_status_t   Cy_IPC_Sema_Set (uint32_t semaNumber, bool preemptable)
 cy_en_ipcsema_status_t   Cy_IPC_Sema_Clear (uint32_t semaNumber, bool preemptable);
 cy_en_ipcsema_status_t   Cy_IPC_Sema_Status (uint32_t semaNumber);
 uint32_t Cy_IPC_Sema_GetMaxSems(void);
+cy_en_ipcsema_status_t   Cy_IPC_Sema_Acquire (uint32_t semaNumber, bool preemptable,
+                                              cy_stc_ipc_sema_acquire_t const *config);
+cy_en_ipcsema_status_t   Cy_IPC_Sema_InitContention (cy_stc_ipc_sema_contention_t *contention,
+                                                     uint8_t turnArray[], cy_stc_ipc_sema_stats_t statsArray[]);
+cy_en_ipcsema_status_t   Cy_IPC_Sema_GetStats (uint32_t semaNumber, cy_stc_ipc_sema_stats_t *stats);
 
 #ifdef __cplusplus
 }
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_common.h
-* \version 2.50
+* \version 2.60
 *
 * Provides common API declarations of the SCB driver.
 *
@@ -137,6 +137,47 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td rowspan="6">2.60</td>
+*     <td>Added the DMA receive ring buffer operation to the UART:
+*         \ref Cy_SCB_UART_StartRingBufferDma and
+*         \ref Cy_SCB_UART_RingBufferDmaUpdate with the
+*         \ref CY_SCB_UART_RB_IDLE_EVENT idle-line event.</td>
+*     <td>Receive continuous data streams without an interrupt per RX FIFO level.</td>
+*   </tr>
+*   <tr>
+*     <td>Fixed \ref Cy_SCB_UART_GetNumInRingBuffer to use the ring buffer size
+*         when the head index wraps around.</td>
+*     <td>The function returned a wrong number of data elements.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the UART transmit queue: \ref Cy_SCB_UART_TransmitQueue and
+*         the \ref cy_stc_scb_uart_tx_buf_t structure.</td>
+*     <td>Transmit data from several buffers back-to-back without copying it
+*         into one buffer.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the SPI master DMA transaction queue: \ref Cy_SCB_SPI_DmaInit,
+*         \ref Cy_SCB_SPI_TransferQueue, \ref Cy_SCB_SPI_DmaInterrupt and the
+*         \ref cy_stc_scb_spi_dma_t and \ref cy_stc_scb_spi_transaction_t
+*         structures.</td>
+*     <td>Offload high-rate SPI master transfers from the CPU.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the I2C master transaction queue:
+*         \ref Cy_SCB_I2C_MasterTransferQueue with the
+*         \ref cy_stc_scb_i2c_master_transaction_t and
+*         \ref cy_stc_scb_i2c_master_op_t structures.</td>
+*     <td>Execute a sequence of combined write-then-read transfers without
+*         CPU intervention between them.</td>
+*   </tr>
+*   <tr>
+*     <td>Added the DMA operation to the I2C master and EZI2C slave:
+*         \ref Cy_SCB_I2C_MasterDmaInit, \ref Cy_SCB_I2C_MasterDmaInterrupt,
+*         \ref Cy_SCB_EZI2C_DmaInit and the \ref cy_stc_scb_i2c_master_dma_t
+*         and \ref cy_stc_scb_ezi2c_dma_t structures.</td>
+*     <td>Reduce the number of interrupts for large I2C transfers.</td>
+*   </tr>
+*   <tr>
 *     <td>2.50</td>
 *     <td>Fixed the \ref Cy_SCB_SPI_SetActiveSlaveSelectPolarity function to 
 *         properly configure the polarity of the slave select line.</td>
@@ -351,6 +392,10 @@
 #include "cy_syslib.h"
 #include "cy_syspm.h"
 
+#if defined(CY_IP_M4CPUSS_DMA)
+#include "cy_dma.h"
+#endif /* CY_IP_M4CPUSS_DMA */
+
 #ifdef CY_IP_MXSCB
 
 #if defined(__cplusplus)
@@ -440,6 +485,14 @@ void     Cy_SCB_WriteString       (CySCB_Type *base, char_t const string[]);
 void     Cy_SCB_WriteDefaultArrayNoCheck(CySCB_Type *base, uint32_t txData, uint32_t size);
 uint32_t Cy_SCB_WriteDefaultArray (CySCB_Type *base, uint32_t txData, uint32_t size);
 
+#if defined(CY_IP_M4CPUSS_DMA)
+void     Cy_SCB_DmaSetDescriptors (cy_stc_dma_descriptor_t descriptor[], void const *fifo, void *buffer,
+                                   uint32_t size, bool isRx, bool incBuffer, bool byteMode,
+                                   cy_stc_dma_descriptor_t *nextDescriptor);
+uint32_t Cy_SCB_DmaGetNumTransferred(DW_Type const *dwBase, uint32_t channel,
+                                     cy_stc_dma_descriptor_t const descriptor[], uint32_t size);
+#endif /* CY_IP_M4CPUSS_DMA */
+
 __STATIC_INLINE uint32_t Cy_SCB_GetFifoSize (CySCB_Type const *base);
 __STATIC_INLINE void     Cy_SCB_FwBlockReset(CySCB_Type *base);
 __STATIC_INLINE bool     Cy_SCB_IsRxDataWidthByte(CySCB_Type const *base);
@@ -463,7 +516,7 @@ __STATIC_INLINE uint32_t Cy_SCB_GetRxFifoLevel   (CySCB_Type const *base);
 #define CY_SCB_DRV_VERSION_MAJOR    (2)
 
 /** Driver minor version */
-#define CY_SCB_DRV_VERSION_MINOR    (30)
+#define CY_SCB_DRV_VERSION_MINOR    (60)
 
 /** SCB driver identifier */
 #define CY_SCB_ID           CY_PDL_DRV_ID(0x2AU)
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_ezi2c.h
-* \version 2.50
+* \version 2.60
 *
 * Provides EZI2C API declarations of the SCB driver.
 *
@@ -188,6 +188,12 @@
 * address remains the same, there is no need for a write operation.
 * \image html scb_ezi2c_set_ba_read.png
 *
+* On devices with the DW DMA, call \ref Cy_SCB_EZI2C_DmaInit to load the TX
+* FIFO with a DW channel during the read operation. The channel moves the
+* buffer data starting from the base address and then the 0xFF bytes, so
+* \ref Cy_SCB_EZI2C_Interrupt handles only the address and Stop conditions
+* of the read operation.
+*
 ********************************************************************************
 * \section group_scb_ezi2c_lp Low Power Support
 ********************************************************************************
@@ -329,6 +335,28 @@ typedef struct cy_stc_scb_ezi2c_config
     bool enableWakeFromSleep;
 } cy_stc_scb_ezi2c_config_t;
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/** The number of the DMA descriptors used for the read operation */
+#define CY_SCB_EZI2C_DMA_DESCR_NUM  (3U)
+
+/**
+* The EZI2C slave DMA configuration. The user allocates the structure in SRAM,
+* sets the DW block and channel, and then calls \ref Cy_SCB_EZI2C_DmaInit.
+* The trigger input of the channel must be connected to the tr_tx_req output
+* of the SCB (see \ref group_trigmux).
+*/
+typedef struct
+{
+    DW_Type *dwBase;                /**< The DW block which moves the data */
+    uint32_t txChannel;             /**< The DW channel triggered by the SCB TX FIFO level */
+    uint32_t priority;              /**< The priority of the DW channel (0-3) */
+    /** \cond INTERNAL */
+    cy_stc_dma_descriptor_t descriptor[CY_SCB_EZI2C_DMA_DESCR_NUM]; /**< The buffer descriptors and the 0xFF descriptor */
+    uint32_t txDefault;             /**< The DMA source when the read passes the end of the buffer */
+    /** \endcond */
+} cy_stc_scb_ezi2c_dma_t;
+#endif /* CY_IP_M4CPUSS_DMA */
+
 /** EZI2C slave context structure.
 * All fields for the context structure are internal. Firmware never reads or
 * writes these values. Firmware allocates the structure and provides the
@@ -361,6 +389,10 @@ typedef struct cy_stc_scb_ezi2c_context
     uint8_t *buf2;          /**< The pointer to the buffer exposed on the request intended for the secondary slave address */
     uint32_t buf2Size;      /**< The buffer size assigned to the secondary slave address */
     uint32_t buf2rwBondary; /**< The Read/Write boundary within the buffer assigned for the secondary slave address */
+
+#if defined(CY_IP_M4CPUSS_DMA)
+    cy_stc_scb_ezi2c_dma_t *dma; /**< The DMA which loads the TX FIFO during the read operation */
+#endif /* CY_IP_M4CPUSS_DMA */
     /** \endcond */
 } cy_stc_scb_ezi2c_context_t;
 /** \} group_scb_ezi2c_data_structures */
@@ -398,6 +430,11 @@ void Cy_SCB_EZI2C_SetBuffer2(CySCB_Type const *base, uint8_t *buffer, uint32_t s
 
 uint32_t Cy_SCB_EZI2C_GetActivity(CySCB_Type const *base, cy_stc_scb_ezi2c_context_t *context);
 
+#if defined(CY_IP_M4CPUSS_DMA)
+cy_en_scb_ezi2c_status_t Cy_SCB_EZI2C_DmaInit(CySCB_Type *base, cy_stc_scb_ezi2c_dma_t *dma,
+                                              cy_stc_scb_ezi2c_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
+
 void Cy_SCB_EZI2C_Interrupt(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
 /** \} group_scb_ezi2c_slave_functions */
 
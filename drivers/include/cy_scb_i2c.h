@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_i2c.h
-* \version 2.50
+* \version 2.60
 *
 * Provides I2C API declarations of the SCB driver.
 *
@@ -206,6 +206,29 @@
 *
 * \snippet scb/i2c_snippet/main.c I2C_MASTER_WRITE_READ_INT
 *
+* To execute a sequence of transfers without CPU intervention between them
+* (for example, polling several sensors on the same bus), describe each
+* transfer by \ref cy_stc_scb_i2c_master_op_t and pass the list of them as
+* \ref cy_stc_scb_i2c_master_transaction_t to \ref Cy_SCB_I2C_MasterTransferQueue.
+* Each operation writes data to the slave and then reads data from it using
+* a ReStart condition (either part can be omitted). The operations are started
+* one after another by \ref Cy_SCB_I2C_Interrupt as soon as the previous one
+* completes, and the transaction callback is called after the last one.
+* The status of each operation is available in the operation structure.
+* The transactions are queued, so a new transaction can be added while
+* the previous one is in progress.
+*
+* On devices with the DW DMA, the master can move the data of large transfers
+* between the buffer and the FIFOs with DW channels instead of
+* \ref Cy_SCB_I2C_Interrupt. Call \ref Cy_SCB_I2C_MasterDmaInit once, then
+* \ref Cy_SCB_I2C_MasterWrite and \ref Cy_SCB_I2C_MasterRead (also started by
+* the transaction queue) use the DMA for transfers longer than the FIFO.
+* The DMA moves all bytes except the last ones, which are handled by
+* \ref Cy_SCB_I2C_Interrupt to generate NACK and Stop. The
+* \ref Cy_SCB_I2C_MasterDmaInterrupt must be called from the interrupt handler
+* of both DW channels. A DW channel error fails only the current operation
+* with \ref CY_SCB_I2C_MASTER_DMA_ERR, the queue continues with the next one.
+*
 ********************************************************************************
 * \subsubsection group_scb_i2c_master_ll Use Low-Level Functions
 ********************************************************************************
@@ -542,6 +565,78 @@ typedef struct cy_stc_scb_i2c_config
 
 } cy_stc_scb_i2c_config_t;
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/** The number of the DMA descriptors used for one direction of the master transfer */
+#define CY_SCB_I2C_DMA_DESCR_NUM    (2U)
+
+/**
+* The I2C master DMA configuration. The user allocates the structure in SRAM,
+* sets the DW block and channels, and then calls \ref Cy_SCB_I2C_MasterDmaInit.
+* The trigger input of the RX channel must be connected to the tr_rx_req
+* output of the SCB, and the trigger input of the TX channel - to the
+* tr_tx_req output of the SCB (see \ref group_trigmux).
+*/
+typedef struct
+{
+    DW_Type *dwBase;                /**< The DW block which moves the data */
+    uint32_t rxChannel;             /**< The DW channel triggered by the SCB RX FIFO level */
+    uint32_t txChannel;             /**< The DW channel triggered by the SCB TX FIFO level */
+    uint32_t priority;              /**< The priority of the DW channels (0-3) */
+    /** \cond INTERNAL */
+    cy_stc_dma_descriptor_t rxDescriptor[CY_SCB_I2C_DMA_DESCR_NUM];  /**< The RX descriptor chain */
+    cy_stc_dma_descriptor_t txDescriptor[CY_SCB_I2C_DMA_DESCR_NUM];  /**< The TX descriptor chain */
+    /** \endcond */
+} cy_stc_scb_i2c_master_dma_t;
+#endif /* CY_IP_M4CPUSS_DMA */
+
+struct cy_stc_scb_i2c_master_transaction;
+
+/**
+* The master transaction callback. It is called from \ref Cy_SCB_I2C_Interrupt
+* when all operations of the transaction are complete.
+*/
+typedef void (* cy_cb_scb_i2c_master_transaction_t)(struct cy_stc_scb_i2c_master_transaction *transaction);
+
+/**
+* I2C master operation, an element of \ref cy_stc_scb_i2c_master_transaction_t.
+* The operation writes data into the slave and then reads data from the slave
+* using a ReStart condition. The write is skipped when wrSize is zero, the read
+* is skipped when rdSize is zero. When both sizes are zero, only the slave
+* address is sent.
+*/
+typedef struct cy_stc_scb_i2c_master_op
+{
+    uint8_t  slaveAddress;      /**< The 7-bit right justified slave address to communicate with */
+    uint8_t  *wrBuffer;         /**< The pointer to the data to write into the slave */
+    uint32_t  wrSize;           /**< The number of bytes to write */
+    uint8_t  *rdBuffer;         /**< The pointer to the buffer for data read from the slave */
+    uint32_t  rdSize;           /**< The number of bytes to read */
+
+    /**
+    * The operation status, see \ref group_scb_i2c_macros_master_status.
+    * \ref CY_SCB_I2C_MASTER_BUSY is set while the operation is in progress and
+    * errors are reported using the master error statuses.
+    */
+    volatile uint32_t status;
+} cy_stc_scb_i2c_master_op_t;
+
+/**
+* I2C master transaction, see \ref Cy_SCB_I2C_MasterTransferQueue.
+* Firmware must keep the structure, operations and buffers in scope until
+* the transaction callback is called.
+*/
+typedef struct cy_stc_scb_i2c_master_transaction
+{
+    cy_stc_scb_i2c_master_op_t *ops;    /**< The pointer to the array of operations */
+    uint32_t numOps;                    /**< The number of operations */
+    cy_cb_scb_i2c_master_transaction_t callback; /**< The transaction callback, may be NULL */
+    void     *userData;                 /**< User data pointer, not used by the driver */
+    /** \cond INTERNAL */
+    volatile uint32_t opIdx;            /**< The operation in progress */
+    struct cy_stc_scb_i2c_master_transaction *next; /**< The next queued transaction */
+    /** \endcond */
+} cy_stc_scb_i2c_master_transaction_t;
+
 /** I2C context structure.
 * All fields for the context structure are internal. Firmware never reads or
 * writes these values. Firmware allocates the structure and provides the
@@ -566,6 +661,15 @@ typedef struct cy_stc_scb_i2c_context
     volatile uint32_t masterBufferIdx;  /**< The current location in the master buffer */
     volatile uint32_t masterNumBytes;   /**< The number of bytes to send or receive */
 
+    cy_stc_scb_i2c_master_transaction_t *masterXferHead; /**< The transaction in progress */
+    cy_stc_scb_i2c_master_transaction_t *masterXferTail; /**< The last queued transaction */
+    uint32_t masterXferPhase;           /**< The phase of the operation in progress */
+
+#if defined(CY_IP_M4CPUSS_DMA)
+    cy_stc_scb_i2c_master_dma_t *masterDma; /**< The DMA which moves the master data */
+    volatile uint32_t masterDmaSize;    /**< The number of bytes the DMA moves (0 - the DMA is not active) */
+#endif /* CY_IP_M4CPUSS_DMA */
+
     volatile uint32_t slaveStatus;       /**< The slave status */
     volatile bool     slaveRdBufEmpty;   /**< Tracks slave Read buffer empty event */
 
@@ -687,6 +791,15 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterRead (CySCB_Type *base, cy_stc_scb_i2c_m
 void     Cy_SCB_I2C_MasterAbortRead          (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 uint32_t Cy_SCB_I2C_MasterGetStatus          (CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context);
 uint32_t Cy_SCB_I2C_MasterGetTransferCount   (CySCB_Type const *base, cy_stc_scb_i2c_context_t const *context);
+
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterTransferQueue(CySCB_Type *base,
+                                              cy_stc_scb_i2c_master_transaction_t *transaction,
+                                              cy_stc_scb_i2c_context_t *context);
+
+#if defined(CY_IP_M4CPUSS_DMA)
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterDmaInit(CySCB_Type *base, cy_stc_scb_i2c_master_dma_t *dma,
+                                                cy_stc_scb_i2c_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
 /** \} group_scb_i2c_master_low_high_functions */
 
 /**
@@ -711,6 +824,9 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWriteByte  (CySCB_Type *base, uint8_t by
 void Cy_SCB_I2C_Interrupt      (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 void Cy_SCB_I2C_SlaveInterrupt (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 void Cy_SCB_I2C_MasterInterrupt (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+#if defined(CY_IP_M4CPUSS_DMA)
+void Cy_SCB_I2C_MasterDmaInterrupt(CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
 
 __STATIC_INLINE void Cy_SCB_I2C_RegisterEventCallback(CySCB_Type const *base, cy_cb_scb_i2c_handle_events_t callback,
                                                       cy_stc_scb_i2c_context_t *context);
@@ -829,6 +945,12 @@ cy_en_syspm_status_t Cy_SCB_I2C_HibernateCallback(cy_stc_syspm_callback_params_t
 * because the slave was addressed before the master generated a start
 */
 #define CY_SCB_I2C_MASTER_ABORT_START  (0x01000000UL)
+
+/**
+* A DW channel that moves the data of the transfer reported an error, the
+* transaction was aborted
+*/
+#define CY_SCB_I2C_MASTER_DMA_ERR      (0x02000000UL)
 /** \} group_scb_i2c_macros_master_status */
 
 /**
@@ -948,7 +1070,7 @@ cy_en_syspm_status_t Cy_SCB_I2C_HibernateCallback(cy_stc_syspm_callback_params_t
 /* Master error statuses */
 #define CY_SCB_I2C_MASTER_ERR (CY_SCB_I2C_MASTER_ABORT_START | CY_SCB_I2C_MASTER_ADDR_NAK | \
                                CY_SCB_I2C_MASTER_DATA_NAK    | CY_SCB_I2C_MASTER_BUS_ERR  | \
-                               CY_SCB_I2C_MASTER_ARB_LOST)
+                               CY_SCB_I2C_MASTER_ARB_LOST    | CY_SCB_I2C_MASTER_DMA_ERR)
 
 /* Master interrupt masks */
 #define CY_SCB_I2C_MASTER_INTR     (CY_SCB_MASTER_INTR_I2C_ARB_LOST | CY_SCB_MASTER_INTR_I2C_BUS_ERROR | \
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_spi.h
-* \version 2.50
+* \version 2.60
 *
 * Provides SPI API declarations of the SCB driver.
 *
@@ -206,6 +206,17 @@
 *
 * \snippet scb/spi_snippet/main.c SPI_TRANFER_DATA
 *
+* On devices with the DW DMA, the SPI master can move the data with a pair of
+* DW channels instead of \ref Cy_SCB_SPI_Interrupt. Call \ref Cy_SCB_SPI_DmaInit
+* once, then describe each transaction (slave select, TX and RX buffers and
+* size) by \ref cy_stc_scb_spi_transaction_t and pass it to
+* \ref Cy_SCB_SPI_TransferQueue. The queued transactions are started one after
+* another from \ref Cy_SCB_SPI_DmaInterrupt, which must be called from the
+* interrupt handler of both DW channels. The CPU is only involved once per
+* transaction to select the slave, start the next transaction and call the
+* transaction callback. The \ref CY_SCB_SPI_TRANSFER_CMPLT_EVENT is generated
+* when the queue is empty.
+*
 ********************************************************************************
 * \section group_scb_spi_dma_trig DMA Trigger
 ********************************************************************************
@@ -290,6 +301,9 @@
 #define CY_SCB_SPI_H
 
 #include "cy_scb_common.h"
+#if defined(CY_IP_M4CPUSS_DMA)
+#include "cy_dma.h"
+#endif /* CY_IP_M4CPUSS_DMA */
 
 #ifdef CY_IP_MXSCB
 
@@ -397,6 +411,71 @@ typedef enum
 */
 typedef void (* cy_cb_scb_spi_handle_events_t)(uint32_t event);
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/** The number of the DMA descriptors used for one direction of a transaction */
+#define CY_SCB_SPI_DMA_DESCR_NUM    (2U)
+
+/**
+* The SPI master DMA configuration. The user allocates the structure in SRAM,
+* sets the DW block and channels, and then calls \ref Cy_SCB_SPI_DmaInit.
+* The trigger input of the RX channel must be connected to the tr_rx_req
+* output of the SCB, and the trigger input of the TX channel - to the
+* tr_tx_req output of the SCB (see \ref group_trigmux).
+*
+* \note The RX channel must win the DW arbitration over the TX channel
+* (use a lower channel number), otherwise the RX FIFO may overflow at high
+* SCLK frequencies.
+*/
+typedef struct
+{
+    DW_Type *dwBase;                /**< The DW block which moves the data */
+    uint32_t rxChannel;             /**< The DW channel triggered by the SCB RX FIFO level */
+    uint32_t txChannel;             /**< The DW channel triggered by the SCB TX FIFO level */
+    uint32_t priority;              /**< The priority of the DW channels (0-3) */
+    /** \cond INTERNAL */
+    cy_stc_dma_descriptor_t rxDescriptor[CY_SCB_SPI_DMA_DESCR_NUM];  /**< The RX descriptor chain */
+    cy_stc_dma_descriptor_t txDescriptor[CY_SCB_SPI_DMA_DESCR_NUM];  /**< The TX descriptor chain */
+    /** \endcond */
+} cy_stc_scb_spi_dma_t;
+
+struct cy_stc_scb_spi_transaction;
+
+/**
+* The transaction completion callback. It is called from
+* \ref Cy_SCB_SPI_DmaInterrupt after the next queued transaction is started.
+*/
+typedef void (* cy_cb_scb_spi_transaction_t)(struct cy_stc_scb_spi_transaction *transaction);
+
+/**
+* SPI master DMA transaction, see \ref Cy_SCB_SPI_TransferQueue.
+* Firmware must keep the structure and its buffers in scope until the
+* transaction callback is called.
+*/
+typedef struct cy_stc_scb_spi_transaction
+{
+    cy_en_scb_spi_slave_select_t slaveSelect;   /**< The slave select line of the transaction */
+
+    /**
+    * The pointer to the data to transmit. The element size is defined by the
+    * TX data width. NULL transmits \ref CY_SCB_SPI_DEFAULT_TX.
+    */
+    void     *txBuffer;
+
+    /**
+    * The pointer to the buffer to store the received data. The element size
+    * is defined by the RX data width. NULL discards the received data.
+    */
+    void     *rxBuffer;
+
+    uint32_t  size;                             /**< The number of data elements, up to 65536 */
+    cy_cb_scb_spi_transaction_t callback;       /**< The completion callback, may be NULL */
+    void     *userData;                         /**< User data pointer, not used by the driver */
+    /** \cond INTERNAL */
+    struct cy_stc_scb_spi_transaction *next;    /**< The next queued transaction */
+    /** \endcond */
+} cy_stc_scb_spi_transaction_t;
+#endif /* CY_IP_M4CPUSS_DMA */
+
 
 /** SPI configuration structure */
 typedef struct cy_stc_scb_spi_config
@@ -544,6 +623,14 @@ typedef struct cy_stc_scb_spi_context
     */
     cy_cb_scb_spi_handle_events_t cbEvents;
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    cy_stc_scb_spi_dma_t *dma;                  /**< The DMA which moves the transaction data */
+    cy_stc_scb_spi_transaction_t *xferHead;     /**< The transaction in progress */
+    cy_stc_scb_spi_transaction_t *xferTail;     /**< The last queued transaction */
+    uint32_t dmaTxDefault;                      /**< The DMA source when the TX buffer is NULL */
+    uint32_t dmaRxDiscard;                      /**< The DMA destination when the RX buffer is NULL */
+#endif /* CY_IP_M4CPUSS_DMA */
+
 #if !defined(NDEBUG)
     uint32_t initKey;               /**< Tracks the context initialization */
 #endif /* !(NDEBUG) */
@@ -585,6 +672,13 @@ cy_en_scb_spi_status_t Cy_SCB_SPI_Transfer(CySCB_Type *base, void *txBuffer, voi
 void     Cy_SCB_SPI_AbortTransfer    (CySCB_Type *base, cy_stc_scb_spi_context_t *context);
 uint32_t Cy_SCB_SPI_GetTransferStatus(CySCB_Type const *base, cy_stc_scb_spi_context_t const *context);
 uint32_t Cy_SCB_SPI_GetNumTransfered (CySCB_Type const *base, cy_stc_scb_spi_context_t const *context);
+
+#if defined(CY_IP_M4CPUSS_DMA)
+cy_en_scb_spi_status_t Cy_SCB_SPI_DmaInit(CySCB_Type *base, cy_stc_scb_spi_dma_t *dma,
+                                          cy_stc_scb_spi_context_t *context);
+cy_en_scb_spi_status_t Cy_SCB_SPI_TransferQueue(CySCB_Type *base, cy_stc_scb_spi_transaction_t *transaction,
+                                                cy_stc_scb_spi_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
 /** \} group_scb_spi_high_level_functions */
 
 /**
@@ -621,6 +715,9 @@ __STATIC_INLINE void Cy_SCB_SPI_ClearTxFifo(CySCB_Type *base);
 * \{
 */
 void Cy_SCB_SPI_Interrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
+#if defined(CY_IP_M4CPUSS_DMA)
+void Cy_SCB_SPI_DmaInterrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
 
 __STATIC_INLINE void Cy_SCB_SPI_RegisterCallback(CySCB_Type const *base, cy_cb_scb_spi_handle_events_t callback,
                                                  cy_stc_scb_spi_context_t *context);
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_uart.h
-* \version 2.50
+* \version 2.60
 *
 * Provides UART API declarations of the SCB driver.
 *
@@ -202,6 +202,15 @@
 * <b>Transmit Operation</b>
 * \snippet scb/uart_snippet/main.c UART_TRANSMIT_DATA_HL
 *
+* To transmit data located in several buffers (for example, a frame header,
+* payload and CRC) without copying it into one buffer, describe each buffer
+* by \ref cy_stc_scb_uart_tx_buf_t and pass it to \ref Cy_SCB_UART_TransmitQueue.
+* The buffers are queued and loaded into the TX FIFO back-to-back by
+* \ref Cy_SCB_UART_Interrupt, so there is no gap on the bus between them.
+* The buffer callback is called as soon as the buffer content is in the TX
+* FIFO and the buffer can be reused. The \ref CY_SCB_UART_TRANSMIT_DONE_EVENT
+* is generated when all queued data is sent on the bus.
+*
 * There is also capability to insert a receive ring buffer that operates between
 * the RX FIFO and the user buffer. The received data is copied into the ring
 * buffer from the RX FIFO. This process runs in the background after the ring
@@ -210,6 +219,18 @@
 * buffer and then sets up an interrupt to receive more data if the required
 * amount has not yet been read.
 *
+* On devices with the DW DMA, the ring buffer can be filled by a DMA channel
+* instead of the RX interrupt: call \ref Cy_SCB_UART_StartRingBufferDma.
+* The channel runs a circular descriptor chain that writes the RX FIFO data
+* straight into the ring buffer, so the CPU is not involved while the data
+* arrives. The DMA write position is published to the ring buffer head by
+* \ref Cy_SCB_UART_RingBufferDmaUpdate, which is also called from
+* \ref Cy_SCB_UART_Interrupt on every RX interrupt. To detect the end of a
+* burst, call \ref Cy_SCB_UART_RingBufferDmaUpdate periodically (for example,
+* from a TCPWM counter interrupt with a period of a few character times): the
+* \ref CY_SCB_UART_RB_IDLE_EVENT is generated when no data was received
+* between two calls after the data flow stopped.
+*
 ********************************************************************************
 * \section group_scb_uart_dma_trig DMA Trigger
 ********************************************************************************
@@ -290,6 +311,9 @@
 #define CY_SCB_UART_H
 
 #include "cy_scb_common.h"
+#if defined(CY_IP_M4CPUSS_DMA)
+#include "cy_dma.h"
+#endif /* CY_IP_M4CPUSS_DMA */
 
 #ifdef CY_IP_MXSCB
 
@@ -379,6 +403,27 @@ typedef enum
 */
 typedef void (* cy_cb_scb_uart_handle_events_t)(uint32_t event);
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/** The number of the DMA descriptors used for the ring buffer */
+#define CY_SCB_UART_DMA_DESCR_NUM   (2U)
+
+/**
+* The UART receive DMA configuration. The user allocates the structure in
+* SRAM, sets the DW block and channel, and then passes it to
+* \ref Cy_SCB_UART_StartRingBufferDma. The trigger input of the channel must
+* be connected to the tr_rx_req output of the SCB (see \ref group_trigmux).
+*/
+typedef struct
+{
+    DW_Type *dwBase;                /**< The DW block which moves the data */
+    uint32_t rxChannel;             /**< The DW channel triggered by the SCB RX FIFO level */
+    uint32_t priority;              /**< The priority of the DW channel (0-3) */
+    /** \cond INTERNAL */
+    cy_stc_dma_descriptor_t descriptor[CY_SCB_UART_DMA_DESCR_NUM];  /**< The circular descriptor chain */
+    /** \endcond */
+} cy_stc_scb_uart_dma_t;
+#endif /* CY_IP_M4CPUSS_DMA */
+
 /** UART configuration structure */
 typedef struct stc_scb_uart_config
 {
@@ -526,6 +571,34 @@ typedef struct stc_scb_uart_config
     uint32_t    txFifoIntEnableMask;
 } cy_stc_scb_uart_config_t;
 
+struct cy_stc_scb_uart_tx_buf;
+
+/**
+* The transmit queue buffer callback. It is called from \ref Cy_SCB_UART_Interrupt
+* when the last data element of the buffer is loaded into the TX FIFO.
+*/
+typedef void (* cy_cb_scb_uart_tx_buf_t)(struct cy_stc_scb_uart_tx_buf *txBuf);
+
+/**
+* UART transmit queue buffer, see \ref Cy_SCB_UART_TransmitQueue.
+* Firmware must keep the structure and its data in scope until the buffer
+* callback is called.
+*/
+typedef struct cy_stc_scb_uart_tx_buf
+{
+    /**
+    * The pointer to the data to transmit. The element size is defined by the
+    * data type, which depends on the configured data width.
+    */
+    void     *buffer;
+    uint32_t  size;                         /**< The number of data elements to transmit */
+    cy_cb_scb_uart_tx_buf_t callback;       /**< The buffer callback, may be NULL */
+    void     *userData;                     /**< User data pointer, not used by the driver */
+    /** \cond INTERNAL */
+    struct cy_stc_scb_uart_tx_buf *next;    /**< The next queued buffer */
+    /** \endcond */
+} cy_stc_scb_uart_tx_buf_t;
+
 /** UART context structure.
 * All fields for the context structure are internal. Firmware never reads or
 * writes these values. Firmware allocates the structure and provides the
@@ -552,11 +625,21 @@ typedef struct cy_stc_scb_uart_context
     uint32_t  txBufSize;                /**< The transmit buffer size */
     uint32_t volatile txLeftToTransmit; /**< The number of data elements left to be transmitted */
 
+    cy_stc_scb_uart_tx_buf_t *txQueueHead; /**< The queued buffer loaded into the TX FIFO */
+    cy_stc_scb_uart_tx_buf_t *txQueueTail; /**< The last queued buffer */
+    bool volatile txQueueActive;        /**< The transmit operation is started by the queue */
+
     /** The pointer to an event callback that is called when any of
     * \ref group_scb_uart_macros_callback_events occurs
     */
     cy_cb_scb_uart_handle_events_t cbEvents;
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    cy_stc_scb_uart_dma_t *rxRingDma;   /**< The DMA which fills the ring buffer */
+    uint32_t  rxRingDmaIdleHead;        /**< The head index at the last idle check */
+    bool      rxRingDmaActive;          /**< Data was received since the last idle check */
+#endif /* CY_IP_M4CPUSS_DMA */
+
 #if !defined(NDEBUG)
     uint32_t initKey;               /**< Tracks the context initialization */
 #endif /* !(NDEBUG) */
@@ -597,6 +680,12 @@ void     Cy_SCB_UART_StartRingBuffer   (CySCB_Type *base, void *buffer, uint32_t
 void     Cy_SCB_UART_StopRingBuffer    (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 uint32_t Cy_SCB_UART_GetNumInRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_context_t const *context);
 void     Cy_SCB_UART_ClearRingBuffer   (CySCB_Type const *base, cy_stc_scb_uart_context_t *context);
+#if defined(CY_IP_M4CPUSS_DMA)
+cy_en_scb_uart_status_t Cy_SCB_UART_StartRingBufferDma(CySCB_Type *base, void *buffer, uint32_t size,
+                                                       cy_stc_scb_uart_dma_t *dma,
+                                                       cy_stc_scb_uart_context_t *context);
+void     Cy_SCB_UART_RingBufferDmaUpdate(CySCB_Type const *base, cy_stc_scb_uart_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
 
 cy_en_scb_uart_status_t Cy_SCB_UART_Receive(CySCB_Type *base, void *buffer, uint32_t size,
                                             cy_stc_scb_uart_context_t *context);
@@ -609,6 +698,9 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Transmit(CySCB_Type *base, void *buffer, uin
 void     Cy_SCB_UART_AbortTransmit       (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 uint32_t Cy_SCB_UART_GetTransmitStatus   (CySCB_Type const *base, cy_stc_scb_uart_context_t const *context);
 uint32_t Cy_SCB_UART_GetNumLeftToTransmit(CySCB_Type const *base, cy_stc_scb_uart_context_t const *context);
+
+cy_en_scb_uart_status_t Cy_SCB_UART_TransmitQueue(CySCB_Type *base, cy_stc_scb_uart_tx_buf_t *txBuf,
+                                                  cy_stc_scb_uart_context_t *context);
 /** \} group_scb_uart_high_level_functions */
 
 /**
@@ -858,6 +950,13 @@ cy_en_syspm_status_t Cy_SCB_UART_HibernateCallback(cy_stc_syspm_callback_params_
 
 /** The transmit fifo is empty. To use this event the \ref CY_SCB_UART_TX_EMPTY interrupt must be enabled by the user. */
 #define CY_SCB_UART_TRANSMIT_EMTPY          (0x80UL)
+
+/**
+* The line is idle: no data was written into the ring buffer by the DMA
+* since the previous call of \ref Cy_SCB_UART_RingBufferDmaUpdate, but data
+* was received before it. Generated only by the DMA ring buffer operation.
+*/
+#define CY_SCB_UART_RB_IDLE_EVENT           (0x100UL)
 /** \} group_scb_uart_macros_callback_events */
 
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_sd_host.h
-* \version 1.50.1
+* \version 1.60
 *
 *  This file provides constants and parameter values for
 *  the SD Host Controller driver.
@@ -61,7 +61,7 @@
 * * Wrap address transfers
 * * eMMC boot operation
 * * Suspend/Resume operation in an SDIO card
-* * Operation in SDR104, UHS-II mode, High Speed DDR, HS200, and HS400
+* * Operation in UHS-II mode, High Speed DDR, and HS400
 * * Serial Peripheral Interface (SPI) protocol mode
 * * Interrupt input pins for the embedded SD system
 * * Auto-tuning
@@ -181,6 +181,34 @@
 *
 * \snippet sd_host/snippet/main.c SD_HOST_WRITE_READ_ADMA3
 *
+* \subsubsection group_sd_host_batch Use ADMA3 Batches
+* \ref Cy_SD_Host_BatchTransfer runs a list of block reads and writes with one
+* start. The function builds an ADMA3 Integrated descriptor table with one
+* Command descriptor and ADMA2 descriptors for each entry in the arena
+* provided by the user and writes the Integrated Descriptor Address. The
+* SD host sends all the commands and transfers the data without the CPU.
+* Wait for the Transfer complete event of the last command. Use
+* \ref CY_SD_HOST_ADMA3_ARENA_SIZE to allocate the arena. The batch requires
+* the ADMA2-ADMA3 mode.
+*
+* \subsubsection group_sd_host_stream Use the Stream Writer
+* For continuous recording, \ref Cy_SD_Host_StreamOpen starts one open-ended
+* multiple-block write (CMD25). For SD cards, it first sends ACMD23 with the
+* number of blocks to pre-erase. Each \ref Cy_SD_Host_StreamWrite call adds
+* the blocks of the next user buffer to the same write through the buffer data
+* port. \ref Cy_SD_Host_StreamFlush stops the transfer at the block gap and
+* sends CMD12, so the card sees a single long write.
+*
+* \subsubsection group_sd_host_queue Use the Request Queue
+* \ref Cy_SD_Host_Read and \ref Cy_SD_Host_Write wait for the command
+* completion and, without DMA, for the data transfer. Call
+* \ref Cy_SD_Host_QueueInit to transfer the blocks in the background instead.
+* \ref Cy_SD_Host_QueueSubmit adds a read or write request to the queue and
+* returns. Each request has its own ADMA2 descriptor table. The SDHC interrupt
+* handler calls \ref Cy_SD_Host_QueueInterrupt, which starts the command of
+* the next request as soon as the transfer of the current one completes, and
+* then calls the request callback. The queue requires the ADMA2 mode.
+*
 * \subsection group_sd_host_emmc_card_mode eMMC Card Operation
 * eMMC cards use the same API for writing and reading data.
 * Additionally, eMMC requires configuring GPIO pins for DAT signals
@@ -188,6 +216,26 @@
 * The emmc member of \ref cy_stc_sd_host_init_config_t structure must
 * be set to "true".
 *
+* Many small writes to the eMMC can be combined into one packed write command
+* with \ref Cy_SD_Host_eMMC_PackedWrite. The function sends CMD23 with
+* the Packed flag, then CMD25 with a packed header block followed by the data
+* of all the entries. The number of entries must not exceed the value returned
+* by \ref Cy_SD_Host_eMMC_GetMaxPackedWrites for the EXT_CSD read by
+* \ref Cy_SD_Host_GetExtCsd. Zero means the device does not support packed
+* commands. The packed write requires the ADMA2 mode.
+*
+* \subsection group_sd_host_tuning SDR104 and HS200 Modes
+* The SDR104 (SD) and HS200 (eMMC) bus speed modes require the sampling clock
+* tuning. Set the bus speed mode with \ref Cy_SD_Host_SetBusSpeedMode, change
+* the SD clock frequency, and then call \ref Cy_SD_Host_ExecuteTuning.
+* The function sends the tuning command (CMD19 for SD, CMD21 for eMMC) until
+* the SD host finds the sampling point. The tuning is also required
+* for SDR50 when the Use Tuning for SDR50 capability is set. When
+* \ref Cy_SD_Host_AbortTransfer or the request queue detects a CRC or tuning
+* error in the tuned mode, call \ref Cy_SD_Host_Retune from the thread context
+* before the next transfer. It executes the tuning again when the card is ready.
+* For the eMMC, \ref CY_SD_HOST_BUS_SPEED_SDR104 selects HS200.
+*
 * \subsection group_sd_host_sdio_combo_card_mode eMMC SDIO or Combo Card Operation
 * \ref Cy_SD_Host_InitCard() initializes all types of cards and
 * automatically detects the card type: SD, SDIO or Combo card.
@@ -275,6 +323,30 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td>1.60</td>
+*     <td><ul>
+*         <li>Added the request queue: \ref Cy_SD_Host_QueueInit,
+*             \ref Cy_SD_Host_QueueSubmit, \ref Cy_SD_Host_QueueInterrupt and
+*             \ref Cy_SD_Host_QueueIsBusy functions, the
+*             \ref cy_stc_sd_host_request_t and \ref cy_stc_sd_host_queue_t
+*             structures.</li>
+*         <li>Added the ADMA3 batch transfer: \ref Cy_SD_Host_BatchTransfer
+*             function, the \ref cy_stc_sd_host_batch_entry_t structure and the
+*             \ref CY_SD_HOST_ADMA3_ARENA_SIZE macro.</li>
+*         <li>Added the eMMC packed write: \ref Cy_SD_Host_eMMC_PackedWrite and
+*             \ref Cy_SD_Host_eMMC_GetMaxPackedWrites functions, the
+*             \ref CY_SD_HOST_PACKED_ARENA_SIZE macro.</li>
+*         <li>Added the stream writer: \ref Cy_SD_Host_StreamOpen,
+*             \ref Cy_SD_Host_StreamWrite and \ref Cy_SD_Host_StreamFlush
+*             functions, the \ref cy_stc_sd_host_stream_t structure.</li>
+*         <li>Added the SDR104 and HS200 bus speed modes and the sampling clock
+*             tuning: \ref Cy_SD_Host_ExecuteTuning and \ref Cy_SD_Host_Retune
+*             functions. The tuning is executed again after the CRC and tuning
+*             errors.</li>
+*         </ul></td>
+*     <td>New functionality.</td>
+*   </tr>
+*   <tr>
 *     <td>1.50.1</td>
 *     <td>Minor documentation updates.</td>
 *     <td>Documentation enhancement.</td>
@@ -419,7 +491,7 @@ extern "C"
 #define CY_SD_HOST_DRV_VERSION_MAJOR       1
 
 /** Driver minor version */
-#define CY_SD_HOST_DRV_VERSION_MINOR       30
+#define CY_SD_HOST_DRV_VERSION_MINOR       60
 
 /******************************************************************************
 * API Constants
@@ -463,6 +535,29 @@ extern "C"
 #define CY_SD_HOST_ADMA3_CMD                (0x1UL) /**< The Command descriptor. */
 #define CY_SD_HOST_ADMA3_INTERGRATED        (0x7UL) /**< The Integrated descriptor. */
 #define CY_SD_HOST_ADMA2_DESCR_SIZE         (0x2UL) /**< The ADMA2 descriptor size. */
+#define CY_SD_HOST_ADMA3_CMD_DESCR_SIZE     (0x8UL) /**< The ADMA3 Command descriptor size (four lines). */
+#define CY_SD_HOST_ADMA3_ID_SIZE            (0x2UL) /**< The ADMA3 Integrated descriptor size. */
+#define CY_SD_HOST_QUEUE_ADMA2_LINES        (8UL)   /**< The number of the ADMA2 descriptor lines in a queued request. */
+#define CY_SD_HOST_QUEUE_LINE_BLOCKS        (64UL)  /**< The number of blocks transferred by one descriptor line. */
+#define CY_SD_HOST_QUEUE_MAX_BLOCKS         (CY_SD_HOST_QUEUE_ADMA2_LINES * CY_SD_HOST_QUEUE_LINE_BLOCKS) /**< The maximum number
+                                                      * of blocks in a queued request.
+                                                      */
+
+/** The arena size in 32-bit words required by \ref Cy_SD_Host_BatchTransfer
+* for the batch of numEntries entries which transfer totalBlocks blocks.
+*/
+#define CY_SD_HOST_ADMA3_ARENA_SIZE(numEntries, totalBlocks) \
+            (((numEntries) * (CY_SD_HOST_ADMA3_ID_SIZE + CY_SD_HOST_ADMA3_CMD_DESCR_SIZE + CY_SD_HOST_ADMA2_DESCR_SIZE)) + \
+             (((totalBlocks) / CY_SD_HOST_QUEUE_LINE_BLOCKS) * CY_SD_HOST_ADMA2_DESCR_SIZE))
+
+#define CY_SD_HOST_PACKED_MAX_ENTRIES       (63UL) /**< The maximum number of entries in the packed header. */
+
+/** The arena size in 32-bit words required by \ref Cy_SD_Host_eMMC_PackedWrite
+* for numEntries entries which write totalBlocks blocks.
+*/
+#define CY_SD_HOST_PACKED_ARENA_SIZE(numEntries, totalBlocks) \
+            ((CY_SD_HOST_BLOCK_SIZE / 4UL) + (((numEntries) + 1UL) * CY_SD_HOST_ADMA2_DESCR_SIZE) + \
+             (((totalBlocks) / CY_SD_HOST_QUEUE_LINE_BLOCKS) * CY_SD_HOST_ADMA2_DESCR_SIZE))
 
 /* ADMA descriptor table positions. */
 #define CY_SD_HOST_ADMA_ATTR_VALID_POS      (0U) /**< The ADMA Attr Valid position. */
@@ -985,7 +1080,9 @@ extern "C"
 
 /**
 * Tuning error.
-* The SD Host driver does not support this function.
+* This bit is set when an unrecoverable error is detected in a tuning circuit
+* except during the tuning procedure. The driver executes the tuning again
+* when it resets this error.
 */
 #define CY_SD_HOST_TUNING_ERR              (0x0400U)
 
@@ -1278,7 +1375,11 @@ typedef enum
     CY_SD_HOST_BUS_SPEED_SDR25              = 3U,  /**< SDR25: UHS-I (1.8V signaling) at 50 MHz SDClk (25 MB/sec). */
     CY_SD_HOST_BUS_SPEED_SDR50              = 4U,  /**< SDR50: UHS-I (1.8V signaling) at 100 MHz SDClk (50 MB/sec). */
     CY_SD_HOST_BUS_SPEED_EMMC_LEGACY        = 5U,  /**< Backwards Compatibility with legacy MMC card (26MB/sec max). */
-    CY_SD_HOST_BUS_SPEED_EMMC_HIGHSPEED_SDR = 6U   /**< eMMC High speed SDR (52MB/sec max) */
+    CY_SD_HOST_BUS_SPEED_EMMC_HIGHSPEED_SDR = 6U,  /**< eMMC High speed SDR (52MB/sec max) */
+    CY_SD_HOST_BUS_SPEED_SDR104             = 7U,  /**< SDR104: UHS-I (1.8V signaling) up to 208 MHz SDClk (104 MB/sec).
+                                                     * Requires \ref Cy_SD_Host_ExecuteTuning.
+                                                     */
+    CY_SD_HOST_BUS_SPEED_EMMC_HS200         = 8U   /**< eMMC HS200 (200MB/sec max). Requires \ref Cy_SD_Host_ExecuteTuning. */
 } cy_en_sd_host_bus_speed_mode_t;
 
 /** The SD bus voltage select. */
@@ -1452,6 +1553,70 @@ typedef struct
     uint32_t                      csd[4];       /**< The Card-Specific Data register. */
 }cy_stc_sd_host_context_t;
 
+struct cy_stc_sd_host_request;
+
+/** The queued request completion callback. It is called from
+* \ref Cy_SD_Host_QueueInterrupt after the next request is started.
+*/
+typedef void (*cy_sd_host_request_cb_t)(struct cy_stc_sd_host_request *request);
+
+/** SD Host queued request structure, see \ref Cy_SD_Host_QueueSubmit.
+* Firmware must keep the request and its data buffer in scope until
+* the request is complete.
+*/
+typedef struct cy_stc_sd_host_request
+{
+    uint32_t*                     data;            /**< The pointer to data. */
+    uint32_t                      address;         /**< The address to Write/Read data on the card or eMMC. */
+    uint32_t                      numberOfBlocks;  /**< The number of blocks to Write/Read,
+                                                     * up to \ref CY_SD_HOST_QUEUE_MAX_BLOCKS.
+                                                     */
+    bool                          read;            /**< true = Read from the card, false = Write to the card. */
+    cy_sd_host_request_cb_t       callback;        /**< The completion callback, may be NULL. */
+    void                          *userData;       /**< User data pointer, not used by the driver. */
+    volatile cy_en_sd_host_status_t status;        /**< CY_SD_HOST_OPERATION_INPROGRESS while the request
+                                                     * is queued, then the completion status.
+                                                     */
+    /** \cond INTERNAL */
+    uint32_t                      adma2Descr[CY_SD_HOST_QUEUE_ADMA2_LINES * CY_SD_HOST_ADMA2_DESCR_SIZE]; /**< The ADMA2 descriptor table. */
+    struct cy_stc_sd_host_request *next;           /**< The next queued request. */
+    /** \endcond */
+} cy_stc_sd_host_request_t;
+
+/** SD Host request queue structure. All fields are internal. */
+typedef struct
+{
+    /** \cond INTERNAL */
+    SDHC_Type                     *base;           /**< The SD host registers structure pointer. */
+    cy_stc_sd_host_context_t const *context;       /**< The SD host context. */
+    cy_stc_sd_host_request_t      *head;           /**< The request in progress. */
+    cy_stc_sd_host_request_t      *tail;           /**< The last queued request. */
+    uint32_t                      dataTimeout;     /**< The timeout value for the transfers. */
+    /** \endcond */
+} cy_stc_sd_host_queue_t;
+
+/** SD Host ADMA3 batch entry structure, see \ref Cy_SD_Host_BatchTransfer. */
+typedef struct
+{
+    uint32_t*                     data;            /**< The pointer to data. */
+    uint32_t                      address;         /**< The address to Write/Read data on the card or eMMC. */
+    uint32_t                      numberOfBlocks;  /**< The number of blocks to Write/Read. */
+    bool                          read;            /**< true = Read from the card, false = Write to the card. */
+} cy_stc_sd_host_batch_entry_t;
+
+/** SD Host stream writer structure, see \ref Cy_SD_Host_StreamOpen.
+* All fields are internal.
+*/
+typedef struct
+{
+    /** \cond INTERNAL */
+    SDHC_Type                     *base;           /**< The SD host registers structure pointer. */
+    cy_stc_sd_host_context_t const *context;       /**< The SD host context. */
+    uint32_t                      address;         /**< The address of the next block on the card. */
+    bool                          open;            /**< The open-ended write is in progress. */
+    /** \endcond */
+} cy_stc_sd_host_stream_t;
+
 /** \} group_sd_host_data_structures */
 
 
@@ -1480,6 +1645,37 @@ cy_en_sd_host_status_t Cy_SD_Host_Erase(SDHC_Type *base,
                                         uint32_t endAddr,
                                         cy_en_sd_host_erase_type_t eraseType,
                                         cy_stc_sd_host_context_t const *context);
+cy_en_sd_host_status_t Cy_SD_Host_QueueInit(SDHC_Type *base,
+                                            cy_stc_sd_host_queue_t *queue,
+                                            uint32_t dataTimeout,
+                                            cy_stc_sd_host_context_t const *context);
+cy_en_sd_host_status_t Cy_SD_Host_QueueSubmit(cy_stc_sd_host_queue_t *queue,
+                                              cy_stc_sd_host_request_t *request);
+bool Cy_SD_Host_QueueIsBusy(cy_stc_sd_host_queue_t const *queue);
+cy_en_sd_host_status_t Cy_SD_Host_BatchTransfer(SDHC_Type *base,
+                                                cy_stc_sd_host_batch_entry_t const *entries,
+                                                uint32_t numberOfEntries,
+                                                uint32_t *arena,
+                                                uint32_t arenaSize,
+                                                uint32_t dataTimeout,
+                                                cy_stc_sd_host_context_t const *context);
+cy_en_sd_host_status_t Cy_SD_Host_eMMC_PackedWrite(SDHC_Type *base,
+                                                   cy_stc_sd_host_batch_entry_t const *entries,
+                                                   uint32_t numberOfEntries,
+                                                   uint32_t *arena,
+                                                   uint32_t arenaSize,
+                                                   uint32_t dataTimeout,
+                                                   cy_stc_sd_host_context_t const *context);
+cy_en_sd_host_status_t Cy_SD_Host_StreamOpen(SDHC_Type *base,
+                                             cy_stc_sd_host_stream_t *stream,
+                                             uint32_t address,
+                                             uint32_t preEraseBlocks,
+                                             uint32_t dataTimeout,
+                                             cy_stc_sd_host_context_t const *context);
+cy_en_sd_host_status_t Cy_SD_Host_StreamWrite(cy_stc_sd_host_stream_t *stream,
+                                              uint32_t const *data,
+                                              uint32_t numberOfBlocks);
+cy_en_sd_host_status_t Cy_SD_Host_StreamFlush(cy_stc_sd_host_stream_t *stream);
 
 /** \} group_sd_host_high_level_functions */
 
@@ -1505,6 +1701,9 @@ cy_en_sd_host_status_t Cy_SD_Host_SetBusWidth(SDHC_Type *base,
                                               cy_stc_sd_host_context_t const *context);
 cy_en_sd_host_status_t Cy_SD_Host_SetHostSpeedMode(SDHC_Type *base,
                                                   cy_en_sd_host_bus_speed_mode_t speedMode);
+cy_en_sd_host_status_t Cy_SD_Host_ExecuteTuning(SDHC_Type *base);
+cy_en_sd_host_status_t Cy_SD_Host_Retune(SDHC_Type *base,
+                                         cy_stc_sd_host_context_t *context);
 cy_en_sd_host_status_t Cy_SD_Host_SetBusSpeedMode(SDHC_Type *base,
                                                   cy_en_sd_host_bus_speed_mode_t speedMode,
                                                   cy_stc_sd_host_context_t const *context);
@@ -1549,6 +1748,7 @@ cy_en_sd_host_status_t Cy_SD_Host_GetCsd(SDHC_Type *base,
 cy_en_sd_host_status_t Cy_SD_Host_GetExtCsd(SDHC_Type *base,
                                             uint32_t *extCsd,
                                             cy_stc_sd_host_context_t *context);
+uint32_t Cy_SD_Host_eMMC_GetMaxPackedWrites(uint32_t const *extCsd);
 uint32_t Cy_SD_Host_GetRca(SDHC_Type *base);
 cy_en_sd_host_status_t Cy_SD_Host_GetScr(SDHC_Type *base,
                                          uint32_t *scr,
@@ -1578,6 +1778,7 @@ __STATIC_INLINE void Cy_SD_Host_SetErrorInterruptEnable(SDHC_Type *base, uint32_
 __STATIC_INLINE uint32_t Cy_SD_Host_GetErrorInterruptEnable(SDHC_Type const *base);
 __STATIC_INLINE void Cy_SD_Host_SetErrorInterruptMask(SDHC_Type *base, uint32_t interruptMask);
 __STATIC_INLINE uint32_t Cy_SD_Host_GetErrorInterruptMask(SDHC_Type const *base);
+void Cy_SD_Host_QueueInterrupt(cy_stc_sd_host_queue_t *queue);
 
 /** \} group_sd_host_interrupt_functions */
 
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_smif.h
-* \version 1.50.1
+* \version 1.60
 *
 * Provides an API declaration of the Cypress SMIF driver.
 *
@@ -115,6 +115,52 @@
 * The user should invalidate the cache by calling Cy_SMIF_CacheInvalidate() when 
 * switching from the MMIO mode to XIP mode.
 *
+* The memory slot functions Cy_SMIF_MemRead(), Cy_SMIF_MemWrite() and
+* Cy_SMIF_MemEraseSector() block until the memory completes the operation.
+* Use Cy_SMIF_MemAsyncRead(), Cy_SMIF_MemAsyncWrite() and
+* Cy_SMIF_MemAsyncEraseSector() to run the operation in the background. These
+* functions poll the memory from Cy_SMIF_MemAsyncProcess() and report the
+* completion through a callback. See Cy_SMIF_MemAsyncInit() for details.
+*
+* The SMIF caches can only be invalidated as a whole. When the external memory
+* is modified in the MMIO mode (for example, by a firmware update), use
+* Cy_SMIF_CacheInvalidateRange() instead: it invalidates the caches only when
+* the modified range overlaps the XIP memory region of an enabled device, so the
+* cached code is not evicted by writes to the memory that is not executed in
+* place.
+*
+* The cache efficiency can be estimated with Cy_SMIF_CacheStatsStart(). The
+* SMIF has no cache hit or miss counters, so the driver counts the invalidations
+* in software and uses the Energy Profiler to count the SPI transfers
+* (cache line fills and prefetches in XIP mode) and the clk_hf cycles the
+* slave select is active.
+*
+* The interrupt-driven transfers move every byte through the data FIFOs with
+* the CPU. For the large transfers, Cy_SMIF_ReceiveDataDma() and
+* Cy_SMIF_TransmitDataDma() move the data with a DataWire (DW) channel
+* triggered by the SMIF RX or TX FIFO level. Cy_SMIF_MemAsyncSetDma() makes
+* the asynchronous memory functions use the DMA. The reads use the DMA for the
+* word-aligned part of the buffer, and the unaligned head and tail bytes are
+* transferred by the interrupt. The page programs are never split: an
+* unaligned page is moved by the DMA byte by byte. See Cy_SMIF_DmaInit() for
+* details.
+*
+* SFDP memories usually support several erase types, for example, 4 KB sectors
+* and 32 KB and 64 KB blocks. When the eraseTypes array is provided in
+* cy_stc_smif_mem_device_cfg_t, Cy_SMIF_MemSfdpDetect() stores all erase types
+* there, and Cy_SMIF_MemEraseSector() erases a range with the minimal number of
+* the erases, mixing the block and sector erases (see Cy_SMIF_MemGetErasePlan()).
+*
+* Many quad memories support the continuous read (0-4-4) mode: the mode byte
+* of the quad I/O Read command keeps the memory in this mode, and the next read
+* starts with the address. When CY_SMIF_FLAG_CONTINUOUS_READ is set,
+* Cy_SMIF_MemInit() enters this mode and the XIP reads are sent without the
+* command. Cy_SMIF_MemSfdpDetect() detects the mode byte from the SFDP. The
+* Cy_SMIF_MemCmd functions exit this mode before sending their commands. Call
+* Cy_SMIF_MemExitContinuousRead() before sending the commands with the
+* low-level functions, for example Cy_SMIF_TransmitCommand().
+* The SMIF supports single data rate transfers only.
+*
 * \section group_smif_configuration Configuration Considerations
 *
 * PDL API has common parameters: base, context, config described in
@@ -214,6 +260,48 @@
 * <table class="doxtable">
 *   <tr><th>Version</th><th>Changes</th><th>Reason for Change</th></tr>
 *   <tr>
+*     <td>1.60</td>
+*     <td><ul>
+*         <li>Added the \ref Cy_SMIF_CacheInvalidateRange function that skips
+*             the cache invalidation when the modified range is not mapped
+*             into the XIP memory space.</li>
+*         <li>Added the XIP cache statistics: \ref Cy_SMIF_CacheStatsInit,
+*             \ref Cy_SMIF_CacheStatsStart, \ref Cy_SMIF_CacheStatsUpdate and
+*             \ref Cy_SMIF_CacheStatsStop functions and the
+*             \ref cy_stc_smif_cache_stats_t structure.</li>
+*         <li>Added the asynchronous memory operations:
+*             \ref Cy_SMIF_MemAsyncInit, \ref Cy_SMIF_MemAsyncRead,
+*             \ref Cy_SMIF_MemAsyncWrite, \ref Cy_SMIF_MemAsyncEraseSector,
+*             \ref Cy_SMIF_MemAsyncProcess and \ref Cy_SMIF_MemAsyncIsBusy.
+*             The read can run while the erase is suspended.</li>
+*         <li>Added the erase suspend parameters to the
+*             \ref cy_stc_smif_mem_device_cfg_t structure. They are detected
+*             by \ref Cy_SMIF_MemSfdpDetect.</li>
+*         <li>Added the \ref CY_SMIF_BUSY status.</li>
+*         <li>Added the DMA transfers: \ref Cy_SMIF_DmaInit,
+*             \ref Cy_SMIF_ReceiveDataDma, \ref Cy_SMIF_TransmitDataDma,
+*             \ref Cy_SMIF_DmaInterrupt, \ref Cy_SMIF_MemAsyncSetDma functions,
+*             the \ref cy_stc_smif_dma_t structure and the
+*             \ref CY_SMIF_DMA_ERROR status.</li>
+*         <li>Added the erase planning: \ref Cy_SMIF_MemGetEraseStep and
+*             \ref Cy_SMIF_MemGetErasePlan functions, the
+*             \ref cy_stc_smif_mem_erase_type_t and
+*             \ref cy_stc_smif_mem_erase_step_t structures, the eraseTypes
+*             field of \ref cy_stc_smif_mem_device_cfg_t and the eraseTypeMask
+*             field of \ref cy_stc_smif_hybrid_region_info_t.
+*             \ref Cy_SMIF_MemEraseSector and
+*             \ref Cy_SMIF_MemAsyncEraseSector use the largest erase types
+*             that fit the range.</li>
+*         <li>Added the continuous read mode: \ref Cy_SMIF_MemEnterContinuousRead
+*             and \ref Cy_SMIF_MemExitContinuousRead functions, the
+*             \ref CY_SMIF_FLAG_CONTINUOUS_READ flag and the continuousReadMode
+*             field of \ref cy_stc_smif_mem_device_cfg_t. The mode is detected
+*             by \ref Cy_SMIF_MemSfdpDetect and entered by
+*             \ref Cy_SMIF_MemInit.</li>
+*         </ul></td>
+*     <td>New functionality.</td>
+*   </tr>
+*   <tr>
 *     <td>1.50.1</td>
 *     <td>Minor documentation updates. </td>
 *     <td>Documentation improvement. </td>
@@ -443,6 +531,10 @@
 #include "cy_device_headers.h"
 #include "cy_syslib.h"
 #include "cy_syspm.h"
+#include "cy_profile.h"
+#if defined(CY_IP_M4CPUSS_DMA)
+#include "cy_dma.h"
+#endif /* CY_IP_M4CPUSS_DMA */
 
 
 #ifdef CY_IP_MXSMIF
@@ -464,7 +556,7 @@ extern "C" {
 #define CY_SMIF_DRV_VERSION_MAJOR       1
 
 /** The driver minor version */
-#define CY_SMIF_DRV_VERSION_MINOR       50
+#define CY_SMIF_DRV_VERSION_MINOR       60
 
 /** One microsecond timeout for Cy_SMIF_TimeoutRun() */
 #define CY_SMIF_WAIT_1_UNIT             (1U)
@@ -695,6 +787,8 @@ typedef enum
     CY_SMIF_NO_SFDP_SUPPORT = CY_SMIF_ID |CY_PDL_STATUS_ERROR | 0x05U,   /**< The external memory does not support SFDP (JESD216B). */
     CY_SMIF_NOT_HYBRID_MEM  = CY_SMIF_ID |CY_PDL_STATUS_ERROR | 0x06U,   /**< The external memory is not hybrid */
     CY_SMIF_SFDP_CORRUPTED_TABLE = CY_SMIF_ID |CY_PDL_STATUS_ERROR | 0x07U, /**< The SFDP table is corrupted */
+    CY_SMIF_BUSY            = CY_SMIF_ID |CY_PDL_STATUS_ERROR | 0x08U,   /**< An asynchronous memory operation is in progress */
+    CY_SMIF_DMA_ERROR       = CY_SMIF_ID |CY_PDL_STATUS_ERROR | 0x09U,   /**< The DMA transfer of the data failed */
     /** Failed to initialize the slave select 0 external memory by auto detection (SFDP). */
     CY_SMIF_SFDP_SS0_FAILED = CY_SMIF_ID |CY_PDL_STATUS_ERROR |
                             ((uint32_t)CY_SMIF_SFDP_FAIL << CY_SMIF_SFDP_FAIL_SS0_POS),
@@ -821,6 +915,59 @@ typedef struct
     uint32_t timeout;
 } cy_stc_smif_context_t;
 
+/** The SMIF XIP cache statistics. See \ref Cy_SMIF_CacheStatsInit. */
+typedef struct
+{
+    uint32_t invalidations;         /**< The number of the cache invalidations done by the driver */
+    /**
+    * The number of the \ref Cy_SMIF_CacheInvalidateRange calls that skipped the
+    * invalidation because the range is not XIP mapped or the caches are disabled
+    */
+    uint32_t invalidationsSkipped;
+    /**
+    * The number of the SPI transfers on the monitored slave select. In XIP mode
+    * this is the number of the cache line fills and prefetches (cache misses).
+    * Updated by \ref Cy_SMIF_CacheStatsUpdate.
+    */
+    uint64_t transfers;
+    /**
+    * The number of the clk_hf cycles the monitored slave select was active.
+    * Updated by \ref Cy_SMIF_CacheStatsUpdate.
+    */
+    uint64_t busyCycles;
+#if defined(CY_IP_MXPROFILE)
+    /** \cond INTERNAL */
+    cy_stc_profile_ctr_ptr_t transferCtr;   /**< The profiler counter of the transfers */
+    cy_stc_profile_ctr_ptr_t busyCtr;       /**< The profiler counter of the busy cycles */
+    /** \endcond */
+#endif /* CY_IP_MXPROFILE */
+} cy_stc_smif_cache_stats_t;
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/** The number of the DMA descriptors used for one SMIF data transfer */
+#define CY_SMIF_DMA_DESCR_NUM   (2U)
+
+/**
+* The SMIF DMA configuration. The user allocates the structure in SRAM, sets
+* the DW block and channels, and then calls \ref Cy_SMIF_DmaInit.
+* The trigger input of the RX channel must be connected to the tr_rx_req
+* output of SMIF, and the trigger input of the TX channel - to the tr_tx_req
+* output of SMIF (see \ref group_trigmux).
+*/
+typedef struct
+{
+    DW_Type *dwBase;                /**< The DW block which moves the data */
+    uint32_t rxChannel;             /**< The DW channel triggered by the SMIF RX FIFO level */
+    uint32_t txChannel;             /**< The DW channel triggered by the SMIF TX FIFO level */
+    uint32_t priority;              /**< The priority of the DW channels (0-3) */
+    /** \cond INTERNAL */
+    cy_stc_dma_descriptor_t descriptor[CY_SMIF_DMA_DESCR_NUM];  /**< The descriptor chain of the transfer */
+    uint32_t rxTriggerLevel;        /**< The RX FIFO trigger level restored after the transfer */
+    uint32_t txTriggerLevel;        /**< The TX FIFO trigger level restored after the transfer */
+    /** \endcond */
+} cy_stc_smif_dma_t;
+#endif /* CY_IP_M4CPUSS_DMA */
+
 /** \} group_smif_data_structures */
 
 
@@ -891,6 +1038,31 @@ cy_en_smif_status_t Cy_SMIF_CacheDisable(SMIF_Type *base, cy_en_smif_cache_t cac
 cy_en_smif_status_t Cy_SMIF_CachePrefetchingEnable(SMIF_Type *base, cy_en_smif_cache_t cacheType);
 cy_en_smif_status_t Cy_SMIF_CachePrefetchingDisable(SMIF_Type *base, cy_en_smif_cache_t cacheType);
 cy_en_smif_status_t Cy_SMIF_CacheInvalidate(SMIF_Type *base, cy_en_smif_cache_t cacheType);
+cy_en_smif_status_t Cy_SMIF_CacheInvalidateRange(SMIF_Type *base, cy_en_smif_cache_t cacheType,
+                                uint32_t address, uint32_t size);
+void Cy_SMIF_CacheStatsInit(cy_stc_smif_cache_stats_t *stats);
+#if defined(CY_IP_MXPROFILE)
+cy_en_smif_status_t Cy_SMIF_CacheStatsStart(en_ep_mon_sel_t monitor);
+void Cy_SMIF_CacheStatsUpdate(void);
+void Cy_SMIF_CacheStatsStop(void);
+#endif /* CY_IP_MXPROFILE */
+#if defined(CY_IP_M4CPUSS_DMA)
+cy_en_smif_status_t Cy_SMIF_DmaInit(cy_stc_smif_dma_t *dma);
+cy_en_smif_status_t Cy_SMIF_ReceiveDataDma(SMIF_Type *base,
+                                uint8_t *rxBuffer, uint32_t size,
+                                cy_en_smif_txfr_width_t transferWidth,
+                                cy_smif_event_cb_t RxCompleteCb,
+                                cy_stc_smif_dma_t *dma,
+                                cy_stc_smif_context_t *context);
+cy_en_smif_status_t Cy_SMIF_TransmitDataDma(SMIF_Type *base,
+                                uint8_t const *txBuffer, uint32_t size,
+                                cy_en_smif_txfr_width_t transferWidth,
+                                cy_smif_event_cb_t TxCompleteCb,
+                                cy_stc_smif_dma_t *dma,
+                                cy_stc_smif_context_t *context);
+void Cy_SMIF_DmaInterrupt(SMIF_Type *base, cy_stc_smif_dma_t const *dma,
+                                cy_stc_smif_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
 
 /** \addtogroup group_smif_functions_syspm_callback
 * The driver supports SysPm callback for Deep Sleep and Hibernate transition.
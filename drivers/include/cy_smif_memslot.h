@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_smif_memslot.h
-* \version 1.50.1
+* \version 1.60
 *
 * \brief
 *  This file provides the constants and parameter values for the memory-level
@@ -90,6 +90,10 @@ extern "C" {
  * be initialized in System init */
 #define CY_SMIF_FLAG_MEMORY_MAPPED      (2U)
 #define CY_SMIF_FLAG_DETECT_SFDP        (4U) /**< Enables the Autodetect using the SFDP */
+/** Enables the continuous read mode for the memory-mapped device. The XIP reads
+ * are sent without the command. Valid when the memory-mapped mode is enabled and
+ * the continuousReadMode of \ref cy_stc_smif_mem_device_cfg_t is not zero */
+#define CY_SMIF_FLAG_CONTINUOUS_READ    (8U)
 /** Enables the crypto support for this memory slave. All access to the
 * memory device goes through the encryption/decryption
 * Valid when the memory-mapped mode is enabled */
@@ -164,6 +168,11 @@ extern "C" {
             
 #define CY_SMIF_SFDP_PROG_TIME_8US                  (8U)                    /**< Units of Page Program Typical Time in us */
 #define CY_SMIF_SFDP_PROG_TIME_64US                 (64U)                   /**< Units of Page Program Typical Time in us */
+
+#define CY_SMIF_SFDP_SUSPEND_TIME_1US               (1U)                    /**< Units of Erase Suspend Max Latency in us (128 ns rounded up) */
+#define CY_SMIF_SFDP_SUSPEND_TIME_8US               (8U)                    /**< Units of Erase Suspend Max Latency in us */
+#define CY_SMIF_SFDP_SUSPEND_TIME_64US              (64U)                   /**< Units of Erase Suspend Max Latency in us */
+#define CY_SMIF_SFDP_RESUME_INTERVAL_64US           (64U)                   /**< Units of Erase Resume to Suspend Interval in us */
             
 #define CY_SMIF_SFDP_UNIT_0                         (0U)                    /**< Units of Basic Flash Parameter Table Time Parameters */
 #define CY_SMIF_SFDP_UNIT_1                         (1U)                    /**< Units of Basic Flash Parameter Table Time Parameters */
@@ -206,6 +215,9 @@ extern "C" {
 
 #define CY_SMIF_JEDEC_BFPT_10TH_DWORD               (9U)                    /**< Offset to JEDEC Basic Flash Parameter Table: 10th DWORD  */
 #define CY_SMIF_JEDEC_BFPT_11TH_DWORD               (10U)                   /**< Offset to JEDEC Basic Flash Parameter Table: 11th DWORD  */
+#define CY_SMIF_JEDEC_BFPT_12TH_DWORD               (11U)                   /**< Offset to JEDEC Basic Flash Parameter Table: 12th DWORD  */
+#define CY_SMIF_JEDEC_BFPT_13TH_DWORD               (12U)                   /**< Offset to JEDEC Basic Flash Parameter Table: 13th DWORD  */
+#define CY_SMIF_JEDEC_BFPT_15TH_DWORD               (14U)                   /**< Offset to JEDEC Basic Flash Parameter Table: 15th DWORD  */
 
 
 #define CY_SMIF_SFDP_SECTOR_MAP_CMD_OFFSET          (1UL)    /**< The offset for the detection command instruction in the Sector Map command descriptor */
@@ -277,9 +289,33 @@ extern "C" {
 #define CY_SMIF_SFDP_PROG_MUL_COUNT_Pos             (0UL)                   /**< Multiplier from typical time to max time for Page or byte program (Bits 3:0)          */
 #define CY_SMIF_SFDP_PROG_MUL_COUNT_Msk             (0x0FUL)                /**< Multiplier from typical time to max time for Page or byte program (Bitfield-Mask)       */
 
+/* ----------------------------  12th DWORD  --------------------------- */
+#define CY_SMIF_SFDP_ERASE_RESUME_COUNT_Pos         (20UL)                  /**< Erase resume to suspend interval: count (Bits 23:20)          */
+#define CY_SMIF_SFDP_ERASE_RESUME_COUNT_Msk         (0x00F00000UL)          /**< Erase resume to suspend interval: count (Bitfield-Mask)       */
+#define CY_SMIF_SFDP_ERASE_SUSPEND_COUNT_Pos        (24UL)                  /**< Suspend in-progress erase max latency: count (Bits 28:24)     */
+#define CY_SMIF_SFDP_ERASE_SUSPEND_COUNT_Msk        (0x1F000000UL)          /**< Suspend in-progress erase max latency: count (Bitfield-Mask)  */
+#define CY_SMIF_SFDP_ERASE_SUSPEND_UNITS_Pos        (29UL)                  /**< Suspend in-progress erase max latency: units (Bits 30:29)     */
+#define CY_SMIF_SFDP_ERASE_SUSPEND_UNITS_Msk        (0x60000000UL)          /**< Suspend in-progress erase max latency: units (Bitfield-Mask)  */
+#define CY_SMIF_SFDP_SUSPEND_NOT_SUPPORTED_Msk      (0x80000000UL)          /**< Suspend and Resume are not supported (Bit 31)                 */
+
+/* ----------------------------  13th DWORD  --------------------------- */
+#define CY_SMIF_SFDP_ERASE_RESUME_CMD_Pos           (16UL)                  /**< The Erase Resume instruction (Bits 23:16)                     */
+#define CY_SMIF_SFDP_ERASE_RESUME_CMD_Msk           (0x00FF0000UL)          /**< The Erase Resume instruction (Bitfield-Mask: 0xFF)            */
+#define CY_SMIF_SFDP_ERASE_SUSPEND_CMD_Pos          (24UL)                  /**< The Erase Suspend instruction (Bits 31:24)                    */
+#define CY_SMIF_SFDP_ERASE_SUSPEND_CMD_Msk          (0xFF000000UL)          /**< The Erase Suspend instruction (Bitfield-Mask: 0xFF)           */
+
 /* ----------------------------  15th DWORD  --------------------------- */
 #define CY_SMIF_SFDP_QE_REQUIREMENTS_Pos            (4UL)                   /**< The SFDP quad enable requirements field (Bit 4)               */
 #define CY_SMIF_SFDP_QE_REQUIREMENTS_Msk            (0x70UL)                /**< The SFDP quad enable requirements field (Bitfield-Mask: 0x07) */
+#define CY_SMIF_SFDP_0_4_4_SUPPORTED_Msk            (0x00000200UL)          /**< The 0-4-4 (continuous read) mode is supported (Bit 9)         */
+#define CY_SMIF_SFDP_0_4_4_EXIT_Pos                 (10UL)                  /**< The 0-4-4 mode exit method (Bits 15:10)                       */
+#define CY_SMIF_SFDP_0_4_4_EXIT_Msk                 (0x0000FC00UL)          /**< The 0-4-4 mode exit method (Bitfield-Mask: 0x3F)              */
+#define CY_SMIF_SFDP_0_4_4_ENTRY_Pos                (16UL)                  /**< The 0-4-4 mode entry method (Bits 19:16)                      */
+#define CY_SMIF_SFDP_0_4_4_ENTRY_Msk                (0x000F0000UL)          /**< The 0-4-4 mode entry method (Bitfield-Mask: 0x0F)             */
+#define CY_SMIF_SFDP_0_4_4_ENTRY_MODE_A5            (0x01UL)                /**< The 0-4-4 mode is entered with the mode bits A5h              */
+#define CY_SMIF_SFDP_0_4_4_ENTRY_MODE_AX            (0x04UL)                /**< The 0-4-4 mode is entered with the mode bits Axh              */
+#define CY_SMIF_SFDP_0_4_4_EXIT_FH_ADDR_CLOCKS      (0x02UL)                /**< Fh on DQ0-DQ3 for 8 (3-byte) or 10 (4-byte address) clocks */
+#define CY_SMIF_SFDP_0_4_4_EXIT_FH_8_CLOCKS         (0x08UL)                /**< Fh on DQ0-DQ3 for 8 clocks (mode bit reset)                   */
 
 
 /* ----------------------------  16th DWORD  --------------------------- */
@@ -356,8 +392,33 @@ typedef struct
     uint32_t eraseCmd;                      /**< This specifies the region specific erase instruction*/
     uint32_t eraseSize;                     /**< This specifies the size of one sector */
     uint32_t eraseTime;                     /**< Max time for sector erase type 1 cycle time in ms*/
+    uint32_t eraseTypeMask;                 /**< The erase types supported in the region: bit 0 - erase type 1,
+                                            * bit 3 - erase type 4. Used by \ref Cy_SMIF_MemGetEraseStep together
+                                            * with \ref cy_stc_smif_mem_device_cfg_t::eraseTypes.
+                                            * Zero - only eraseCmd is used */
 } cy_stc_smif_hybrid_region_info_t;
 
+/** The number of the erase types defined by SFDP */
+#define CY_SMIF_MEM_ERASE_TYPE_COUNT    (4U)
+
+/** This structure specifies one erase type of the memory device */
+typedef struct
+{
+    uint32_t eraseCmd;                      /**< The 8-bit erase instruction */
+    uint32_t eraseSize;                     /**< The number of bytes erased by the instruction. Zero - the erase
+                                            * type is not supported */
+    uint32_t eraseTime;                     /**< Max time for the erase cycle time in ms */
+} cy_stc_smif_mem_erase_type_t;
+
+/** This structure specifies one erase of the plan built by \ref Cy_SMIF_MemGetEraseStep */
+typedef struct
+{
+    uint32_t address;                       /**< The start address of the erase */
+    uint32_t eraseCmd;                      /**< The 8-bit erase instruction */
+    uint32_t eraseSize;                     /**< The number of bytes erased */
+    uint32_t eraseTime;                     /**< Max time for the erase cycle time in ms */
+} cy_stc_smif_mem_erase_step_t;
+
 
 /**
 *
@@ -395,6 +456,17 @@ typedef struct
     uint32_t programTime;                                 /**< Max time for page program cycle time in us */
     uint32_t hybridRegionCount;                           /**< This specifies the number of regions for memory with hybrid sectors */
     cy_stc_smif_hybrid_region_info_t** hybridRegionInfo;  /**< This specifies data for memory with hybrid sectors */
+    uint32_t eraseSuspendCmd;                             /**< The 8-bit Erase Suspend instruction. This value is 0 when
+                                                          * the memory does not support the erase suspend */
+    uint32_t eraseResumeCmd;                              /**< The 8-bit Erase Resume instruction */
+    uint32_t eraseSuspendTime;                            /**< Max time to suspend an in-progress erase in us */
+    uint32_t eraseResumeTime;                             /**< Min time from the erase resume to the next erase suspend in us */
+    cy_stc_smif_mem_erase_type_t* eraseTypes;             /**< The array of \ref CY_SMIF_MEM_ERASE_TYPE_COUNT erase types,
+                                                          * index 0 - erase type 1. Populated by \ref Cy_SMIF_MemSfdpDetect.
+                                                          * NULL - only the Erase command is used */
+    uint32_t continuousReadMode;                          /**< The 8-bit mode byte of the Read command that keeps the memory
+                                                          * in the continuous read mode, see \ref CY_SMIF_FLAG_CONTINUOUS_READ.
+                                                          * This value is 0 when the memory does not support the continuous read */
 } cy_stc_smif_mem_device_cfg_t;
 
  
@@ -449,6 +521,59 @@ typedef struct
 } cy_stc_smif_block_config_t;
 
 
+/** The asynchronous memory operation, see \ref Cy_SMIF_MemAsyncInit */
+typedef enum
+{
+    CY_SMIF_MEM_ASYNC_READ  = 0U,   /**< \ref Cy_SMIF_MemAsyncRead */
+    CY_SMIF_MEM_ASYNC_WRITE = 1U,   /**< \ref Cy_SMIF_MemAsyncWrite */
+    CY_SMIF_MEM_ASYNC_ERASE = 2U    /**< \ref Cy_SMIF_MemAsyncEraseSector */
+} cy_en_smif_mem_async_op_t;
+
+/***************************************************************************//**
+*
+* The SMIF asynchronous memory operation completion callback.
+*
+* \param operation
+* The completed operation \ref cy_en_smif_mem_async_op_t.
+*
+* \param status
+* The status of the operation. See \ref cy_en_smif_status_t.
+*
+*******************************************************************************/
+typedef void (*cy_smif_mem_async_cb_t)(cy_en_smif_mem_async_op_t operation, cy_en_smif_status_t status);
+
+/**
+* The context of the asynchronous memory operations. The structure is
+* initialized by \ref Cy_SMIF_MemAsyncInit. The user must not modify it.
+*/
+typedef struct
+{
+    /** \cond INTERNAL */
+    SMIF_Type *base;                                /**< The SMIF block */
+    cy_stc_smif_mem_config_t const *memConfig;      /**< The memory device configuration */
+    cy_stc_smif_context_t *context;                 /**< The SMIF driver context */
+    cy_smif_mem_async_cb_t callback;                /**< The completion callback */
+    uint32_t pollPeriodUs;                          /**< The period of the Cy_SMIF_MemAsyncProcess() calls */
+    cy_en_smif_mem_async_op_t operation;            /**< The write or erase operation in progress */
+    uint32_t volatile state;                        /**< The write or erase operation state */
+    uint32_t pollCount;                             /**< The number of the status polls before the timeout */
+    uint32_t stepPolls;                             /**< The number of the status polls for one page or sector */
+    uint32_t erasePolls;                            /**< The remaining erase polls saved while the erase is suspended */
+    uint32_t resumePolls;                           /**< The number of the status polls before the erase can be suspended again */
+    uint32_t address;                               /**< The address of the next page or sector */
+    uint32_t length;                                /**< The remaining length of the write or erase */
+    uint8_t const *txBuffer;                        /**< The remaining data to write */
+    uint32_t volatile readState;                    /**< The read operation state */
+    uint32_t readAddress;                           /**< The address of the next read chunk */
+    uint32_t readLength;                            /**< The remaining length of the read */
+    uint8_t *rxBuffer;                              /**< The buffer for the next read chunk */
+#if defined(CY_IP_M4CPUSS_DMA)
+    cy_stc_smif_dma_t *dma;                         /**< The DMA used for the aligned data, NULL - no DMA */
+#endif /* CY_IP_M4CPUSS_DMA */
+    /** \endcond */
+} cy_stc_smif_mem_async_t;
+
+
 /** \} group_smif_data_structures_memslot */
 
 
@@ -460,6 +585,10 @@ cy_en_smif_status_t    Cy_SMIF_MemInit(SMIF_Type *base,
                                 cy_stc_smif_block_config_t const * blockConfig,
                                 cy_stc_smif_context_t *context);
 void        Cy_SMIF_MemDeInit(SMIF_Type *base);
+cy_en_smif_status_t Cy_SMIF_MemEnterContinuousRead(SMIF_Type *base, cy_stc_smif_mem_config_t const *memConfig,
+                                    cy_stc_smif_context_t const *context);
+cy_en_smif_status_t Cy_SMIF_MemExitContinuousRead(SMIF_Type *base, cy_stc_smif_mem_config_t const *memConfig,
+                                    cy_stc_smif_context_t const *context);
 cy_en_smif_status_t    Cy_SMIF_MemCmdWriteEnable( SMIF_Type *base,
                                         cy_stc_smif_mem_config_t const *memDevice,
                                         cy_stc_smif_context_t const *context);
@@ -525,6 +654,28 @@ cy_en_smif_status_t Cy_SMIF_MemEraseChip(SMIF_Type *base, cy_stc_smif_mem_config
                                          cy_stc_smif_context_t const *context);
 cy_en_smif_status_t Cy_SMIF_MemLocateHybridRegion(cy_stc_smif_mem_config_t const *memDevice,
                                                cy_stc_smif_hybrid_region_info_t** regionInfo, uint32_t address);
+cy_en_smif_status_t Cy_SMIF_MemGetEraseStep(cy_stc_smif_mem_config_t const *memConfig,
+                                            uint32_t address, uint32_t length,
+                                            cy_stc_smif_mem_erase_step_t *step);
+cy_en_smif_status_t Cy_SMIF_MemGetErasePlan(cy_stc_smif_mem_config_t const *memConfig,
+                                            uint32_t address, uint32_t length,
+                                            cy_stc_smif_mem_erase_step_t steps[], uint32_t maxSteps,
+                                            uint32_t *stepCount);
+cy_en_smif_status_t Cy_SMIF_MemAsyncInit(cy_stc_smif_mem_async_t *async, SMIF_Type *base,
+                                         cy_stc_smif_mem_config_t const *memConfig,
+                                         uint32_t pollPeriodUs, cy_smif_mem_async_cb_t callback,
+                                         cy_stc_smif_context_t *context);
+cy_en_smif_status_t Cy_SMIF_MemAsyncRead(cy_stc_smif_mem_async_t *async, uint32_t address,
+                                         uint8_t rxBuffer[], uint32_t length);
+cy_en_smif_status_t Cy_SMIF_MemAsyncWrite(cy_stc_smif_mem_async_t *async, uint32_t address,
+                                          uint8_t const txBuffer[], uint32_t length);
+cy_en_smif_status_t Cy_SMIF_MemAsyncEraseSector(cy_stc_smif_mem_async_t *async,
+                                                uint32_t address, uint32_t length);
+void Cy_SMIF_MemAsyncProcess(cy_stc_smif_mem_async_t *async);
+bool Cy_SMIF_MemAsyncIsBusy(cy_stc_smif_mem_async_t const *async);
+#if defined(CY_IP_M4CPUSS_DMA)
+cy_en_smif_status_t Cy_SMIF_MemAsyncSetDma(cy_stc_smif_mem_async_t *async, cy_stc_smif_dma_t *dma);
+#endif /* CY_IP_M4CPUSS_DMA */
 /** \} group_smif_mem_slot_functions */
 
 
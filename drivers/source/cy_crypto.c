@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  Provides API implementation of the Cypress PDL Crypto driver.
@@ -46,6 +46,7 @@ static void Cy_Crypto_Client_ReleaseIntrHndlr(void);
 static bool Cy_Crypto_IsServerStarted(cy_stc_crypto_context_t const *context);
 static bool Cy_Crypto_IsServerReady(cy_stc_crypto_context_t const *context);
 static cy_en_crypto_status_t Cy_Crypto_Client_Send(void);
+static cy_en_crypto_status_t Cy_Crypto_Client_Enqueue(cy_stc_crypto_request_t *request);
 
 /*******************************************************************************
 * Function Name: Cy_Crypto_Client_ReleaseIntrHndlr
@@ -70,9 +71,21 @@ static void Cy_Crypto_Client_ReleaseIntrHndlr(void)
         Cy_IPC_Drv_ClearInterrupt(Cy_IPC_Drv_GetIntrBaseAddr(clientContext->releaseNotifierChannel),
                                                         interruptMasked, CY_IPC_NO_NOTIFICATION);
 
-        if (clientContext->userCompleteCallback != NULL)
+        /* Retire the completed queued requests */
+        if (clientContext->queue != NULL)
         {
-            (clientContext->userCompleteCallback)();
+            (void)Cy_Crypto_Queue_Process();
+        }
+
+        /* The queue completions are reported by the request callbacks only */
+        if (clientContext->isPending && Cy_Crypto_IsServerReady(clientContext))
+        {
+            clientContext->isPending = false;
+
+            if (clientContext->userCompleteCallback != NULL)
+            {
+                (clientContext->userCompleteCallback)();
+            }
         }
     }
 }
@@ -176,17 +189,29 @@ cy_en_crypto_status_t Cy_Crypto_Sync(bool isBlocking)
 static cy_en_crypto_status_t Cy_Crypto_Client_Send(void)
 {
     cy_en_crypto_status_t status = CY_CRYPTO_SERVER_NOT_STARTED;
+    cy_stc_crypto_request_t *request = clientContext->request;
+
+    /* The request is armed for one call only, also when the call fails */
+    clientContext->request = NULL;
 
     if (Cy_Crypto_IsServerStarted(clientContext))
     {
         status = CY_CRYPTO_SERVER_BUSY;
 
-        if (Cy_Crypto_IsServerReady(clientContext))
+        if (NULL != request)
+        {
+            status = Cy_Crypto_Client_Enqueue(request);
+        }
+        else if (Cy_Crypto_IsServerReady(clientContext))
         {
             status = CY_CRYPTO_SUCCESS;
 
+            /* Set before sending, as the Release interrupt may come right after */
+            clientContext->isPending = true;
+
             if (CY_IPC_DRV_SUCCESS != Cy_IPC_Drv_SendMsgPtr(Cy_IPC_Drv_GetIpcBaseAddress(clientContext->ipcChannel), (1uL << clientContext->acquireNotifierChannel), clientContext))
             {
+                clientContext->isPending = false;
                 status = CY_CRYPTO_COMM_FAIL;
             }
         }
@@ -195,6 +220,51 @@ static cy_en_crypto_status_t Cy_Crypto_Client_Send(void)
     return (status);
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Client_Enqueue
+****************************************************************************//**
+*
+* This function places the operation prepared in the client context into the
+* request armed by \ref Cy_Crypto_Queue_Prepare, submits the request to the
+* request queue and notifies the Crypto Server. The IPC channel is not locked,
+* so several requests can be in flight.
+*
+* This function is internal and should not to be called directly by user software.
+*
+* \param request
+* The request armed by \ref Cy_Crypto_Queue_Prepare.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+static cy_en_crypto_status_t Cy_Crypto_Client_Enqueue(cy_stc_crypto_request_t *request)
+{
+    cy_stc_crypto_queue_t *queue = clientContext->queue;
+    cy_en_crypto_status_t status = CY_CRYPTO_SERVER_BUSY;
+
+    if ((queue->head - queue->tail) < queue->size)
+    {
+        request->instr = clientContext->instr;
+        request->xdata = clientContext->xdata;
+        request->resp  = CY_CRYPTO_SERVER_BUSY;
+        request->isComplete = false;
+
+        queue->requests[queue->head & (queue->size - 1u)] = request;
+
+        /* The request must be visible to the server before the new head index */
+        __DMB();
+        queue->head++;
+
+        Cy_IPC_Drv_AcquireNotify(Cy_IPC_Drv_GetIpcBaseAddress(clientContext->ipcChannel),
+                                 (1uL << clientContext->acquireNotifierChannel));
+
+        status = CY_CRYPTO_SUCCESS;
+    }
+
+    return (status);
+}
+
 cy_en_crypto_status_t Cy_Crypto_GetErrorStatus(cy_stc_crypto_hw_error_t *hwErrorCause)
 {
     if(NULL != hwErrorCause)
@@ -219,6 +289,9 @@ cy_en_crypto_status_t Cy_Crypto_Init(cy_stc_crypto_config_t const *config,
     context->releaseNotifierChannel = config->releaseNotifierChannel;
     context->userCompleteCallback   = config->userCompleteCallback;
     context->releaseNotifierConfig.intrSrc = config->releaseNotifierConfig.intrSrc;
+    context->queue   = NULL;
+    context->request = NULL;
+    context->isPending = false;
 
     /* Release the Crypto IPC channel with the Release interrupt */
     (void)Cy_IPC_Drv_LockRelease(Cy_IPC_Drv_GetIpcBaseAddress(context->ipcChannel), CY_IPC_NO_NOTIFICATION);
@@ -256,6 +329,8 @@ cy_en_crypto_status_t Cy_Crypto_DeInit(void)
     if (clientContext != NULL)
     {
         clientContext->instr = CY_CRYPTO_INSTR_UNKNOWN;
+        clientContext->queue   = NULL;
+        clientContext->request = NULL;
 
         /* If the release interrupt was enabled, disable it here */
         if (NULL != clientContext->userCompleteCallback)
@@ -284,6 +359,10 @@ cy_en_crypto_status_t Cy_Crypto_Enable(void)
 
     if (clientContext != NULL)
     {
+        /* Enabling and disabling the hardware are never queued */
+        CY_ASSERT_L1(NULL == clientContext->request);
+        clientContext->request = NULL;
+
         clientContext->instr = CY_CRYPTO_INSTR_ENABLE;
         clientContext->xdata = NULL;
 
@@ -298,6 +377,97 @@ cy_en_crypto_status_t Cy_Crypto_Enable(void)
     return (err);
 }
 
+cy_en_crypto_status_t Cy_Crypto_Queue_Init(cy_stc_crypto_queue_t *queue,
+                                           cy_stc_crypto_request_t **requests,
+                                           uint32_t size)
+{
+    cy_en_crypto_status_t err = CY_CRYPTO_NOT_INITIALIZED;
+
+    CY_ASSERT_L1(NULL != queue);
+    CY_ASSERT_L1(NULL != requests);
+    CY_ASSERT_L1((0u != size) && (0u == (size & (size - 1u))));
+
+    if (clientContext != NULL)
+    {
+        queue->requests = requests;
+        queue->size     = size;
+        queue->releaseNotifierChannel = clientContext->releaseNotifierChannel;
+        queue->head     = 0u;
+        queue->done     = 0u;
+        queue->tail     = 0u;
+
+        clientContext->instr   = CY_CRYPTO_INSTR_QUEUE_INIT;
+        clientContext->xdata   = (void *)queue;
+        clientContext->request = NULL;
+
+        err = Cy_Crypto_Client_Send();
+
+        /* Wait until the server registers the queue */
+        if (CY_CRYPTO_SUCCESS == err)
+        {
+            err = Cy_Crypto_Sync(CY_CRYPTO_SYNC_BLOCKING);
+        }
+
+        if (CY_CRYPTO_SUCCESS == err)
+        {
+            clientContext->queue = queue;
+        }
+    }
+    return (err);
+}
+
+cy_en_crypto_status_t Cy_Crypto_Queue_Prepare(cy_stc_crypto_request_t *request,
+                                              cy_crypto_request_callback_t callback)
+{
+    cy_en_crypto_status_t err = CY_CRYPTO_NOT_INITIALIZED;
+
+    CY_ASSERT_L1(NULL != request);
+
+    if ((clientContext != NULL) && (clientContext->queue != NULL))
+    {
+        request->callback   = callback;
+        request->isComplete = false;
+
+        clientContext->request = request;
+
+        err = CY_CRYPTO_SUCCESS;
+    }
+    return (err);
+}
+
+uint32_t Cy_Crypto_Queue_Process(void)
+{
+    cy_stc_crypto_queue_t *queue;
+    cy_stc_crypto_request_t *request;
+    uint32_t done;
+    uint32_t inFlight = 0u;
+
+    if ((clientContext != NULL) && (clientContext->queue != NULL))
+    {
+        queue = clientContext->queue;
+        done  = queue->done;
+
+        /* Read the requests only after the done index */
+        __DMB();
+
+        while (queue->tail != done)
+        {
+            request = queue->requests[queue->tail & (queue->size - 1u)];
+
+            /* Free the slot before the callback so it can submit a new request */
+            queue->tail++;
+
+            if (NULL != request->callback)
+            {
+                (request->callback)(request);
+            }
+        }
+
+        inFlight = queue->head - queue->tail;
+    }
+    return (inFlight);
+}
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_GetLibraryInfo
 ****************************************************************************//**
@@ -331,6 +501,10 @@ cy_en_crypto_status_t Cy_Crypto_Disable(void)
 
     if (clientContext != NULL)
     {
+        /* Enabling and disabling the hardware are never queued */
+        CY_ASSERT_L1(NULL == clientContext->request);
+        clientContext->request = NULL;
+
         clientContext->instr = CY_CRYPTO_INSTR_DISABLE;
         clientContext->xdata = NULL;
 
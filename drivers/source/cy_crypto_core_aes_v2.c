@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_aes_v2.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides the source code fro the API for the AES method
@@ -547,6 +547,611 @@ cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Ctr(CRYPTO_Type *base,
     return (CY_CRYPTO_SUCCESS);
 }
 
+/* The reduction table for the 4-bit GHASH multiplication (NIST SP 800-38D) */
+static const uint64_t cy_crypto_gcmLast4[16u] =
+{
+    0x0000u, 0x1c20u, 0x3840u, 0x2460u, 0x7080u, 0x6ca0u, 0x48c0u, 0x54e0u,
+    0xe100u, 0xfd20u, 0xd940u, 0xc560u, 0x9180u, 0x8da0u, 0xa9c0u, 0xb5e0u
+};
+
+static uint64_t Cy_Crypto_Core_V2_Aes_Gcm_GetU64(uint8_t const *data);
+static void Cy_Crypto_Core_V2_Aes_Gcm_PutU64(uint8_t *data, uint64_t value);
+static void Cy_Crypto_Core_V2_Aes_Gcm_MakeTable(cy_stc_crypto_aes_gcm_state_t *gcmState, uint8_t const *h);
+static void Cy_Crypto_Core_V2_Aes_Gcm_Ghash(cy_stc_crypto_aes_gcm_state_t *gcmState, uint8_t const *block);
+static void Cy_Crypto_Core_V2_Aes_Gcm_GhashData(cy_stc_crypto_aes_gcm_state_t *gcmState,
+                                                uint8_t const *data, uint32_t size);
+static void Cy_Crypto_Core_V2_Aes_Gcm_IncCounter(uint8_t *counter);
+static void Cy_Crypto_Core_V2_Aes_Gcm_Blocks(CRYPTO_Type *base, uint8_t *dst, uint8_t const *src,
+                                             uint32_t blockCount, cy_stc_crypto_aes_gcm_state_t *gcmState);
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_GetU64
+****************************************************************************//**
+*
+* Reads the big-endian 64-bit value from the byte array.
+*
+*******************************************************************************/
+static uint64_t Cy_Crypto_Core_V2_Aes_Gcm_GetU64(uint8_t const *data)
+{
+    uint64_t value = 0u;
+    uint32_t i;
+
+    for (i = 0u; i < 8u; i++)
+    {
+        value = (value << 8u) | (uint64_t)data[i];
+    }
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_PutU64
+****************************************************************************//**
+*
+* Writes the 64-bit value to the byte array in big-endian order.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Aes_Gcm_PutU64(uint8_t *data, uint64_t value)
+{
+    uint32_t i;
+
+    for (i = 0u; i < 8u; i++)
+    {
+        data[i] = (uint8_t)((value >> (56u - (i * 8u))) & 0xffu);
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_MakeTable
+****************************************************************************//**
+*
+* Precalculates the multiples of the hash subkey H used by the 4-bit GHASH
+* multiplication.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Aes_Gcm_MakeTable(cy_stc_crypto_aes_gcm_state_t *gcmState, uint8_t const *h)
+{
+    uint64_t vh = Cy_Crypto_Core_V2_Aes_Gcm_GetU64(h);
+    uint64_t vl = Cy_Crypto_Core_V2_Aes_Gcm_GetU64(h + 8u);
+    uint64_t rem;
+    uint32_t i;
+    uint32_t j;
+
+    gcmState->hTableH[0u] = 0u;
+    gcmState->hTableL[0u] = 0u;
+    gcmState->hTableH[8u] = vh;
+    gcmState->hTableL[8u] = vl;
+
+    for (i = 4u; i > 0u; i >>= 1u)
+    {
+        rem = (vl & 1u) * 0xe1000000uL;
+        vl  = (vh << 63u) | (vl >> 1u);
+        vh  = (vh >> 1u) ^ (rem << 32u);
+
+        gcmState->hTableH[i] = vh;
+        gcmState->hTableL[i] = vl;
+    }
+
+    for (i = 2u; i <= 8u; i <<= 1u)
+    {
+        vh = gcmState->hTableH[i];
+        vl = gcmState->hTableL[i];
+
+        for (j = 1u; j < i; j++)
+        {
+            gcmState->hTableH[i + j] = vh ^ gcmState->hTableH[j];
+            gcmState->hTableL[i + j] = vl ^ gcmState->hTableL[j];
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_Ghash
+****************************************************************************//**
+*
+* Adds one 16-byte block to the GHASH value: Y = (Y xor X) * H.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Aes_Gcm_Ghash(cy_stc_crypto_aes_gcm_state_t *gcmState, uint8_t const *block)
+{
+    uint8_t  x[CY_CRYPTO_AES_BLOCK_SIZE];
+    uint64_t zh;
+    uint64_t zl;
+    uint32_t rem;
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t i;
+
+    for (i = 0u; i < CY_CRYPTO_AES_BLOCK_SIZE; i++)
+    {
+        x[i] = gcmState->ghash[i] ^ block[i];
+    }
+
+    lo = (uint32_t)x[CY_CRYPTO_AES_BLOCK_SIZE - 1u] & 0x0fu;
+    zh = gcmState->hTableH[lo];
+    zl = gcmState->hTableL[lo];
+
+    for (i = CY_CRYPTO_AES_BLOCK_SIZE; i > 0u; i--)
+    {
+        lo = (uint32_t)x[i - 1u] & 0x0fu;
+        hi = ((uint32_t)x[i - 1u] >> 4u) & 0x0fu;
+
+        if (i != CY_CRYPTO_AES_BLOCK_SIZE)
+        {
+            rem = (uint32_t)(zl & 0x0fu);
+            zl  = (zh << 60u) | (zl >> 4u);
+            zh  = (zh >> 4u) ^ (cy_crypto_gcmLast4[rem] << 48u);
+            zh ^= gcmState->hTableH[lo];
+            zl ^= gcmState->hTableL[lo];
+        }
+
+        rem = (uint32_t)(zl & 0x0fu);
+        zl  = (zh << 60u) | (zl >> 4u);
+        zh  = (zh >> 4u) ^ (cy_crypto_gcmLast4[rem] << 48u);
+        zh ^= gcmState->hTableH[hi];
+        zl ^= gcmState->hTableL[hi];
+    }
+
+    Cy_Crypto_Core_V2_Aes_Gcm_PutU64(gcmState->ghash, zh);
+    Cy_Crypto_Core_V2_Aes_Gcm_PutU64(gcmState->ghash + 8u, zl);
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_GhashData
+****************************************************************************//**
+*
+* Adds the data of an arbitrary size to the GHASH value. Bytes of the last
+* non-complete block are kept in the pending buffer until the block is complete.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Aes_Gcm_GhashData(cy_stc_crypto_aes_gcm_state_t *gcmState,
+                                                uint8_t const *data, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0u; i < size; i++)
+    {
+        gcmState->pending[gcmState->pendingSize] = data[i];
+        gcmState->pendingSize++;
+
+        if (CY_CRYPTO_AES_BLOCK_SIZE == gcmState->pendingSize)
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_Ghash(gcmState, gcmState->pending);
+            gcmState->pendingSize = 0u;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_IncCounter
+****************************************************************************//**
+*
+* Increments the rightmost 32 bits of the counter block (inc32 function).
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Aes_Gcm_IncCounter(uint8_t *counter)
+{
+    uint32_t i = CY_CRYPTO_AES_BLOCK_SIZE;
+
+    do
+    {
+        i--;
+        counter[i]++;
+    } while ((counter[i] == 0u) && (i > (CY_CRYPTO_AES_BLOCK_SIZE - 4u)));
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_Blocks
+****************************************************************************//**
+*
+* Encrypts or decrypts complete blocks and adds the cipher text to GHASH.
+*
+* The counter blocks are streamed to the AES engine through the FIFO_LOAD1, the
+* text through the FIFO_LOAD0 and the result through the FIFO_STORE, so each
+* block costs three instructions. The CPU calculates GHASH while the engine
+* processes the key stream: on decryption over the source block which is about
+* to be queued, on encryption over the blocks stored by the previous step.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Aes_Gcm_Blocks(CRYPTO_Type *base, uint8_t *dst, uint8_t const *src,
+                                             uint32_t blockCount, cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    uint8_t const *ghashPtr = NULL;
+    uint32_t ghashBlocks = 0u;
+    uint32_t blocks = blockCount;
+    uint8_t *ctrPtr;
+    uint32_t chunk;
+    uint32_t size;
+    uint32_t i;
+    uint32_t j;
+
+    Cy_Crypto_Core_V2_Aes_LoadEncKey(base, &gcmState->aesState);
+
+    while (blocks != 0u)
+    {
+        chunk = (blocks < CY_CRYPTO_AES_GCM_CHUNK_BLOCKS) ? blocks : CY_CRYPTO_AES_GCM_CHUNK_BLOCKS;
+        size  = chunk * CY_CRYPTO_AES_BLOCK_SIZE;
+
+        ctrPtr = (uint8_t *)gcmState->ctrBlocks;
+
+        for (i = 0u; i < chunk; i++)
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_IncCounter(gcmState->counter);
+
+            for (j = 0u; j < CY_CRYPTO_AES_BLOCK_SIZE; j++)
+            {
+                *ctrPtr = gcmState->counter[j];
+                ctrPtr++;
+            }
+        }
+
+        Cy_Crypto_Core_V2_FFContinue(base, CY_CRYPTO_V2_RB_FF_LOAD1, (uint8_t const *)gcmState->ctrBlocks, size);
+        Cy_Crypto_Core_V2_FFContinue(base, CY_CRYPTO_V2_RB_FF_LOAD0, src, size);
+        Cy_Crypto_Core_V2_FFStart   (base, CY_CRYPTO_V2_RB_FF_STORE, dst, size);
+
+        for (i = 0u; i < chunk; i++)
+        {
+            if (CY_CRYPTO_DECRYPT == gcmState->dirMode)
+            {
+                /* Hash the cipher text block before its place can be overwritten (in-place operation) */
+                Cy_Crypto_Core_V2_Aes_Gcm_Ghash(gcmState, src + (i * CY_CRYPTO_AES_BLOCK_SIZE));
+            }
+
+            Cy_Crypto_Core_V2_BlockMov(base, CY_CRYPTO_V2_RB_BLOCK0, CY_CRYPTO_V2_RB_FF_LOAD1, CY_CRYPTO_AES_BLOCK_SIZE);
+            Cy_Crypto_Core_V2_RunAes(base);
+            Cy_Crypto_Core_V2_BlockXor(base, CY_CRYPTO_V2_RB_FF_STORE,
+                                             CY_CRYPTO_V2_RB_FF_LOAD0, CY_CRYPTO_V2_RB_BLOCK1, CY_CRYPTO_AES_BLOCK_SIZE);
+
+            if (ghashBlocks != 0u)
+            {
+                /* Hash the cipher text stored by the previous step while the engine is busy */
+                Cy_Crypto_Core_V2_Aes_Gcm_Ghash(gcmState, ghashPtr);
+                ghashPtr += CY_CRYPTO_AES_BLOCK_SIZE;
+                ghashBlocks--;
+            }
+        }
+
+        while (ghashBlocks != 0u)
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_Ghash(gcmState, ghashPtr);
+            ghashPtr += CY_CRYPTO_AES_BLOCK_SIZE;
+            ghashBlocks--;
+        }
+
+        Cy_Crypto_Core_V2_Sync(base);
+
+        if (CY_CRYPTO_ENCRYPT == gcmState->dirMode)
+        {
+            ghashPtr    = dst;
+            ghashBlocks = chunk;
+        }
+
+        src    += size;
+        dst    += size;
+        blocks -= chunk;
+    }
+
+    while (ghashBlocks != 0u)
+    {
+        Cy_Crypto_Core_V2_Aes_Gcm_Ghash(gcmState, ghashPtr);
+        ghashPtr += CY_CRYPTO_AES_BLOCK_SIZE;
+        ghashBlocks--;
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_Init
+****************************************************************************//**
+*
+* Starts the AES-GCM authenticated encryption or decryption: calculates the
+* hash subkey and the pre-counter block and processes the additional
+* authenticated data (AAD).
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param dirMode
+* Can be \ref CY_CRYPTO_ENCRYPT or \ref CY_CRYPTO_DECRYPT
+* (\ref cy_en_crypto_dir_mode_t).
+*
+* \param key
+* The pointer to the encryption/decryption key.
+*
+* \param keyLength
+* \ref cy_en_crypto_aes_key_length_t
+*
+* \param iv
+* The pointer to the initial vector.
+*
+* \param ivSize
+* The size of the initial vector, \ref CY_CRYPTO_AES_GCM_IV_SIZE is
+* recommended.
+*
+* \param aadList
+* The scatter-gather list of the additional authenticated data fragments.
+* Can be NULL when aadCount is zero.
+*
+* \param aadCount
+* The number of entries in aadList.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \param aesBuffers
+* The pointer to the memory buffers storage.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Init(CRYPTO_Type *base,
+                                                 cy_en_crypto_dir_mode_t dirMode,
+                                                 uint8_t const *key,
+                                                 cy_en_crypto_aes_key_length_t keyLength,
+                                                 uint8_t const *iv,
+                                                 uint32_t ivSize,
+                                                 cy_stc_crypto_sg_entry_t const *aadList,
+                                                 uint32_t aadCount,
+                                                 cy_stc_crypto_aes_gcm_state_t *gcmState,
+                                                 cy_stc_crypto_aes_buffers_t *aesBuffers)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+    uint8_t  block[CY_CRYPTO_AES_BLOCK_SIZE];
+    uint32_t i;
+
+    CY_ASSERT_L1(NULL != gcmState);
+    CY_ASSERT_L1(NULL != aesBuffers);
+
+    if ((NULL != key) && (NULL != iv) && (0u != ivSize) && ((NULL != aadList) || (0u == aadCount)))
+    {
+        Cy_Crypto_Core_V2_MemSet(base, (void *)gcmState, 0u, (uint16_t)sizeof(cy_stc_crypto_aes_gcm_state_t));
+
+        tmpResult = Cy_Crypto_Core_V2_Aes_Init(base, key, keyLength, &gcmState->aesState, aesBuffers);
+    }
+
+    if (CY_CRYPTO_SUCCESS == tmpResult)
+    {
+        gcmState->dirMode = dirMode;
+
+        /* The hash subkey H = E(K, 0^128) */
+        Cy_Crypto_Core_V2_MemSet(base, (void *)block, 0u, CY_CRYPTO_AES_BLOCK_SIZE);
+        (void)Cy_Crypto_Core_V2_Aes_Ecb(base, CY_CRYPTO_ENCRYPT, block, block, &gcmState->aesState);
+        Cy_Crypto_Core_V2_Aes_Gcm_MakeTable(gcmState, block);
+
+        /* The pre-counter block J0 */
+        if (CY_CRYPTO_AES_GCM_IV_SIZE == ivSize)
+        {
+            Cy_Crypto_Core_V2_MemCpy(base, (void *)gcmState->counter, (void const *)iv, CY_CRYPTO_AES_GCM_IV_SIZE);
+            gcmState->counter[CY_CRYPTO_AES_BLOCK_SIZE - 1u] = 1u;
+        }
+        else
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_GhashData(gcmState, iv, ivSize);
+
+            Cy_Crypto_Core_V2_MemSet(base, (void *)block, 0u, CY_CRYPTO_AES_BLOCK_SIZE);
+
+            if (0u != gcmState->pendingSize)
+            {
+                Cy_Crypto_Core_V2_Aes_Gcm_GhashData(gcmState, block, CY_CRYPTO_AES_BLOCK_SIZE - gcmState->pendingSize);
+            }
+
+            Cy_Crypto_Core_V2_Aes_Gcm_PutU64(block + 8u, (uint64_t)ivSize * 8u);
+            Cy_Crypto_Core_V2_Aes_Gcm_Ghash(gcmState, block);
+
+            Cy_Crypto_Core_V2_MemCpy(base, (void *)gcmState->counter, (void const *)gcmState->ghash, CY_CRYPTO_AES_BLOCK_SIZE);
+            Cy_Crypto_Core_V2_MemSet(base, (void *)gcmState->ghash, 0u, CY_CRYPTO_AES_BLOCK_SIZE);
+        }
+
+        (void)Cy_Crypto_Core_V2_Aes_Ecb(base, CY_CRYPTO_ENCRYPT, gcmState->ekj0, gcmState->counter, &gcmState->aesState);
+
+        /* The additional authenticated data */
+        for (i = 0u; i < aadCount; i++)
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_GhashData(gcmState, aadList[i].src, aadList[i].size);
+            gcmState->aadSize += aadList[i].size;
+        }
+
+        if (0u != gcmState->pendingSize)
+        {
+            Cy_Crypto_Core_V2_MemSet(base, (void *)block, 0u, CY_CRYPTO_AES_BLOCK_SIZE);
+            Cy_Crypto_Core_V2_Aes_Gcm_GhashData(gcmState, block, CY_CRYPTO_AES_BLOCK_SIZE - gcmState->pendingSize);
+        }
+    }
+
+    return (tmpResult);
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_Update
+****************************************************************************//**
+*
+* Encrypts or decrypts the next part of the message described by the
+* scatter-gather list and adds the cipher text to the authentication tag.
+* The fragments can have any size, the data is processed in one pass without
+* copying to an intermediate buffer.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param sgList
+* The scatter-gather list of the processed message fragments.
+*
+* \param sgCount
+* The number of entries in sgList.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Update(CRYPTO_Type *base,
+                                                 cy_stc_crypto_sg_entry_t const *sgList,
+                                                 uint32_t sgCount,
+                                                 cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+    uint8_t const *src;
+    uint8_t *dst;
+    uint32_t size;
+    uint32_t blocks;
+    uint32_t i;
+    uint8_t  tmpByte;
+
+    CY_ASSERT_L1(NULL != gcmState);
+
+    if ((NULL != sgList) || (0u == sgCount))
+    {
+        tmpResult = CY_CRYPTO_SUCCESS;
+    }
+
+    for (i = 0u; (CY_CRYPTO_SUCCESS == tmpResult) && (i < sgCount); i++)
+    {
+        src  = sgList[i].src;
+        dst  = sgList[i].dst;
+        size = sgList[i].size;
+
+        gcmState->textSize += size;
+
+        /* Complete the previous non-complete block */
+        while ((0u != size) && (0u != gcmState->pendingSize))
+        {
+            tmpByte = *src ^ gcmState->keyStream[gcmState->pendingSize];
+            Cy_Crypto_Core_V2_Aes_Gcm_GhashData(gcmState, (CY_CRYPTO_ENCRYPT == gcmState->dirMode) ? &tmpByte : src, 1u);
+            *dst = tmpByte;
+
+            src++;
+            dst++;
+            size--;
+        }
+
+        blocks = size / CY_CRYPTO_AES_BLOCK_SIZE;
+
+        if (0u != blocks)
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_Blocks(base, dst, src, blocks, gcmState);
+
+            src  += blocks * CY_CRYPTO_AES_BLOCK_SIZE;
+            dst  += blocks * CY_CRYPTO_AES_BLOCK_SIZE;
+            size -= blocks * CY_CRYPTO_AES_BLOCK_SIZE;
+        }
+
+        /* Start the next non-complete block */
+        if (0u != size)
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_IncCounter(gcmState->counter);
+            (void)Cy_Crypto_Core_V2_Aes_Ecb(base, CY_CRYPTO_ENCRYPT, gcmState->keyStream,
+                                            gcmState->counter, &gcmState->aesState);
+
+            while (0u != size)
+            {
+                tmpByte = *src ^ gcmState->keyStream[gcmState->pendingSize];
+                Cy_Crypto_Core_V2_Aes_Gcm_GhashData(gcmState, (CY_CRYPTO_ENCRYPT == gcmState->dirMode) ? &tmpByte : src, 1u);
+                *dst = tmpByte;
+
+                src++;
+                dst++;
+                size--;
+            }
+        }
+    }
+
+    return (tmpResult);
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_Finish
+****************************************************************************//**
+*
+* Completes the AES-GCM operation and calculates the authentication tag.
+* On decryption the caller compares the calculated tag with the received one,
+* for example with \ref Cy_Crypto_Core_MemCmp.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param tag
+* The pointer to the buffer for the authentication tag.
+*
+* \param tagSize
+* The size of the authentication tag, from \ref CY_CRYPTO_AES_GCM_MIN_TAG_SIZE
+* to \ref CY_CRYPTO_AES_GCM_TAG_SIZE bytes.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Finish(CRYPTO_Type *base,
+                                                 uint8_t *tag,
+                                                 uint32_t tagSize,
+                                                 cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+    uint8_t  block[CY_CRYPTO_AES_BLOCK_SIZE];
+    uint32_t i;
+
+    CY_ASSERT_L1(NULL != gcmState);
+
+    if ((NULL != tag) && (tagSize >= CY_CRYPTO_AES_GCM_MIN_TAG_SIZE) && (tagSize <= CY_CRYPTO_AES_GCM_TAG_SIZE))
+    {
+        Cy_Crypto_Core_V2_MemSet(base, (void *)block, 0u, CY_CRYPTO_AES_BLOCK_SIZE);
+
+        if (0u != gcmState->pendingSize)
+        {
+            Cy_Crypto_Core_V2_Aes_Gcm_GhashData(gcmState, block, CY_CRYPTO_AES_BLOCK_SIZE - gcmState->pendingSize);
+        }
+
+        Cy_Crypto_Core_V2_Aes_Gcm_PutU64(block, gcmState->aadSize * 8u);
+        Cy_Crypto_Core_V2_Aes_Gcm_PutU64(block + 8u, gcmState->textSize * 8u);
+        Cy_Crypto_Core_V2_Aes_Gcm_Ghash(gcmState, block);
+
+        for (i = 0u; i < tagSize; i++)
+        {
+            tag[i] = gcmState->ghash[i] ^ gcmState->ekj0[i];
+        }
+
+        tmpResult = CY_CRYPTO_SUCCESS;
+    }
+
+    return (tmpResult);
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Aes_Gcm_Free
+****************************************************************************//**
+*
+* Clears the AES-GCM operation context.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param gcmState
+* The pointer to the AES-GCM state structure allocated by the user. The user
+* must not modify anything in this structure.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Aes_Gcm_Free(CRYPTO_Type *base, cy_stc_crypto_aes_gcm_state_t *gcmState)
+{
+    if (NULL != gcmState->aesState.buffers)
+    {
+        (void)Cy_Crypto_Core_V2_Aes_Free(base, &gcmState->aesState);
+    }
+
+    Cy_Crypto_Core_V2_MemSet(base, (void *)gcmState, 0u, (uint16_t)sizeof(cy_stc_crypto_aes_gcm_state_t));
+
+    return (CY_CRYPTO_SUCCESS);
+}
+
 #endif /* #if (CPUSS_CRYPTO_AES == 1) */
 
 #if defined(__cplusplus)
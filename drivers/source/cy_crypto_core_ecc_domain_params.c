@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_ecc_domain_params.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constant and parameters for the API for the ECC
@@ -32,6 +32,9 @@
 extern "C" {
 #endif
 
+/* Fixed-base comb tables registered per curve */
+static cy_stc_crypto_ecc_comb_table_t *eccCombTables[CY_CRYPTO_ECC_ECP_CURVES_CNT];
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_Core_ECC_GetCurveParams
 ****************************************************************************//**
@@ -468,6 +471,103 @@ cy_stc_crypto_ecc_dp_type *Cy_Crypto_Core_ECC_GetCurveParams(cy_en_crypto_ecc_cu
     return tmpResult;
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_ECC_SetCombTable
+****************************************************************************//**
+*
+* Registers a fixed-base comb table for the base point of the curve.
+* Once registered, \ref Cy_Crypto_Core_ECC_MakePublicKey and
+* \ref Cy_Crypto_Core_ECC_SignHash compute multiples of the base point with
+* the comb method: about bitsize/\ref CY_CRYPTO_ECC_COMB_WIDTH point doublings
+* and additions instead of the bitsize doublings of the binary method, with
+* a scalar independent sequence of operations and table accesses.
+*
+* The points buffer is filled lazily by the first public key calculation on
+* the curve, or eagerly by \ref Cy_Crypto_Core_EC_NistP_MakeCombTable.
+* The table and the points buffer must stay valid while registered.
+*
+* \param curveID
+* See \ref cy_en_crypto_ecc_curve_id_t.
+*
+* \param table
+* The comb table to register, see \ref cy_stc_crypto_ecc_comb_table_t.
+* Pass NULL to unregister the table of the curve.
+*
+* \param points
+* The points buffer, 4-byte aligned.
+*
+* \param pointsSize
+* The size of the points buffer in bytes, at least
+* \ref CY_CRYPTO_ECC_COMB_TABLE_SIZE of the curve size.
+*
+* \return status code. See \ref cy_en_crypto_status_t.
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_ECC_SetCombTable(cy_en_crypto_ecc_curve_id_t curveID,
+        cy_stc_crypto_ecc_comb_table_t *table, uint8_t *points, uint32_t pointsSize)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_NOT_SUPPORTED;
+
+    cy_stc_crypto_ecc_dp_type *eccDp = Cy_Crypto_Core_ECC_GetCurveParams(curveID);
+
+    if (eccDp != NULL)
+    {
+        tmpResult = CY_CRYPTO_BAD_PARAMS;
+
+        if (table == NULL)
+        {
+            eccCombTables[curveID] = NULL;
+
+            tmpResult = CY_CRYPTO_SUCCESS;
+        }
+        else if ((points != NULL) && (pointsSize >= CY_CRYPTO_ECC_COMB_TABLE_SIZE(eccDp->size)))
+        {
+            table->curveID = curveID;
+            table->spacing = CY_CRYPTO_ECC_COMB_SPACING(eccDp->size);
+            table->valid   = false;
+            table->points  = points;
+
+            eccCombTables[curveID] = table;
+
+            tmpResult = CY_CRYPTO_SUCCESS;
+        }
+        else
+        {
+            /* Invalid points buffer */
+        }
+    }
+
+    return (tmpResult);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_ECC_GetCombTable
+****************************************************************************//**
+*
+* Get the fixed-base comb table registered for the curve.
+*
+* \param curveId
+* See \ref cy_en_crypto_ecc_curve_id_t.
+*
+* \return
+* Pointer to the comb table or NULL if no table is registered.
+* See \ref cy_stc_crypto_ecc_comb_table_t.
+*
+*******************************************************************************/
+cy_stc_crypto_ecc_comb_table_t *Cy_Crypto_Core_ECC_GetCombTable(cy_en_crypto_ecc_curve_id_t curveId)
+{
+    cy_stc_crypto_ecc_comb_table_t *tmpResult = NULL;
+
+    if ((curveId > CY_CRYPTO_ECC_ECP_NONE) && (curveId < CY_CRYPTO_ECC_ECP_CURVES_CNT))
+    {
+        tmpResult = eccCombTables[curveId];
+    }
+
+    return tmpResult;
+}
+
 #if defined(__cplusplus)
 }
 #endif
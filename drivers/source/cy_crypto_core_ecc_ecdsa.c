@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_ecc_ecdsa.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constant and parameters for the API for the ECC ECDSA
@@ -36,6 +36,31 @@ extern "C" {
 #include "cy_crypto_core_mem.h"
 #include "cy_crypto_core_vu.h"
 
+/* Vector unit registers of the batch verification */
+#define CY_ECC_BATCH_DIVIDEND       (0u)    /* Cy_Crypto_Core_EC_DivMod dividend */
+#define CY_ECC_BATCH_GX             (1u)
+#define CY_ECC_BATCH_GY             (2u)
+#define CY_ECC_BATCH_QX             (3u)
+#define CY_ECC_BATCH_QY             (4u)
+#define CY_ECC_BATCH_HX             (5u)    /* H = G + Q */
+#define CY_ECC_BATCH_HY             (6u)
+#define CY_ECC_BATCH_SX             (7u)    /* Jacobian accumulator */
+#define CY_ECC_BATCH_SY             (8u)
+#define CY_ECC_BATCH_SZ             (9u)
+#define CY_ECC_BATCH_HASH           (10u)
+#define CY_ECC_BATCH_SHIFT          (11u)
+
+/* Scalar registers share the point registers */
+#define CY_ECC_BATCH_R              (CY_ECC_BATCH_QX)
+#define CY_ECC_BATCH_S              (CY_ECC_BATCH_QY)
+#define CY_ECC_BATCH_U1             (CY_ECC_BATCH_HX)
+#define CY_ECC_BATCH_U2             (CY_ECC_BATCH_HY)
+
+static bool Cy_Crypto_Core_ECC_BatchScalars(CRYPTO_Type *base, const cy_stc_crypto_ecc_dp_type *eccDp,
+                                            const cy_stc_crypto_ecc_verify_t *verify, uint8_t *u1, uint8_t *u2);
+static bool Cy_Crypto_Core_ECC_BatchPoint(CRYPTO_Type *base, const cy_stc_crypto_ecc_dp_type *eccDp,
+                                          const cy_stc_crypto_ecc_verify_t *verify, uint8_t const *u1, uint8_t const *u2);
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_Core_ECC_SignHash
 ****************************************************************************//**
@@ -437,6 +462,339 @@ cy_en_crypto_status_t Cy_Crypto_Core_ECC_VerifyHash(CRYPTO_Type *base,
     return (tmpResult);
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_ECC_BatchScalars
+****************************************************************************//**
+*
+* Checks the signature range and calculates the scalars of the verification:
+* u1 = e/s mod n, u2 = r/s mod n.
+*
+* \param base
+* The pointer to a Crypto instance.
+*
+* \param eccDp
+* The curve domain parameters.
+*
+* \param verify
+* The signature verification entry.
+*
+* \param u1
+* [out] The u1 scalar, little-endian.
+*
+* \param u2
+* [out] The u2 scalar, little-endian.
+*
+* \return true if the signature values are in the range 0 < r, s < n.
+*
+*******************************************************************************/
+static bool Cy_Crypto_Core_ECC_BatchScalars(CRYPTO_Type *base, const cy_stc_crypto_ecc_dp_type *eccDp,
+                                            const cy_stc_crypto_ecc_verify_t *verify, uint8_t *u1, uint8_t *u2)
+{
+    bool valid;
+
+    uint32_t bitsize  = eccDp->size;
+    uint32_t bytesize = CY_CRYPTO_BYTE_SIZE_OF_BITS(bitsize);
+    uint32_t datasize = verify->hashlen;
+
+    /* use Barrett reduction algorithm for operations modulo n (order of the base point) */
+    Cy_Crypto_Core_EC_NistP_SetRedAlg(CY_CRYPTO_NIST_P_BARRETT_RED_ALG);
+
+    Cy_Crypto_Core_Vu_SetMemValue (base, VR_P, eccDp->order, bitsize);
+    Cy_Crypto_Core_Vu_SetMemValue (base, VR_BARRETT, eccDp->barrett_o, bitsize + 1u);
+
+    Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_R, verify->sig, bitsize);
+    Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_S, &verify->sig[bytesize], bitsize);
+
+    /* check that R and S are within the valid range, i.e. 0 < R < n and 0 < S < n */
+    valid = (!Cy_Crypto_Core_Vu_IsRegZero(base, CY_ECC_BATCH_R)) &&
+            (Cy_Crypto_Core_Vu_IsRegLess(base, CY_ECC_BATCH_R, VR_P)) &&
+            (!Cy_Crypto_Core_Vu_IsRegZero(base, CY_ECC_BATCH_S)) &&
+            (Cy_Crypto_Core_Vu_IsRegLess(base, CY_ECC_BATCH_S, VR_P));
+
+    if (valid)
+    {
+        /* load message hash, truncate it if needed. */
+        CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_HASH, datasize * 8u);
+
+        CY_CRYPTO_VU_SET_TO_ZERO(base, CY_ECC_BATCH_HASH);
+        Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_HASH, verify->hash, datasize * 8u);
+        Cy_Crypto_Core_VU_RegInvertEndianness(base, CY_ECC_BATCH_HASH);
+
+        if ((datasize * 8u) > bitsize)
+        {
+            CY_CRYPTO_VU_SET_REG(base, CY_ECC_BATCH_SHIFT, (datasize * 8u) - bitsize, 1u);
+            CY_CRYPTO_VU_LSR(base, CY_ECC_BATCH_HASH, CY_ECC_BATCH_HASH, CY_ECC_BATCH_SHIFT);
+        }
+
+        CY_CRYPTO_VU_SET_TO_ZERO(base, CY_ECC_BATCH_U1);
+        CY_CRYPTO_VU_MOV(base, CY_ECC_BATCH_U1, CY_ECC_BATCH_HASH);
+
+        CY_CRYPTO_VU_FREE_MEM(base, CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_HASH));
+
+        /* check that the prepared hash value is smaller than the order of base point */
+        if (!Cy_Crypto_Core_Vu_IsRegLess(base, CY_ECC_BATCH_U1, VR_P))
+        {
+            /* Use U2 as temporary register */
+            CY_CRYPTO_VU_MOV(base, CY_ECC_BATCH_U2, CY_ECC_BATCH_U1);
+            Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+            /* z = x % mod */
+            Cy_Crypto_Core_EC_Bar_MulRed(base, CY_ECC_BATCH_U1, CY_ECC_BATCH_U2, bitsize);
+        }
+
+        /* w = s^-1 mod n */
+        CY_CRYPTO_VU_SET_TO_ONE(base, CY_ECC_BATCH_DIVIDEND);
+        Cy_Crypto_Core_EC_DivMod(base, CY_ECC_BATCH_S, CY_ECC_BATCH_DIVIDEND, CY_ECC_BATCH_S, bitsize);
+
+        /* u1 = e*w mod n */
+        Cy_Crypto_Core_EC_MulMod(base, CY_ECC_BATCH_U1, CY_ECC_BATCH_U1, CY_ECC_BATCH_S, bitsize);
+
+        /* u2 = r*w mod n */
+        Cy_Crypto_Core_EC_MulMod(base, CY_ECC_BATCH_U2, CY_ECC_BATCH_R, CY_ECC_BATCH_S, bitsize);
+
+        Cy_Crypto_Core_Vu_GetMemValue (base, u1, CY_ECC_BATCH_U1, bitsize);
+        Cy_Crypto_Core_Vu_GetMemValue (base, u2, CY_ECC_BATCH_U2, bitsize);
+    }
+
+    return valid;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_ECC_BatchPoint
+****************************************************************************//**
+*
+* Calculates P = u1 * G + u2 * Q with the Shamir's trick, a single sequence of
+* point doublings with additions of G, Q or G + Q, and checks that
+* Px mod n is equal to r.
+*
+* \param base
+* The pointer to a Crypto instance.
+*
+* \param eccDp
+* The curve domain parameters.
+*
+* \param verify
+* The signature verification entry.
+*
+* \param u1
+* The u1 scalar, little-endian.
+*
+* \param u2
+* The u2 scalar, little-endian.
+*
+* \return true if the signature is valid.
+*
+*******************************************************************************/
+static bool Cy_Crypto_Core_ECC_BatchPoint(CRYPTO_Type *base, const cy_stc_crypto_ecc_dp_type *eccDp,
+                                          const cy_stc_crypto_ecc_verify_t *verify, uint8_t const *u1, uint8_t const *u2)
+{
+    bool valid = false;
+
+    uint32_t bitsize = eccDp->size;
+    int32_t  i;
+    uint32_t sel;
+
+    /* Point registers selected by the (u2, u1) bits pair */
+    static const uint32_t pointX[4u] = { 0u, CY_ECC_BATCH_GX, CY_ECC_BATCH_QX, CY_ECC_BATCH_HX };
+    static const uint32_t pointY[4u] = { 0u, CY_ECC_BATCH_GY, CY_ECC_BATCH_QY, CY_ECC_BATCH_HY };
+
+    /* Initialize point multiplication */
+    Cy_Crypto_Core_EC_NistP_SetRedAlg(eccDp->algo);
+
+    /* load prime and Barrett coefficient */
+    Cy_Crypto_Core_Vu_SetMemValue (base, VR_P, eccDp->prime, bitsize);
+    Cy_Crypto_Core_Vu_SetMemValue (base, VR_BARRETT, eccDp->barrett_p, bitsize + 1u);
+
+    /* load public key Qa */
+    Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_QX, (uint8_t *)verify->key->pubkey.x, bitsize);
+    Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_QY, (uint8_t *)verify->key->pubkey.y, bitsize);
+
+    /* G + Q is not defined by the affine addition for Q = G or Q = -G */
+    if (!Cy_Crypto_Core_Vu_IsRegEqual(base, CY_ECC_BATCH_QX, CY_ECC_BATCH_GX))
+    {
+        /* H = G + Q */
+        Cy_Crypto_Core_EC_SubMod(base, CY_ECC_BATCH_DIVIDEND, CY_ECC_BATCH_QY, CY_ECC_BATCH_GY);    /* (y2-y1) */
+        Cy_Crypto_Core_EC_SubMod(base, CY_ECC_BATCH_SY, CY_ECC_BATCH_QX, CY_ECC_BATCH_GX);          /* (x2-x1) */
+        Cy_Crypto_Core_EC_DivMod(base, CY_ECC_BATCH_SX, CY_ECC_BATCH_DIVIDEND, CY_ECC_BATCH_SY, bitsize); /* s = (y2-y1)/(x2-x1) */
+
+        Cy_Crypto_Core_EC_SquareMod (base, CY_ECC_BATCH_HX, CY_ECC_BATCH_SX, bitsize);              /* s^2 */
+        Cy_Crypto_Core_EC_SubMod    (base, CY_ECC_BATCH_HX, CY_ECC_BATCH_HX, CY_ECC_BATCH_GX);      /* s^2 - x1 */
+        Cy_Crypto_Core_EC_SubMod    (base, CY_ECC_BATCH_HX, CY_ECC_BATCH_HX, CY_ECC_BATCH_QX);      /* x3 = s^2 - x1 - x2 */
+        Cy_Crypto_Core_EC_SubMod    (base, CY_ECC_BATCH_SY, CY_ECC_BATCH_GX, CY_ECC_BATCH_HX);      /* x1 - x3 */
+        Cy_Crypto_Core_EC_MulMod    (base, CY_ECC_BATCH_HY, CY_ECC_BATCH_SX, CY_ECC_BATCH_SY, bitsize); /* s*(x1 - x3) */
+        Cy_Crypto_Core_EC_SubMod    (base, CY_ECC_BATCH_HY, CY_ECC_BATCH_HY, CY_ECC_BATCH_GY);      /* y3 = s*(x1 - x3) - y1 */
+
+        /* Skip the leading zero bits of both scalars */
+        i   = (int32_t)bitsize - 1;
+        sel = 0u;
+
+        while ((i >= 0) && (sel == 0u))
+        {
+            sel = (((uint32_t)u1[(uint32_t)i >> 3u] >> ((uint32_t)i & 7u)) & 1u) |
+                  ((((uint32_t)u2[(uint32_t)i >> 3u] >> ((uint32_t)i & 7u)) & 1u) << 1u);
+            i--;
+        }
+
+        if (sel != 0u)
+        {
+            /* Affine-to-Jacobian Transform. */
+            CY_CRYPTO_VU_MOV(base, CY_ECC_BATCH_SX, pointX[sel]);
+            CY_CRYPTO_VU_MOV(base, CY_ECC_BATCH_SY, pointY[sel]);
+            CY_CRYPTO_VU_SET_TO_ONE(base, CY_ECC_BATCH_SZ);
+
+            for (; i >= 0; i--)
+            {
+                sel = (((uint32_t)u1[(uint32_t)i >> 3u] >> ((uint32_t)i & 7u)) & 1u) |
+                      ((((uint32_t)u2[(uint32_t)i >> 3u] >> ((uint32_t)i & 7u)) & 1u) << 1u);
+
+                Cy_Crypto_Core_JacobianEcDouble(base, CY_ECC_BATCH_SX, CY_ECC_BATCH_SY, CY_ECC_BATCH_SZ, bitsize);
+
+                if (sel != 0u)
+                {
+                    Cy_Crypto_Core_JacobianEcAdd(base, CY_ECC_BATCH_SX, CY_ECC_BATCH_SY, CY_ECC_BATCH_SZ,
+                                                 pointX[sel], pointY[sel], bitsize);
+                }
+            }
+
+            /* Inverse transform, only Px is needed */
+            Cy_Crypto_Core_JacobianInvTransform(base, CY_ECC_BATCH_SX, CY_ECC_BATCH_SY, CY_ECC_BATCH_SZ, bitsize);
+
+            /* Px mod n, Px < p < 2 * n */
+            Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_HX, eccDp->order, bitsize);
+            Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_HY, verify->sig, bitsize);
+
+            if (!Cy_Crypto_Core_Vu_IsRegLess(base, CY_ECC_BATCH_SX, CY_ECC_BATCH_HX))
+            {
+                CY_CRYPTO_VU_SUB(base, CY_ECC_BATCH_SX, CY_ECC_BATCH_SX, CY_ECC_BATCH_HX);
+            }
+
+            valid = Cy_Crypto_Core_Vu_IsRegEqual(base, CY_ECC_BATCH_SX, CY_ECC_BATCH_HY);
+        }
+    }
+
+    return valid;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_ECC_VerifyHashBatch
+****************************************************************************//**
+*
+* Verify a list of ECC signatures on the same curve.
+*
+* The curve parameters and the vector unit registers are set up once for the
+* whole list. Each signature is verified with one joint scalar multiplication
+* u1 * G + u2 * Q (Shamir's trick) instead of two separate multiplications,
+* so the verification of a list is faster than the \ref Cy_Crypto_Core_ECC_VerifyHash
+* calls for each signature.
+*
+* \param base
+* The pointer to a Crypto instance.
+*
+* \param curveID
+* The curve of all the signatures. See \ref cy_en_crypto_ecc_curve_id_t.
+*
+* \param verifyList
+* The signatures to verify. See \ref cy_stc_crypto_ecc_verify_t.
+*
+* \param verifyCount
+* The number of the signatures.
+*
+* \param validMap
+* [out] The verification results bitmap of (verifyCount + 31) / 32 words:
+* bit (i % 32) of word (i / 32) is set when the signature i is valid.
+* Signatures with the key on a different curve or with the public key equal
+* to the base point (or its negation) are reported invalid.
+*
+* \return status code. See \ref cy_en_crypto_status_t.
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_ECC_VerifyHashBatch(CRYPTO_Type *base,
+                            cy_en_crypto_ecc_curve_id_t curveID,
+                            const cy_stc_crypto_ecc_verify_t *verifyList,
+                            uint32_t verifyCount,
+                            uint32_t *validMap)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+
+    const cy_stc_crypto_ecc_dp_type *eccDp;
+
+    uint8_t myU1[CY_CRYPTO_ECC_MAX_BYTE_SIZE];
+    uint8_t myU2[CY_CRYPTO_ECC_MAX_BYTE_SIZE];
+
+    /* NULL parameters checking */
+    if ((verifyList != NULL) && (validMap != NULL))
+    {
+        tmpResult = CY_CRYPTO_NOT_SUPPORTED;
+
+        eccDp = Cy_Crypto_Core_ECC_GetCurveParams(curveID);
+
+        if (eccDp != NULL)
+        {
+            uint32_t i;
+            uint32_t bitsize = eccDp->size;
+            const cy_stc_crypto_ecc_verify_t *verify;
+
+            uint32_t mallocMask = CY_CRYPTO_VU_REG_BIT(VR_P) | CY_CRYPTO_VU_REG_BIT(VR_BARRETT) |
+                                  CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_DIVIDEND) |
+                                  CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_GX) | CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_GY) |
+                                  CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_QX) | CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_QY) |
+                                  CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_HX) | CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_HY) |
+                                  CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_SX) | CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_SY) |
+                                  CY_CRYPTO_VU_REG_BIT(CY_ECC_BATCH_SZ);
+
+            for (i = 0u; i < ((verifyCount + 31u) / 32u); i++)
+            {
+                validMap[i] = 0u;
+            }
+
+            Cy_Crypto_Core_EC_NistP_SetMode(bitsize);
+
+            CY_CRYPTO_VU_ALLOC_MEM (base, VR_P, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, VR_BARRETT, bitsize + 1u);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_DIVIDEND, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_GX, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_GY, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_QX, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_QY, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_HX, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_HY, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_SX, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_SY, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, CY_ECC_BATCH_SZ, bitsize);
+
+            /* load base Point G once for all the signatures */
+            Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_GX, eccDp->Gx, bitsize);
+            Cy_Crypto_Core_Vu_SetMemValue (base, CY_ECC_BATCH_GY, eccDp->Gy, bitsize);
+
+            for (i = 0u; i < verifyCount; i++)
+            {
+                verify = &verifyList[i];
+
+                if ((verify->sig != NULL) && (verify->hash != NULL) && (verify->key != NULL) &&
+                    (verify->key->curveID == curveID))
+                {
+                    if (Cy_Crypto_Core_ECC_BatchScalars(base, eccDp, verify, myU1, myU2))
+                    {
+                        if (Cy_Crypto_Core_ECC_BatchPoint(base, eccDp, verify, myU1, myU2))
+                        {
+                            validMap[i / 32u] |= 1uL << (i % 32u);
+                        }
+                    }
+                }
+            }
+
+            CY_CRYPTO_VU_FREE_MEM(base, mallocMask);
+
+            tmpResult = CY_CRYPTO_SUCCESS;
+        }
+    }
+
+    return (tmpResult);
+}
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_ecc_key_gen.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides constant and parameters for the API for the ECC key
@@ -246,12 +246,19 @@ cy_en_crypto_status_t Cy_Crypto_Core_ECC_MakePublicKey(CRYPTO_Type *base,
     cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
 
     cy_stc_crypto_ecc_dp_type *eccDp = Cy_Crypto_Core_ECC_GetCurveParams(curveID);
+    cy_stc_crypto_ecc_comb_table_t *combTable = Cy_Crypto_Core_ECC_GetCombTable(curveID);
 
     if ((eccDp != NULL) && (privateKey != NULL) && (publicKey != NULL) &&
         (publicKey->pubkey.x != NULL) && (publicKey->pubkey.y != NULL))
     {
         uint32_t bitsize = eccDp->size;
 
+        if ((combTable != NULL) && (!combTable->valid))
+        {
+            /* Fill the registered comb table on its first use */
+            (void)Cy_Crypto_Core_EC_NistP_MakeCombTable(base, combTable);
+        }
+
         uint32_t p_order = 9u;    /* order of the curve */
         uint32_t p_d = 10u;       /* private key */
         uint32_t p_x = 11u;       /* x coordinate */
@@ -284,7 +291,15 @@ cy_en_crypto_status_t Cy_Crypto_Core_ECC_MakePublicKey(CRYPTO_Type *base,
         CY_CRYPTO_VU_ALLOC_MEM(base, p_d, bitsize);
         Cy_Crypto_Core_Vu_SetMemValue(base, p_d, (uint8_t *)privateKey, bitsize);
 
-        Cy_Crypto_Core_EC_NistP_PointMul(base, p_x, p_y, p_d, p_order, bitsize);
+        if ((combTable != NULL) && (combTable->valid))
+        {
+            /* Fixed-base comb multiplication with the precomputed multiples of G */
+            Cy_Crypto_Core_EC_NistP_CombPointMul(base, p_x, p_y, (uint8_t const *)privateKey, combTable, bitsize);
+        }
+        else
+        {
+            Cy_Crypto_Core_EC_NistP_PointMul(base, p_x, p_y, p_d, p_order, bitsize);
+        }
 
         Cy_Crypto_Core_Vu_GetMemValue(base, (uint8_t *)publicKey->pubkey.x, p_x, bitsize);
         Cy_Crypto_Core_Vu_GetMemValue(base, (uint8_t *)publicKey->pubkey.y, p_y, bitsize);
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_ecc.h
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides Elliptic Curve (EC) Scalar Multiplication using (X,Y)-only,
@@ -32,6 +32,7 @@
 extern "C" {
 #endif
 
+#include "cy_crypto_core_mem.h"
 #include "cy_crypto_core_vu.h"
 
 /*******************************************************************************
@@ -2076,6 +2077,402 @@ cy_en_crypto_status_t Cy_Crypto_Core_EC_NistP_PointMultiplication(CRYPTO_Type *b
     return myStatus;
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_EC_NistP_CombCondNeg
+****************************************************************************//**
+*
+* Replaces the value by (mod - value) when the condition is set, in constant time.
+* Both values are little-endian byte arrays, value < mod.
+*
+* \param a
+* The value to negate.
+*
+* \param mod
+* The modulus.
+*
+* \param byteSize
+* The size of the values in bytes.
+*
+* \param cond
+* Negate when bit 0 is set.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_EC_NistP_CombCondNeg(uint8_t *a, const uint8_t *mod, uint32_t byteSize, uint32_t cond)
+{
+    uint32_t i;
+    uint32_t diff;
+    uint32_t borrow = 0u;
+    uint8_t  mask   = (uint8_t)(0u - (cond & 1u));
+
+    for (i = 0u; i < byteSize; i++)
+    {
+        diff   = (uint32_t)mod[i] - (uint32_t)a[i] - borrow;
+        borrow = (diff >> 8u) & 1u;
+        a[i]  ^= (uint8_t)(mask & (a[i] ^ (uint8_t)diff));
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_EC_NistP_CombSelect
+****************************************************************************//**
+*
+* Gets the comb table point for a signed comb digit. All table points are read
+* so the memory access pattern does not depend on the digit value.
+*
+* \param p_x
+* [out] The affine X coordinate of the point.
+*
+* \param p_y
+* [out] The affine Y coordinate of the point.
+*
+* \param points
+* The comb table points.
+*
+* \param prime
+* The curve prime.
+*
+* \param byteSize
+* The size of the coordinates in bytes.
+*
+* \param digit
+* The comb digit, bit 7 set for a negative digit.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_EC_NistP_CombSelect(uint8_t *p_x, uint8_t *p_y, const uint8_t *points,
+    const uint8_t *prime, uint32_t byteSize, uint32_t digit)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t diff;
+    uint8_t  mask;
+    uint32_t idx = (digit & 0x7Fu) >> 1u;
+    const uint8_t *point = points;
+
+    for (j = 0u; j < byteSize; j++)
+    {
+        p_x[j] = 0u;
+        p_y[j] = 0u;
+    }
+
+    for (i = 0u; i < CY_CRYPTO_ECC_COMB_POINTS; i++)
+    {
+        diff = i ^ idx;
+        mask = (uint8_t)(((diff | (0u - diff)) >> 31u) - 1u);
+
+        for (j = 0u; j < byteSize; j++)
+        {
+            p_x[j] |= (uint8_t)(mask & point[j]);
+            p_y[j] |= (uint8_t)(mask & point[byteSize + j]);
+        }
+
+        point = &point[2u * byteSize];
+    }
+
+    /* -(x, y) = (x, p - y) */
+    Cy_Crypto_Core_EC_NistP_CombCondNeg(p_y, prime, byteSize, digit >> 7u);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_EC_NistP_CombRecode
+****************************************************************************//**
+*
+* Recodes an odd scalar into signed comb digits, all odd, so every comb
+* column adds a table point.
+* Reference: "A comb method to render ECC resistant against side channel
+* attacks", M. Hedabou, P. Pinel, L. Beneteau.
+*
+* \param digits
+* [out] The comb digits, (spacing + 1) bytes. Bit 7 is set for negative digits.
+*
+* \param scalar
+* The odd scalar, little-endian.
+*
+* \param spacing
+* The comb teeth spacing in bits.
+*
+* \param bitsize
+* Bit size of the scalar.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_EC_NistP_CombRecode(uint8_t *digits, const uint8_t *scalar, uint32_t spacing, uint32_t bitsize)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t bitPos;
+    uint32_t digit;
+    uint32_t adjust;
+    uint32_t nextCarry;
+    uint32_t carry = 0u;
+
+    /* Bit j of digit i is the scalar bit (i + j * spacing) */
+    for (i = 0u; i < spacing; i++)
+    {
+        digit = 0u;
+
+        for (j = 0u; j < CY_CRYPTO_ECC_COMB_WIDTH; j++)
+        {
+            bitPos = i + (j * spacing);
+
+            if (bitPos < bitsize)
+            {
+                digit |= (((uint32_t)scalar[bitPos >> 3u] >> (bitPos & 7u)) & 1u) << j;
+            }
+        }
+
+        digits[i] = (uint8_t)digit;
+    }
+
+    digits[spacing] = 0u;
+
+    /* An even digit borrows the previous (odd) digit, which becomes negative */
+    for (i = 1u; i <= spacing; i++)
+    {
+        digit     = digits[i];
+        nextCarry = digit & carry;
+        digit    ^= carry;
+        carry     = nextCarry;
+
+        adjust    = 1u - (digit & 1u);
+        carry    |= digit & ((uint32_t)digits[i - 1u] * adjust);
+        digit    ^= (uint32_t)digits[i - 1u] * adjust;
+
+        digits[i - 1u] |= (uint8_t)(adjust << 7u);
+        digits[i] = (uint8_t)digit;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_EC_NistP_CombPointMul
+****************************************************************************//**
+*
+* Elliptic curve fixed-base point multiplication in GF(p) with a comb table.
+* Performs (spacing) point doublings and (spacing + 1) point additions
+* regardless of the scalar value. VR_P and VR_BARRETT must hold the curve
+* prime and its Barrett coefficient.
+*
+* \param base
+* The pointer to a Crypto instance.
+*
+* \param p_x
+* [out] Register index for affine X coordinate of the result point.
+*
+* \param p_y
+* [out] Register index for affine Y coordinate of the result point.
+*
+* \param p_d
+* The scalar multiplication value, 0 < d < order, little-endian.
+*
+* \param table
+* The comb table of the base point, see \ref cy_stc_crypto_ecc_comb_table_t.
+*
+* \param bitsize
+* Bit size of the used curve.
+*
+*******************************************************************************/
+void Cy_Crypto_Core_EC_NistP_CombPointMul(CRYPTO_Type *base, uint32_t p_x, uint32_t p_y, const uint8_t *p_d,
+    const cy_stc_crypto_ecc_comb_table_t *table, uint32_t bitsize)
+{
+    uint32_t i;
+    uint32_t even;
+
+    uint32_t my_s_x  = 7u;
+    uint32_t my_s_y  = 8u;
+    uint32_t my_s_z  = 9u;
+    uint32_t my_t_x  = 10u;
+    uint32_t my_t_y  = 11u;
+
+    uint8_t scalar[CY_CRYPTO_ECC_MAX_BYTE_SIZE];
+    uint8_t tmpX[CY_CRYPTO_ECC_MAX_BYTE_SIZE];
+    uint8_t tmpY[CY_CRYPTO_ECC_MAX_BYTE_SIZE];
+    uint8_t digits[CY_CRYPTO_ECC_COMB_MAX_SPACING + 1u];
+
+    const cy_stc_crypto_ecc_dp_type *eccDp = Cy_Crypto_Core_ECC_GetCurveParams(table->curveID);
+    uint32_t bytesize = CY_CRYPTO_BYTE_SIZE_OF_BITS(bitsize);
+    uint32_t spacing  = table->spacing;
+
+    CY_ASSERT_L1((eccDp != NULL) && (eccDp->size == bitsize) && (table->valid));
+
+    /* The comb recoding needs an odd scalar: d*G = -((order - d)*G) */
+    even = 1u - ((uint32_t)p_d[0] & 1u);
+
+    Cy_Crypto_Core_MemCpy(base, scalar, p_d, (uint16_t)bytesize);
+    Cy_Crypto_Core_EC_NistP_CombCondNeg(scalar, eccDp->order, bytesize, even);
+
+    Cy_Crypto_Core_EC_NistP_CombRecode(digits, scalar, spacing, bitsize);
+
+    CY_CRYPTO_VU_PUSH_REG (base);
+
+    CY_CRYPTO_VU_LD_REG(base, my_s_x, p_x);
+    CY_CRYPTO_VU_LD_REG(base, my_s_y, p_y);
+
+    CY_CRYPTO_VU_ALLOC_MEM (base, my_s_z, bitsize);
+    CY_CRYPTO_VU_ALLOC_MEM (base, my_t_x, bitsize);
+    CY_CRYPTO_VU_ALLOC_MEM (base, my_t_y, bitsize);
+
+    Cy_Crypto_Core_EC_NistP_CombSelect(tmpX, tmpY, table->points, eccDp->prime, bytesize, digits[spacing]);
+
+    Cy_Crypto_Core_Vu_SetMemValue (base, my_s_x, tmpX, bitsize);
+    Cy_Crypto_Core_Vu_SetMemValue (base, my_s_y, tmpY, bitsize);
+
+    /* Affine-to-Jacobian Transform. */
+    CY_CRYPTO_VU_SET_TO_ONE (base, my_s_z);
+
+    for (i = spacing; i > 0u; i--)
+    {
+        /* Select the next point on the CPU while the previous addition runs */
+        Cy_Crypto_Core_EC_NistP_CombSelect(tmpX, tmpY, table->points, eccDp->prime, bytesize, digits[i - 1u]);
+
+        Cy_Crypto_Core_JacobianEcDouble (base, my_s_x, my_s_y, my_s_z, bitsize);
+
+        Cy_Crypto_Core_Vu_SetMemValue (base, my_t_x, tmpX, bitsize);
+        Cy_Crypto_Core_Vu_SetMemValue (base, my_t_y, tmpY, bitsize);
+
+        Cy_Crypto_Core_JacobianEcAdd (base, my_s_x, my_s_y, my_s_z, my_t_x, my_t_y, bitsize);
+    }
+
+    /* Inverse transform */
+    Cy_Crypto_Core_JacobianInvTransform(base, my_s_x, my_s_y, my_s_z, bitsize);
+
+    /* Negate the result back for an even scalar */
+    Cy_Crypto_Core_Vu_GetMemValue (base, tmpY, my_s_y, bitsize);
+    Cy_Crypto_Core_EC_NistP_CombCondNeg(tmpY, eccDp->prime, bytesize, even);
+    Cy_Crypto_Core_Vu_SetMemValue (base, my_s_y, tmpY, bitsize);
+
+    CY_CRYPTO_VU_FREE_MEM (base, CY_CRYPTO_VU_REG_BIT(my_s_z) |
+                                 CY_CRYPTO_VU_REG_BIT(my_t_x) | CY_CRYPTO_VU_REG_BIT(my_t_y));
+
+    CY_CRYPTO_VU_POP_REG (base);
+
+    Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+    /* Clear the scalar derived data */
+    Cy_Crypto_Core_MemSet(base, scalar, 0u, (uint16_t)sizeof(scalar));
+    Cy_Crypto_Core_MemSet(base, digits, 0u, (uint16_t)sizeof(digits));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_EC_NistP_MakeCombTable
+****************************************************************************//**
+*
+* Fills the points buffer of a fixed-base comb table registered by
+* \ref Cy_Crypto_Core_ECC_SetCombTable with multiples of the curve base point G:
+* point i = G + sum(bit j of i * 2^((j + 1) * spacing) * G).
+*
+* The table is filled on the first public key calculation if not done before,
+* call this function at initialization to move that cost out of the first
+* signature.
+*
+* \param base
+* The pointer to a Crypto instance.
+*
+* \param table
+* The comb table, see \ref cy_stc_crypto_ecc_comb_table_t.
+*
+* \return status code. See \ref cy_en_crypto_status_t.
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_EC_NistP_MakeCombTable(CRYPTO_Type *base,
+    cy_stc_crypto_ecc_comb_table_t *table)
+{
+    uint32_t s_x = 8u;
+    uint32_t s_y = 9u;
+    uint32_t s_z = 10u;
+    uint32_t t_x = 11u;
+    uint32_t t_y = 12u;
+
+    cy_en_crypto_status_t myStatus = CY_CRYPTO_BAD_PARAMS;
+
+    if ((table != NULL) && (table->points != NULL))
+    {
+        cy_stc_crypto_ecc_dp_type *eccDp = Cy_Crypto_Core_ECC_GetCurveParams(table->curveID);
+
+        myStatus = CY_CRYPTO_NOT_SUPPORTED;
+
+        if (eccDp != NULL)
+        {
+            uint32_t i;
+            uint32_t j;
+            uint32_t k;
+            uint32_t half;
+            uint32_t bitsize   = eccDp->size;
+            uint32_t bytesize  = CY_CRYPTO_BYTE_SIZE_OF_BITS(bitsize);
+            uint32_t pointSize = 2u * bytesize;
+            uint8_t *points    = table->points;
+
+            Cy_Crypto_Core_EC_NistP_SetRedAlg(eccDp->algo);
+            Cy_Crypto_Core_EC_NistP_SetMode(bitsize);
+
+            CY_CRYPTO_VU_ALLOC_MEM (base, VR_P, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, VR_BARRETT, bitsize + 1u);
+            CY_CRYPTO_VU_ALLOC_MEM (base, s_x, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, s_y, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, s_z, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, t_x, bitsize);
+            CY_CRYPTO_VU_ALLOC_MEM (base, t_y, bitsize);
+
+            Cy_Crypto_Core_Vu_SetMemValue (base, VR_P, eccDp->prime, bitsize);
+            Cy_Crypto_Core_Vu_SetMemValue (base, VR_BARRETT, eccDp->barrett_p, bitsize + 1u);
+
+            /* Point 0 is G */
+            Cy_Crypto_Core_MemCpy(base, points, eccDp->Gx, (uint16_t)bytesize);
+            Cy_Crypto_Core_MemCpy(base, &points[bytesize], eccDp->Gy, (uint16_t)bytesize);
+
+            Cy_Crypto_Core_Vu_SetMemValue (base, t_x, eccDp->Gx, bitsize);
+            Cy_Crypto_Core_Vu_SetMemValue (base, t_y, eccDp->Gy, bitsize);
+
+            for (j = 1u; j < CY_CRYPTO_ECC_COMB_WIDTH; j++)
+            {
+                /* t = 2^(j * spacing) * G */
+                CY_CRYPTO_VU_MOV (base, s_x, t_x);
+                CY_CRYPTO_VU_MOV (base, s_y, t_y);
+                CY_CRYPTO_VU_SET_TO_ONE (base, s_z);
+
+                for (k = 0u; k < table->spacing; k++)
+                {
+                    Cy_Crypto_Core_JacobianEcDouble (base, s_x, s_y, s_z, bitsize);
+                }
+
+                Cy_Crypto_Core_JacobianInvTransform(base, s_x, s_y, s_z, bitsize);
+
+                CY_CRYPTO_VU_MOV (base, t_x, s_x);
+                CY_CRYPTO_VU_MOV (base, t_y, s_y);
+
+                /* point (i + half) = point i + t */
+                half = 1uL << (j - 1u);
+
+                for (i = 0u; i < half; i++)
+                {
+                    Cy_Crypto_Core_Vu_SetMemValue (base, s_x, &points[i * pointSize], bitsize);
+                    Cy_Crypto_Core_Vu_SetMemValue (base, s_y, &points[(i * pointSize) + bytesize], bitsize);
+                    CY_CRYPTO_VU_SET_TO_ONE (base, s_z);
+
+                    Cy_Crypto_Core_JacobianEcAdd (base, s_x, s_y, s_z, t_x, t_y, bitsize);
+                    Cy_Crypto_Core_JacobianInvTransform(base, s_x, s_y, s_z, bitsize);
+
+                    Cy_Crypto_Core_Vu_GetMemValue (base, &points[(i + half) * pointSize], s_x, bitsize);
+                    Cy_Crypto_Core_Vu_GetMemValue (base, &points[((i + half) * pointSize) + bytesize], s_y, bitsize);
+                }
+            }
+
+            CY_CRYPTO_VU_FREE_MEM (base, CY_CRYPTO_VU_REG_BIT(VR_P) | CY_CRYPTO_VU_REG_BIT(VR_BARRETT) |
+                                         CY_CRYPTO_VU_REG_BIT(s_x)  | CY_CRYPTO_VU_REG_BIT(s_y) |
+                                         CY_CRYPTO_VU_REG_BIT(s_z)  | CY_CRYPTO_VU_REG_BIT(t_x) |
+                                         CY_CRYPTO_VU_REG_BIT(t_y));
+
+            table->valid = true;
+
+            myStatus = CY_CRYPTO_SUCCESS;
+        }
+    }
+
+    return myStatus;
+}
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_rsa.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides the source code to the API to calculate
@@ -59,6 +59,40 @@ static void Cy_Crypto_Core_Rsa_expModByMont(CRYPTO_Type *base,
                                      uint32_t rBar,
                                      uint32_t size);
 
+static void Cy_Crypto_Core_Rsa_SetCoefs(CRYPTO_Type *base,
+                                     uint32_t modReg,
+                                     uint32_t barrettReg,
+                                     uint32_t inverseModuloReg,
+                                     uint32_t rBarReg,
+                                     uint8_t const *barretCoef,
+                                     uint8_t const *inverseModulo,
+                                     uint8_t const *rBar,
+                                     uint32_t size);
+
+static void Cy_Crypto_Core_Rsa_WindowStore(CRYPTO_Type *base, uint32_t *expTable, uint32_t idx, uint32_t srcReg, uint32_t size);
+static void Cy_Crypto_Core_Rsa_WindowSelect(CRYPTO_Type *base, uint32_t dstReg, uint32_t const *expTable, uint32_t idx, uint32_t size);
+
+static void Cy_Crypto_Core_Rsa_expModByWindow(CRYPTO_Type *base,
+                                     uint32_t y,
+                                     uint32_t x,
+                                     uint8_t const *expPtr,
+                                     uint32_t expBitLength,
+                                     uint32_t n,
+                                     uint32_t barretCoef,
+                                     uint32_t inverseModulo,
+                                     uint32_t rBar,
+                                     uint32_t *expTable,
+                                     uint32_t size);
+
+static void Cy_Crypto_Core_Rsa_CrtExp(CRYPTO_Type *base,
+                                     uint8_t const *primePtr,
+                                     uint8_t const *expPtr,
+                                     uint32_t primeBitLength,
+                                     uint8_t const *message,
+                                     uint32_t messageSize,
+                                     uint8_t *result,
+                                     uint32_t *expTable);
+
 #endif /* #if (CPUSS_CRYPTO_VU == 1) */
 
 /**
@@ -740,6 +774,423 @@ static void Cy_Crypto_Core_Rsa_expModByMont(CRYPTO_Type *base,
     Cy_Crypto_Core_Vu_WaitForComplete(base);
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Rsa_SetCoefs
+****************************************************************************//**
+*
+* Loads the Montgomery algorithm coefficients into the registers, calculates
+* the coefficients not provided.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param modReg
+* Register index for modulo value, must be loaded.
+*
+* \param barrettReg
+* Register index for Barrett reduction value.
+*
+* \param inverseModuloReg
+* Register index for binary inverse of the modulo.
+*
+* \param rBarReg
+* Register index for (2^moduloLength mod modulo).
+*
+* \param barretCoef
+* The pointer to the Barrett coefficient or NULL to calculate it.
+*
+* \param inverseModulo
+* The pointer to the binary inverse of the modulo or NULL to calculate it.
+*
+* \param rBar
+* The pointer to the (2^moduloLength mod modulo) or NULL to calculate it.
+*
+* \param size
+* The modulo size in bits.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_Rsa_SetCoefs(CRYPTO_Type *base,
+                                     uint32_t modReg,
+                                     uint32_t barrettReg,
+                                     uint32_t inverseModuloReg,
+                                     uint32_t rBarReg,
+                                     uint8_t const *barretCoef,
+                                     uint8_t const *inverseModulo,
+                                     uint8_t const *rBar,
+                                     uint32_t size)
+{
+    if (barretCoef == NULL)
+    {
+        Cy_Crypto_Core_Rsa_BarrettGetU(base, barrettReg, modReg, size);
+        Cy_Crypto_Core_Vu_WaitForComplete(base);
+    }
+    else
+    {
+        Cy_Crypto_Core_Vu_SetMemValue(base, barrettReg, barretCoef, size + (uint32_t)1u);
+    }
+
+    if (rBar == NULL)
+    {
+        /* inverseModuloReg used here as temp variable */
+        CY_CRYPTO_VU_SET_TO_ONE(base, inverseModuloReg);
+        Cy_Crypto_Core_Rsa_MontTransform(base, rBarReg, inverseModuloReg, barrettReg, modReg, size);
+        Cy_Crypto_Core_Vu_WaitForComplete(base);
+    }
+    else
+    {
+        Cy_Crypto_Core_Vu_SetMemValue(base, rBarReg, rBar, size);
+    }
+
+    if (inverseModulo == NULL)
+    {
+        Cy_Crypto_Core_Rsa_MontCoeff(base, inverseModuloReg, modReg, size);
+        Cy_Crypto_Core_Vu_WaitForComplete(base);
+    }
+    else
+    {
+        Cy_Crypto_Core_Vu_SetMemValue(base, inverseModuloReg, inverseModulo, size);
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Rsa_WindowStore
+****************************************************************************//**
+*
+* Stores the register value into the powers table.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param expTable
+* The powers table.
+*
+* \param idx
+* The table entry index.
+*
+* \param srcReg
+* Register index for the stored value.
+*
+* \param size
+* The value size in bits.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_Rsa_WindowStore(CRYPTO_Type *base, uint32_t *expTable, uint32_t idx, uint32_t srcReg, uint32_t size)
+{
+    uint32_t i;
+    uint32_t wordSize = CY_CRYPTO_WORD_SIZE_OF_BITS(size);
+    uint32_t *entry   = &expTable[idx * wordSize];
+    uint32_t const *src;
+
+    Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+    src = Cy_Crypto_Core_Vu_RegMemPointer(base, srcReg);
+
+    for (i = 0u; i < wordSize; i++)
+    {
+        entry[i] = src[i];
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Rsa_WindowSelect
+****************************************************************************//**
+*
+* Loads the powers table entry into the register. All table entries are read
+* so the memory access pattern does not depend on the exponent.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param dstReg
+* Register index for the loaded value.
+*
+* \param expTable
+* The powers table.
+*
+* \param idx
+* The table entry index.
+*
+* \param size
+* The value size in bits.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_Rsa_WindowSelect(CRYPTO_Type *base, uint32_t dstReg, uint32_t const *expTable, uint32_t idx, uint32_t size)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t diff;
+    uint32_t mask;
+    uint32_t wordSize = CY_CRYPTO_WORD_SIZE_OF_BITS(size);
+    uint32_t const *entry = expTable;
+    uint32_t *dst;
+
+    Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+    dst = Cy_Crypto_Core_Vu_RegMemPointer(base, dstReg);
+
+    for (j = 0u; j < wordSize; j++)
+    {
+        dst[j] = 0u;
+    }
+
+    for (i = 0u; i < (1uL << CY_CRYPTO_RSA_EXP_WINDOW); i++)
+    {
+        diff = i ^ idx;
+        mask = ((diff | (0u - diff)) >> 31u) - 1u;
+
+        for (j = 0u; j < wordSize; j++)
+        {
+            dst[j] |= mask & entry[j];
+        }
+
+        entry = &entry[wordSize];
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Rsa_expModByWindow
+****************************************************************************//**
+*
+* Perform y = x^e mod n using Montgomery reduction technique and the fixed
+* window exponentiation. Suitable for long (private) exponents: every
+* \ref CY_CRYPTO_RSA_EXP_WINDOW exponent bits take the same number of squares
+* and one multiplication by a table power regardless of the exponent value.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param y
+* Register index for calculated value.
+*
+* \param x
+* Register index for multiplicand value. The value is destroyed.
+*
+* \param expPtr
+* The pointer to the exponent value, little-endian.
+*
+* \param expBitLength
+* The exponent length in bits.
+*
+* \param n
+* Register index for modulo value.
+*
+* \param barretCoef
+* Barrett coefficient.
+*
+* \param inverseModulo
+* Binary inverse of the modulo.
+*
+* \param rBar
+* Values of (2^moduloLength mod modulo).
+*
+* \param expTable
+* The powers table, \ref CY_CRYPTO_RSA_EXP_TABLE_SIZE bytes.
+*
+* \param size
+* The modulo size in bits.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_Rsa_expModByWindow(CRYPTO_Type *base,
+                                     uint32_t y,
+                                     uint32_t x,
+                                     uint8_t const *expPtr,
+                                     uint32_t expBitLength,
+                                     uint32_t n,
+                                     uint32_t barretCoef,
+                                     uint32_t inverseModulo,
+                                     uint32_t rBar,
+                                     uint32_t *expTable,
+                                     uint32_t size)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t bitPos;
+    uint32_t window;
+    uint32_t windows = (expBitLength + CY_CRYPTO_RSA_EXP_WINDOW - 1u) / CY_CRYPTO_RSA_EXP_WINDOW;
+
+    uint32_t myY      = 5u;
+    uint32_t myX      = 6u;
+    uint32_t myN      = 7u;
+    uint32_t nPrime   = 8u;
+    uint32_t barrett  = 9u;
+    uint32_t power    = 10u;
+    uint32_t myRBar   = 11u;
+
+    CY_CRYPTO_VU_PUSH_REG(base);
+
+    CY_CRYPTO_VU_LD_REG(base, myY, y);
+    CY_CRYPTO_VU_LD_REG(base, myX, x);
+    CY_CRYPTO_VU_LD_REG(base, myN, n);
+    CY_CRYPTO_VU_LD_REG(base, nPrime,  inverseModulo);
+    CY_CRYPTO_VU_LD_REG(base, barrett, barretCoef);
+    CY_CRYPTO_VU_LD_REG(base, myRBar,  rBar);
+
+    CY_CRYPTO_VU_ALLOC_MEM(base, power, size);
+
+    /* Powers table: entry i = x^i in Montgomery representation */
+    Cy_Crypto_Core_Rsa_WindowStore(base, expTable, 0u, myRBar, size);
+
+    Cy_Crypto_Core_Rsa_MontTransform(base, myX, myX, barrett, myN, size);
+    Cy_Crypto_Core_Rsa_WindowStore(base, expTable, 1u, myX, size);
+
+    CY_CRYPTO_VU_MOV(base, power, myX);
+
+    for (i = 2u; i < (1uL << CY_CRYPTO_RSA_EXP_WINDOW); i++)
+    {
+        Cy_Crypto_Core_Rsa_MontMul(base, power, power, myX, nPrime, myN, size);
+        Cy_Crypto_Core_Rsa_WindowStore(base, expTable, i, power, size);
+    }
+
+    /* Exponent windows from the most significant one */
+    for (i = windows; i > 0u; i--)
+    {
+        bitPos = (i - 1u) * CY_CRYPTO_RSA_EXP_WINDOW;
+        window = ((uint32_t)expPtr[bitPos >> 3u] >> (bitPos & 7u)) & ((1uL << CY_CRYPTO_RSA_EXP_WINDOW) - 1u);
+
+        if (i == windows)
+        {
+            Cy_Crypto_Core_Rsa_WindowSelect(base, myY, expTable, window, size);
+        }
+        else
+        {
+            for (j = 0u; j < CY_CRYPTO_RSA_EXP_WINDOW; j++)
+            {
+                /* myY = myY ^ 2 */
+                Cy_Crypto_Core_Rsa_MontMul(base, myY, myY, myY, nPrime, myN, size);
+                Cy_Crypto_Core_Vu_WaitForComplete(base);
+            }
+
+            /* myY = myY * x^window */
+            Cy_Crypto_Core_Rsa_WindowSelect(base, power, expTable, window, size);
+            Cy_Crypto_Core_Rsa_MontMul(base, myY, myY, power, nPrime, myN, size);
+            Cy_Crypto_Core_Vu_WaitForComplete(base);
+        }
+    }
+
+    CY_CRYPTO_VU_SET_TO_ONE(base, power);
+
+    Cy_Crypto_Core_Rsa_MontMul(base, myY, myY, power, nPrime, myN, size);
+
+    CY_CRYPTO_VU_FREE_MEM(base, CY_CRYPTO_VU_REG_BIT(power));
+    CY_CRYPTO_VU_POP_REG(base);
+
+    Cy_Crypto_Core_Vu_WaitForComplete(base);
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Rsa_CrtExp
+****************************************************************************//**
+*
+* Perform result = (message mod prime)^exp mod prime, the half of the RSA CRT
+* private key operation.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param primePtr
+* The pointer to the prime value.
+*
+* \param expPtr
+* The pointer to the exponent value.
+*
+* \param primeBitLength
+* The prime and exponent length in bits.
+*
+* \param message
+* The pointer to the message, up to twice the prime length.
+*
+* \param messageSize
+* The length of the message in bytes.
+*
+* \param result
+* The pointer to the result, primeBitLength bits.
+*
+* \param expTable
+* The powers table, \ref CY_CRYPTO_RSA_EXP_TABLE_SIZE bytes.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_Rsa_CrtExp(CRYPTO_Type *base,
+                                     uint8_t const *primePtr,
+                                     uint8_t const *expPtr,
+                                     uint32_t primeBitLength,
+                                     uint8_t const *message,
+                                     uint32_t messageSize,
+                                     uint8_t *result,
+                                     uint32_t *expTable)
+{
+    uint32_t byteSize = CY_CRYPTO_BYTE_SIZE_OF_BITS(primeBitLength);
+    uint32_t lowSize  = (messageSize < byteSize) ? messageSize : byteSize;
+
+    uint32_t yReg                = 5u;
+    uint32_t xReg                = 6u;
+    uint32_t modReg              = 7u;
+    uint32_t inverseModuloReg    = 8u;
+    uint32_t barrettReg          = 9u;
+    uint32_t rBarReg             = 11u;
+    uint32_t sumReg              = 12u;
+    uint32_t tmpReg              = 13u;
+
+    CY_CRYPTO_VU_ALLOC_MEM(base, yReg,             primeBitLength);
+    CY_CRYPTO_VU_ALLOC_MEM(base, xReg,             primeBitLength);
+    CY_CRYPTO_VU_ALLOC_MEM(base, modReg,           primeBitLength);
+    CY_CRYPTO_VU_ALLOC_MEM(base, inverseModuloReg, primeBitLength);
+    CY_CRYPTO_VU_ALLOC_MEM(base, barrettReg,       primeBitLength + 1u);
+    CY_CRYPTO_VU_ALLOC_MEM(base, rBarReg,          primeBitLength);
+
+    Cy_Crypto_Core_Vu_SetMemValue(base, modReg, primePtr, primeBitLength);
+
+    Cy_Crypto_Core_Rsa_SetCoefs(base, modReg, barrettReg, inverseModuloReg, rBarReg, NULL, NULL, NULL, primeBitLength);
+
+    /* x = message mod prime = ((messageHigh << size) mod prime + messageLow) mod prime */
+    CY_CRYPTO_VU_SET_TO_ZERO(base, xReg);
+
+    if (messageSize > byteSize)
+    {
+        Cy_Crypto_Core_Vu_SetMemValue(base, xReg, &message[byteSize], (messageSize - byteSize) * 8u);
+    }
+
+    Cy_Crypto_Core_Rsa_MontTransform(base, yReg, xReg, barrettReg, modReg, primeBitLength);
+
+    CY_CRYPTO_VU_SET_TO_ZERO(base, xReg);
+    Cy_Crypto_Core_Vu_SetMemValue(base, xReg, message, lowSize * 8u);
+
+    CY_CRYPTO_VU_ALLOC_MEM(base, sumReg, primeBitLength + 1u);
+    CY_CRYPTO_VU_ALLOC_MEM(base, tmpReg, primeBitLength + 1u);
+
+    /* messageLow < 2 * prime, C = (a >= b) */
+    CY_CRYPTO_VU_SUB(base, tmpReg, xReg, modReg);
+    CY_CRYPTO_VU_COND_MOV(base, CY_CRYPTO_VU_COND_CS, xReg, tmpReg);
+
+    CY_CRYPTO_VU_ADD(base, sumReg, yReg, xReg);
+
+    /* C = (a >= b) */
+    CY_CRYPTO_VU_SUB(base, tmpReg, sumReg, modReg);
+    CY_CRYPTO_VU_COND_MOV(base, CY_CRYPTO_VU_COND_CC, tmpReg, sumReg);
+    CY_CRYPTO_VU_MOV(base, xReg, tmpReg);
+
+    CY_CRYPTO_VU_FREE_MEM(base, CY_CRYPTO_VU_REG_BIT(sumReg) | CY_CRYPTO_VU_REG_BIT(tmpReg));
+
+    Cy_Crypto_Core_Rsa_expModByWindow(base,
+                                      yReg,
+                                      xReg,
+                                      expPtr,
+                                      primeBitLength,
+                                      modReg,
+                                      barrettReg,
+                                      inverseModuloReg,
+                                      rBarReg,
+                                      expTable,
+                                      primeBitLength);
+
+    Cy_Crypto_Core_Vu_GetMemValue(base, result, yReg, primeBitLength);
+
+    CY_CRYPTO_VU_FREE_MEM(base, CY_CRYPTO_VU_REG_BIT(yReg) | CY_CRYPTO_VU_REG_BIT(xReg) |
+                                CY_CRYPTO_VU_REG_BIT(modReg) | CY_CRYPTO_VU_REG_BIT(inverseModuloReg) |
+                                CY_CRYPTO_VU_REG_BIT(barrettReg) | CY_CRYPTO_VU_REG_BIT(rBarReg));
+
+    Cy_Crypto_Core_Vu_WaitForComplete(base);
+}
+
 /**
 * \addtogroup group_crypto_lld_asymmetric_functions
 * \{
@@ -815,37 +1266,8 @@ cy_en_crypto_status_t Cy_Crypto_Core_Rsa_Proc(CRYPTO_Type *base,
     Cy_Crypto_Core_Vu_SetMemValue(base, xReg,   (uint8_t const *)message, messageSize * (uint32_t)8u);
 
     /* Check coefficients */
-    if (barretCoef == NULL)
-    {
-        Cy_Crypto_Core_Rsa_BarrettGetU(base, barrettReg, modReg, nBitLength);
-        Cy_Crypto_Core_Vu_WaitForComplete(base);
-    }
-    else
-    {
-        Cy_Crypto_Core_Vu_SetMemValue(base, barrettReg, barretCoef, nBitLength + (uint32_t)1u);
-    }
-
-    if (rBar == NULL)
-    {
-        /* inverseModuloReg used here as temp variable */
-        CY_CRYPTO_VU_SET_TO_ONE(base, inverseModuloReg);
-        Cy_Crypto_Core_Rsa_MontTransform(base, rBarReg, inverseModuloReg, barrettReg, modReg, nBitLength);
-        Cy_Crypto_Core_Vu_WaitForComplete(base);
-    }
-    else
-    {
-        Cy_Crypto_Core_Vu_SetMemValue(base, rBarReg, rBar, nBitLength);
-    }
-
-    if (inverseModulo == NULL)
-    {
-        Cy_Crypto_Core_Rsa_MontCoeff(base, inverseModuloReg, modReg, nBitLength);
-        Cy_Crypto_Core_Vu_WaitForComplete(base);
-    }
-    else
-    {
-        Cy_Crypto_Core_Vu_SetMemValue(base, inverseModuloReg, inverseModulo, nBitLength);
-    }
+    Cy_Crypto_Core_Rsa_SetCoefs(base, modReg, barrettReg, inverseModuloReg, rBarReg,
+                                barretCoef, inverseModulo, rBar, nBitLength);
 
     Cy_Crypto_Core_Rsa_expModByMont(base,
                                     yReg,
@@ -872,6 +1294,233 @@ cy_en_crypto_status_t Cy_Crypto_Core_Rsa_Proc(CRYPTO_Type *base,
     return (tmpResult);
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Rsa_ProcWindow
+****************************************************************************//**
+*
+* RSA process algorithm based on the Montgomery algorithm using Barrett
+* reduction and the fixed window exponentiation.
+*
+* Unlike \ref Cy_Crypto_Core_Rsa_Proc, which processes the exponent bit by bit,
+* the function processes \ref CY_CRYPTO_RSA_EXP_WINDOW exponent bits per
+* multiplication using a table of precomputed powers of the message. It is
+* intended for the private key operations with the long exponent, the
+* sequence of operations does not depend on the exponent value.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param key
+* The pointer to the \ref cy_stc_crypto_rsa_pub_key_t structure that stores
+* the modulus and the private exponent.
+*
+* \param message
+* The pointer to the message to be processed.
+*
+* \param messageSize
+* The length of the message to be processed.
+*
+* \param processedMessage
+* The pointer to processed message.
+*
+* \param expTable
+* The pointer to the 4-byte aligned powers table of
+* \ref CY_CRYPTO_RSA_EXP_TABLE_SIZE (modulus length) bytes.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_Rsa_ProcWindow(CRYPTO_Type *base,
+                                              cy_stc_crypto_rsa_pub_key_t const *key,
+                                              uint8_t const *message,
+                                              uint32_t messageSize,
+                                              uint8_t *processedMessage,
+                                              uint32_t *expTable)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+
+    uint32_t yReg                = 5u;
+    uint32_t xReg                = 6u;
+    uint32_t modReg              = 7u;
+    uint32_t inverseModuloReg    = 8u;
+    uint32_t barrettReg          = 9u;
+    uint32_t rBarReg             = 11u;
+
+    if ((key != NULL) && (message != NULL) && (processedMessage != NULL) && (expTable != NULL))
+    {
+        uint32_t nBitLength = key->moduloLength;
+
+        /* Clear all Crypto Buffer before operations */
+        Cy_Crypto_Core_MemSet(base, (void*)Cy_Crypto_Core_GetVuMemoryAddress(base), 0x00u, (uint16_t)Cy_Crypto_Core_GetVuMemorySize(base));
+
+        CY_CRYPTO_VU_ALLOC_MEM(base, yReg,             nBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, xReg,             nBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, modReg,           nBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, inverseModuloReg, nBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, barrettReg,       nBitLength + (uint32_t)1u);
+        CY_CRYPTO_VU_ALLOC_MEM(base, rBarReg,          nBitLength);
+
+        Cy_Crypto_Core_Vu_SetMemValue(base, modReg, key->moduloPtr, nBitLength);
+        Cy_Crypto_Core_Vu_SetMemValue(base, xReg,   message, messageSize * (uint32_t)8u);
+
+        Cy_Crypto_Core_Rsa_SetCoefs(base, modReg, barrettReg, inverseModuloReg, rBarReg,
+                                    key->barretCoefPtr, key->inverseModuloPtr, key->rBarPtr, nBitLength);
+
+        Cy_Crypto_Core_Rsa_expModByWindow(base,
+                                          yReg,
+                                          xReg,
+                                          key->pubExpPtr,
+                                          key->pubExpLength,
+                                          modReg,
+                                          barrettReg,
+                                          inverseModuloReg,
+                                          rBarReg,
+                                          expTable,
+                                          nBitLength);
+
+        /* Copy the tmpResult to output buffer */
+        Cy_Crypto_Core_Vu_GetMemValue(base, processedMessage, yReg, nBitLength);
+
+        CY_CRYPTO_VU_FREE_MEM(base, CY_CRYPTO_VU_REG_BIT(yReg) | CY_CRYPTO_VU_REG_BIT(xReg) |
+                                    CY_CRYPTO_VU_REG_BIT(modReg) | CY_CRYPTO_VU_REG_BIT(inverseModuloReg) |
+                                    CY_CRYPTO_VU_REG_BIT(barrettReg) | CY_CRYPTO_VU_REG_BIT(rBarReg));
+
+        Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+        tmpResult = CY_CRYPTO_SUCCESS;
+    }
+
+    return (tmpResult);
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_Rsa_ProcCrt
+****************************************************************************//**
+*
+* RSA private key operation using the Chinese Remainder Theorem:
+*
+* m1 = c^dP mod p, m2 = c^dQ mod q, h = qInv * (m1 - m2) mod p, m = m2 + h * q
+*
+* Both exponentiations use half-length operands and the fixed window
+* exponentiation (see \ref Cy_Crypto_Core_Rsa_ProcWindow), which makes the
+* operation about four times faster than with the full length private exponent.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param key
+* The pointer to the \ref cy_stc_crypto_rsa_crt_key_t structure that stores
+* the private key.
+*
+* \param message
+* The pointer to the message to be processed, less than the modulus.
+*
+* \param messageSize
+* The length of the message to be processed, up to twice the prime length.
+*
+* \param processedMessage
+* The pointer to processed message, twice the prime length.
+* Must not overlap with the message.
+*
+* \param expTable
+* The pointer to the 4-byte aligned powers table of
+* \ref CY_CRYPTO_RSA_EXP_TABLE_SIZE (prime length) bytes.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_Rsa_ProcCrt(CRYPTO_Type *base,
+                                              cy_stc_crypto_rsa_crt_key_t const *key,
+                                              uint8_t const *message,
+                                              uint32_t messageSize,
+                                              uint8_t *processedMessage,
+                                              uint32_t *expTable)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+
+    uint32_t mReg                = 5u;
+    uint32_t aReg                = 6u;
+    uint32_t bReg                = 7u;
+    uint32_t modReg              = 8u;
+    uint32_t inverseModuloReg    = 9u;
+    uint32_t barrettReg          = 10u;
+    uint32_t tmpReg              = 11u;
+
+    if ((key != NULL) && (message != NULL) && (processedMessage != NULL) && (expTable != NULL) &&
+        (messageSize <= (2u * CY_CRYPTO_BYTE_SIZE_OF_BITS(key->primeLength))))
+    {
+        uint32_t pBitLength = key->primeLength;
+        uint8_t *m1Ptr = processedMessage;
+        uint8_t *m2Ptr = &processedMessage[CY_CRYPTO_BYTE_SIZE_OF_BITS(pBitLength)];
+
+        /* Clear all Crypto Buffer before operations */
+        Cy_Crypto_Core_MemSet(base, (void*)Cy_Crypto_Core_GetVuMemoryAddress(base), 0x00u, (uint16_t)Cy_Crypto_Core_GetVuMemorySize(base));
+
+        /* m1 = c^dP mod p, m2 = c^dQ mod q; the output buffer holds both */
+        Cy_Crypto_Core_Rsa_CrtExp(base, key->pPtr, key->dPPtr, pBitLength, message, messageSize, m1Ptr, expTable);
+        Cy_Crypto_Core_Rsa_CrtExp(base, key->qPtr, key->dQPtr, pBitLength, message, messageSize, m2Ptr, expTable);
+
+        CY_CRYPTO_VU_ALLOC_MEM(base, aReg,             pBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, bReg,             pBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, modReg,           pBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, inverseModuloReg, pBitLength);
+        CY_CRYPTO_VU_ALLOC_MEM(base, barrettReg,       pBitLength + 1u);
+
+        Cy_Crypto_Core_Vu_SetMemValue(base, modReg, key->pPtr, pBitLength);
+
+        Cy_Crypto_Core_Rsa_BarrettGetU(base, barrettReg, modReg, pBitLength);
+        Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+        Cy_Crypto_Core_Rsa_MontCoeff(base, inverseModuloReg, modReg, pBitLength);
+        Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+        Cy_Crypto_Core_Vu_SetMemValue(base, aReg, m1Ptr, pBitLength);
+        Cy_Crypto_Core_Vu_SetMemValue(base, bReg, m2Ptr, pBitLength);
+
+        CY_CRYPTO_VU_ALLOC_MEM(base, tmpReg,           pBitLength + 1u);
+
+        /* m2 mod p, m2 < q < 2 * p, C = (a >= b) */
+        CY_CRYPTO_VU_SUB(base, tmpReg, bReg, modReg);
+        CY_CRYPTO_VU_COND_MOV(base, CY_CRYPTO_VU_COND_CS, bReg, tmpReg);
+
+        /* (m1 - m2) mod p */
+        CY_CRYPTO_VU_SUB(base, tmpReg, aReg, bReg);
+        CY_CRYPTO_VU_COND_ADD(base, CY_CRYPTO_VU_COND_CC, tmpReg, tmpReg, modReg);
+        CY_CRYPTO_VU_MOV(base, aReg, tmpReg);
+
+        CY_CRYPTO_VU_FREE_MEM(base, CY_CRYPTO_VU_REG_BIT(tmpReg));
+
+        /* h = qInv * (m1 - m2) mod p = MontMul((m1 - m2), qInv * r mod p) */
+        Cy_Crypto_Core_Vu_SetMemValue(base, bReg, key->qInvPtr, pBitLength);
+        Cy_Crypto_Core_Rsa_MontTransform(base, bReg, bReg, barrettReg, modReg, pBitLength);
+        Cy_Crypto_Core_Rsa_MontMul(base, aReg, aReg, bReg, inverseModuloReg, modReg, pBitLength);
+
+        /* m = m2 + h * q */
+        Cy_Crypto_Core_Vu_SetMemValue(base, modReg, key->qPtr, pBitLength);
+        Cy_Crypto_Core_Vu_SetMemValue(base, bReg, m2Ptr, pBitLength);
+
+        CY_CRYPTO_VU_ALLOC_MEM(base, mReg,             2u * pBitLength);
+
+        CY_CRYPTO_VU_UMUL(base, mReg, aReg, modReg);
+        CY_CRYPTO_VU_ADD(base, mReg, mReg, bReg);
+
+        /* Copy the tmpResult to output buffer */
+        Cy_Crypto_Core_Vu_GetMemValue(base, processedMessage, mReg, 2u * pBitLength);
+
+        CY_CRYPTO_VU_FREE_MEM(base, CY_CRYPTO_VU_REG_BIT(mReg) | CY_CRYPTO_VU_REG_BIT(aReg) |
+                                    CY_CRYPTO_VU_REG_BIT(bReg) | CY_CRYPTO_VU_REG_BIT(modReg) |
+                                    CY_CRYPTO_VU_REG_BIT(inverseModuloReg) | CY_CRYPTO_VU_REG_BIT(barrettReg));
+
+        Cy_Crypto_Core_Vu_WaitForComplete(base);
+
+        tmpResult = CY_CRYPTO_SUCCESS;
+    }
+
+    return (tmpResult);
+}
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_Core_Rsa_Coef
 ****************************************************************************//**
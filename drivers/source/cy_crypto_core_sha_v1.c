@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_sha_v1.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides the source code to the API for the SHA method
@@ -98,6 +98,61 @@ void Cy_Crypto_Core_V1_Sha_ProcessBlock(CRYPTO_Type *base,
     }
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V1_Sha_ProcessBlocks
+****************************************************************************//**
+*
+* Performs the SHA calculation on several consecutive blocks directly from the
+* message memory, without copying them to the context block buffer.
+* The SHA instruction of the next block is queued to the instruction FIFO while
+* the current block is compressed, the function waits only for the last one.
+* The message must be 4-Byte aligned!
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param hashState
+* The pointer to a Hash State.
+*
+* \param message
+* The pointer to the first block whose Hash is being computed.
+*
+* \param blockCount
+* The number of blocks to be processed.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V1_Sha_ProcessBlocks(CRYPTO_Type *base,
+                                     cy_stc_crypto_sha_state_t *hashState, uint8_t const *message, uint32_t blockCount)
+{
+    uint8_t const *blockPtr = message;
+    uint32_t i;
+
+    /* Set the SHA mode */
+    REG_CRYPTO_SHA_CTL(base) = (uint32_t)(_VAL2FLD(CRYPTO_SHA_CTL_MODE, (uint32_t)hashState->modeHw));
+
+    for (i = 0U; i < blockCount; i++)
+    {
+        Cy_Crypto_SetReg4Instr(base,
+                               (uint32_t)blockPtr,
+                               (uint32_t)hashState->hash,  /* Initial hash */
+                               (uint32_t)hashState->roundMem,
+                               (uint32_t)hashState->hash);  /* Digest */
+
+        /* Queue the SHA instruction */
+        Cy_Crypto_Run4ParamInstr(base,
+                                 CY_CRYPTO_V1_SHA_OPC,
+                                 CY_CRYPTO_RSRC0_SHIFT,
+                                 CY_CRYPTO_RSRC4_SHIFT,
+                                 CY_CRYPTO_RSRC8_SHIFT,
+                                 CY_CRYPTO_RSRC12_SHIFT);
+
+        blockPtr += hashState->blockSize;
+    }
+
+    /* Wait until all queued SHA instructions are complete */
+    Cy_Crypto_Core_WaitForReady(base);
+}
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_Core_V1_Sha_Init
 ****************************************************************************//**
@@ -386,8 +441,38 @@ cy_en_crypto_status_t Cy_Crypto_Core_V1_Sha_Update(CRYPTO_Type *base,
 
                 uint32_t hashBlockIdx  = hashState->blockIdx;
                 uint32_t hashBlockSize = hashState->blockSize;
+                uint32_t blockCount;
+
+                /* Complete the remaining block from the context buffer */
+                if ((hashBlockIdx != 0U) && ((hashBlockIdx + messageSize) >= hashBlockSize))
+                {
+                    uint32_t tempBlockSize = hashBlockSize - hashBlockIdx;
+
+                    Cy_Crypto_Core_V1_MemCpy(base, (void *)((uint32_t)hashState->block + hashBlockIdx), message, (uint16_t)tempBlockSize);
+
+                    Cy_Crypto_Core_V1_Sha_ProcessBlock(base, hashState, hashState->block);
+
+                    messageSize -= tempBlockSize;
+                    message += tempBlockSize;
+
+                    hashBlockIdx = 0U;
+                }
 
-                /* Processing the fully filled blocks with remaining buffer data */
+                /* Processing the aligned fully filled blocks in place */
+                if (0U == ((uint32_t)message & 0x3U))
+                {
+                    blockCount = messageSize / hashBlockSize;
+
+                    if (blockCount != 0U)
+                    {
+                        Cy_Crypto_Core_V1_Sha_ProcessBlocks(base, hashState, message, blockCount);
+
+                        messageSize -= blockCount * hashBlockSize;
+                        message += blockCount * hashBlockSize;
+                    }
+                }
+
+                /* Processing the not aligned fully filled blocks through the context buffer */
                 while ((hashBlockIdx + messageSize) >= hashBlockSize)
                 {
                     uint32_t tempBlockSize = hashBlockSize - hashBlockIdx;
@@ -419,6 +504,53 @@ cy_en_crypto_status_t Cy_Crypto_Core_V1_Sha_Update(CRYPTO_Type *base,
     return (tmpResult);
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V1_Sha_UpdateList
+****************************************************************************//**
+*
+* Performs the SHA calculation on the message given as a scatter-gather list
+* of fragments.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param hashState
+* The pointer to the SHA context.
+*
+* \param sgList
+* The scatter-gather list of the message fragments. The dst fields are not used.
+*
+* \param sgCount
+* The number of entries in sgList.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_V1_Sha_UpdateList(CRYPTO_Type *base,
+                               cy_stc_crypto_sha_state_t *hashState,
+                               cy_stc_crypto_sg_entry_t const *sgList,
+                               uint32_t sgCount)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+    uint32_t i;
+
+    if ((hashState != NULL) && ((sgList != NULL) || (sgCount == 0U)))
+    {
+        tmpResult = CY_CRYPTO_SUCCESS;
+
+        for (i = 0U; (CY_CRYPTO_SUCCESS == tmpResult) && (i < sgCount); i++)
+        {
+            if (sgList[i].size != 0U)
+            {
+                tmpResult = Cy_Crypto_Core_V1_Sha_Update(base, hashState, sgList[i].src, sgList[i].size);
+            }
+        }
+    }
+
+    return (tmpResult);
+}
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_Core_V1_Sha_Finish
 ****************************************************************************//**
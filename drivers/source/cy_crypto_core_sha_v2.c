@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_core_sha_v2.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides the source code to the API for the SHA method
@@ -286,6 +286,106 @@ cy_en_crypto_status_t Cy_Crypto_Core_V2_Sha_Start(CRYPTO_Type *base, cy_stc_cryp
     return (tmpResult);
 }
 
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Sha_LoadState
+****************************************************************************//**
+*
+* Loads the calculated hash and the remaining block from the context buffers
+* to the register buffer.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Sha_LoadState(CRYPTO_Type *base, cy_stc_crypto_sha_state_t *hashState)
+{
+    /* Load the calculated hash from the context buffer */
+    Cy_Crypto_Core_V2_RBClear(base);
+    Cy_Crypto_Core_V2_Sync(base);
+
+    Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_LOAD0, hashState->hash, hashState->hashSize);
+    Cy_Crypto_Core_V2_RBXor(base, 0U, hashState->hashSize);
+    Cy_Crypto_Core_V2_Sync(base);
+    Cy_Crypto_Core_V2_RBSwap(base);
+
+    /* Load the remaining block from the context buffer */
+    if (hashState->blockIdx != 0U)
+    {
+        Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_LOAD0, hashState->block, hashState->blockIdx);
+        Cy_Crypto_Core_V2_RBXor(base, 0U, hashState->blockIdx);
+        Cy_Crypto_Core_V2_Sync(base);
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Sha_ProcessData
+****************************************************************************//**
+*
+* Streams the message through FIFO_LOAD0 and queues the compression of every
+* filled block without waiting for its completion. The data of the not
+* completed block stays in the register buffer, so the next message part is
+* appended to it without copying.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Sha_ProcessData(CRYPTO_Type *base, cy_stc_crypto_sha_state_t *hashState,
+                                              uint8_t const *message, uint32_t messageSize)
+{
+    uint32_t hashBlockIdx  = hashState->blockIdx;
+    uint32_t hashBlockSize = hashState->blockSize;
+    uint32_t size = messageSize;
+
+    /* Start the hash calculating */
+    Cy_Crypto_Core_V2_FFContinue(base, CY_CRYPTO_V2_RB_FF_LOAD0, message, size);
+
+    /* Processing the fully filled blocks with remaining buffer data */
+    while ((hashBlockIdx + size) >= hashBlockSize)
+    {
+        uint32_t tempBlockSize = hashBlockSize - hashBlockIdx;
+
+        Cy_Crypto_Core_V2_RBXor(base, hashBlockIdx, tempBlockSize);
+
+        Cy_Crypto_Core_V2_Run(base, hashState->modeHw);
+
+        size -= tempBlockSize;
+
+        hashBlockIdx = 0U;
+    }
+
+    /* Load the end of the message (tail that less then block size) to the register buffer */
+    if (size != 0U)
+    {
+        Cy_Crypto_Core_V2_RBXor(base, hashBlockIdx, size);
+    }
+
+    /* The remaining block will be calculated in the Finish function */
+    hashState->blockIdx = hashBlockIdx + size;
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Sha_StoreState
+****************************************************************************//**
+*
+* Stores the remaining block and the calculated hash from the register buffer
+* to the context buffers.
+*
+*******************************************************************************/
+static void Cy_Crypto_Core_V2_Sha_StoreState(CRYPTO_Type *base, cy_stc_crypto_sha_state_t *hashState)
+{
+    Cy_Crypto_Core_V2_Sync(base);
+
+    /* Save the remaining data to the context buffer */
+    if (hashState->blockIdx != 0U)
+    {
+        Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_STORE, hashState->block, hashState->blockIdx);
+        Cy_Crypto_Core_V2_RBStore(base, 0U, hashState->blockIdx);
+        Cy_Crypto_Core_V2_Sync(base);
+    }
+
+    /* Store the calculated hash to the context buffer */
+    Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_STORE, hashState->hash, hashState->hashSize);
+    Cy_Crypto_Core_V2_RBSwap(base);
+    Cy_Crypto_Core_V2_RBStore(base, 0U, hashState->hashSize);
+    Cy_Crypto_Core_V2_Sync(base);
+    Cy_Crypto_Core_V2_RBSwap(base);
+}
+
 /*******************************************************************************
 * Function Name: Cy_Crypto_Core_V2_Sha_Update
 ****************************************************************************//**
@@ -328,67 +428,78 @@ cy_en_crypto_status_t Cy_Crypto_Core_V2_Sha_Update(CRYPTO_Type *base,
             {
                 hashState->messageSize += messageSize;
 
-                uint32_t hashBlockIdx  = hashState->blockIdx;
-                uint32_t hashBlockSize = hashState->blockSize;
-
-                /* Load the calculated hash from the context buffer */
-                Cy_Crypto_Core_V2_RBClear(base);
-                Cy_Crypto_Core_V2_Sync(base);
-
-                Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_LOAD0, hashState->hash, hashState->hashSize);
-                Cy_Crypto_Core_V2_RBXor(base, 0U, hashState->hashSize);
-                Cy_Crypto_Core_V2_Sync(base);
-                Cy_Crypto_Core_V2_RBSwap(base);
-
-                /* Load the remaining block from the context buffer */
-                if (hashBlockIdx != 0U)
-                {
-                    Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_LOAD0, hashState->block, hashBlockIdx);
-                    Cy_Crypto_Core_V2_RBXor(base, 0U, hashBlockIdx);
-                    Cy_Crypto_Core_V2_Sync(base);
-                }
-
-                /* Start the hash calculating */
-                Cy_Crypto_Core_V2_FFContinue(base, CY_CRYPTO_V2_RB_FF_LOAD0, message, messageSize);
-
-                /* Processing the fully filled blocks with remaining buffer data */
-                while ((hashBlockIdx + messageSize) >= hashBlockSize)
-                {
-                    uint32_t tempBlockSize = hashBlockSize - hashBlockIdx;
+                Cy_Crypto_Core_V2_Sha_LoadState(base, hashState);
+                Cy_Crypto_Core_V2_Sha_ProcessData(base, hashState, message, messageSize);
+                Cy_Crypto_Core_V2_Sha_StoreState(base, hashState);
+            }
 
-                    Cy_Crypto_Core_V2_RBXor(base, hashBlockIdx, tempBlockSize);
+            tmpResult = CY_CRYPTO_SUCCESS;
+        }
+    }
 
-                    Cy_Crypto_Core_V2_Run(base, hashState->modeHw);
+    return (tmpResult);
+}
 
-                    messageSize -= tempBlockSize;
+/*******************************************************************************
+* Function Name: Cy_Crypto_Core_V2_Sha_UpdateList
+****************************************************************************//**
+*
+* Performs the SHA calculation on the message given as a scatter-gather list
+* of fragments. The hash and the not completed block stay in the Crypto
+* register buffer while all fragments are streamed, so the fragments can have
+* any size and alignment.
+*
+* \param base
+* The pointer to the CRYPTO instance.
+*
+* \param hashState
+* The pointer to the SHA context.
+*
+* \param sgList
+* The scatter-gather list of the message fragments. The dst fields are not used.
+*
+* \param sgCount
+* The number of entries in sgList.
+*
+* \return
+* \ref cy_en_crypto_status_t. CY_CRYPTO_BAD_PARAMS is returned and the SHA
+* context is not changed when an entry has a NULL src and a non-zero size.
+*
+*******************************************************************************/
+cy_en_crypto_status_t Cy_Crypto_Core_V2_Sha_UpdateList(CRYPTO_Type *base,
+                               cy_stc_crypto_sha_state_t *hashState,
+                               cy_stc_crypto_sg_entry_t const *sgList,
+                               uint32_t sgCount)
+{
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_BAD_PARAMS;
+    bool listValid = true;
+    uint32_t i;
 
-                    hashBlockIdx = 0U;
-                }
+    if ((hashState != NULL) && ((sgList != NULL) || (sgCount == 0U)))
+    {
+        /* An entry without the data is valid only when it is empty */
+        for (i = 0U; (listValid) && (i < sgCount); i++)
+        {
+            listValid = ((sgList[i].src != NULL) || (sgList[i].size == 0U));
+        }
 
-                /* The remaining block will be calculated in the Finish function */
-                hashState->blockIdx = hashBlockIdx + messageSize;
+        if ((hashState->blockSize != 0U) && (listValid))
+        {
+            if (sgCount != 0U)
+            {
+                Cy_Crypto_Core_V2_Sha_LoadState(base, hashState);
 
-                /* Load the end of the message (tail that less then block size) to the register buffer */
-                if (messageSize != 0U)
+                for (i = 0U; i < sgCount; i++)
                 {
-                    Cy_Crypto_Core_V2_RBXor(base, hashBlockIdx, messageSize);
-                    Cy_Crypto_Core_V2_Sync(base);
-                }
+                    if (sgList[i].size != 0U)
+                    {
+                        hashState->messageSize += sgList[i].size;
 
-                /* Save the remaining data to the context buffer */
-                if (hashState->blockIdx != 0U)
-                {
-                    Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_STORE, hashState->block, hashState->blockIdx);
-                    Cy_Crypto_Core_V2_RBStore(base, 0U, hashState->blockIdx);
-                    Cy_Crypto_Core_V2_Sync(base);
+                        Cy_Crypto_Core_V2_Sha_ProcessData(base, hashState, sgList[i].src, sgList[i].size);
+                    }
                 }
 
-                /* Store the calculated hash to the context buffer */
-                Cy_Crypto_Core_V2_FFStart(base, CY_CRYPTO_V2_RB_FF_STORE, hashState->hash, hashState->hashSize);
-                Cy_Crypto_Core_V2_RBSwap(base);
-                Cy_Crypto_Core_V2_RBStore(base, 0U, hashState->hashSize);
-                Cy_Crypto_Core_V2_Sync(base);
-                Cy_Crypto_Core_V2_RBSwap(base);
+                Cy_Crypto_Core_V2_Sha_StoreState(base, hashState);
             }
 
             tmpResult = CY_CRYPTO_SUCCESS;
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_crypto_server.c
-* \version 2.30.4
+* \version 2.40
 *
 * \brief
 *  This file provides the source code to the API for Crypto Server
@@ -89,7 +89,12 @@ cy_stc_crypto_context_t *processData = NULL;
 static cy_stc_crypto_server_context_t *cy_crypto_serverContext;
 
 /* Functions Prototypes */
-static cy_en_crypto_status_t Cy_Crypto_Core_CheckHwForErrors(cy_stc_crypto_context_t *cryptoContext);
+static cy_en_crypto_status_t Cy_Crypto_Core_CheckHwForErrors(cy_stc_crypto_hw_error_t *hwErrorStatus);
+
+static cy_en_crypto_status_t Cy_Crypto_Server_Run(cy_en_crypto_comm_instr_t instr, void *xdata,
+                                                  cy_stc_crypto_hw_error_t *hwErrorStatus);
+
+static void Cy_Crypto_Server_ProcessQueue(cy_stc_crypto_queue_t *queue);
 
 static cy_en_crypto_status_t Cy_Crypto_Server_Start_Common(cy_stc_crypto_config_t const *config,
                                              cy_stc_crypto_server_context_t *context);
@@ -306,6 +311,7 @@ static cy_en_crypto_status_t Cy_Crypto_Server_Start_Common(cy_stc_crypto_config_
     context->getDataHandlerPtr  = config->userGetDataHandler;
     context->errorHandlerPtr    = config->userErrorHandler;
     context->isHwErrorOccured = false;
+    context->queue = NULL;
     context->acquireNotifierConfig.intrSrc = config->acquireNotifierConfig.intrSrc;
     context->cryptoErrorIntrConfig.intrSrc = config->cryptoErrorIntrConfig.intrSrc;
 
@@ -375,6 +381,7 @@ cy_en_crypto_status_t Cy_Crypto_Server_Stop(void)
 
         cy_crypto_serverContext->getDataHandlerPtr = NULL;
         cy_crypto_serverContext->errorHandlerPtr = NULL;
+        cy_crypto_serverContext->queue = NULL;
         cy_crypto_serverContext = NULL;
         cy_CryptoFunctionTable  = NULL;
     }
@@ -407,334 +414,437 @@ void Cy_Crypto_Server_ErrorHandler(void)
     }
 }
 
-void Cy_Crypto_Server_Process(void)
+/*******************************************************************************
+* Function Name: Cy_Crypto_Server_Run
+****************************************************************************//**
+*
+* Executes one Crypto instruction received from the client, either through
+* the IPC channel or through the request queue.
+*
+* This function is internal and should not to be called directly by user software
+*
+* \param instr
+* The operation instruction code.
+*
+* \param xdata
+* The pointer to the crypto function specific context data.
+*
+* \param hwErrorStatus
+* The pointer to the structure to store the hardware error information.
+*
+* \return
+* \ref cy_en_crypto_status_t
+*
+*******************************************************************************/
+static cy_en_crypto_status_t Cy_Crypto_Server_Run(cy_en_crypto_comm_instr_t instr, void *xdata,
+                                                  cy_stc_crypto_hw_error_t *hwErrorStatus)
 {
-    cy_stc_crypto_context_t* myData = processData;
+    /* Default error */
+    cy_en_crypto_status_t tmpResult = CY_CRYPTO_HW_NOT_ENABLED;
 
-    if (myData != NULL)
+    if (CY_CRYPTO_INSTR_ENABLE == instr)
     {
-        /* Default error */
-        myData->resp = CY_CRYPTO_HW_NOT_ENABLED;
-
-        if (CY_CRYPTO_INSTR_ENABLE == myData->instr)
-        {
-            myData->resp = Cy_Crypto_Core_Enable(CY_CRYPTO_BASE);
-        }
-        else
+        tmpResult = Cy_Crypto_Core_Enable(CY_CRYPTO_BASE);
+    }
+    else
+    {
+        /* Check if Crypto HW is enabled */
+        if (Cy_Crypto_Core_IsEnabled(CY_CRYPTO_BASE))
         {
-            /* Check if Crypto HW is enabled */
-            if (Cy_Crypto_Core_IsEnabled(CY_CRYPTO_BASE))
-            {
-                myData->resp = CY_CRYPTO_NOT_SUPPORTED;
+            tmpResult = CY_CRYPTO_NOT_SUPPORTED;
 
-                if (NULL != cy_CryptoFunctionTable)
+            if (NULL != cy_CryptoFunctionTable)
+            {
+                switch(instr)
                 {
-                    switch(myData->instr)
+                case CY_CRYPTO_INSTR_DISABLE:
+                     tmpResult = Cy_Crypto_Core_Disable(CY_CRYPTO_BASE);
+                    break;
+
+                case CY_CRYPTO_INSTR_SRV_INFO:
+                     tmpResult = Cy_Crypto_Core_GetLibInfo((cy_en_crypto_lib_info_t*)xdata);
+                    break;
+
+                /* MEM_BUFF memory management */
+                case CY_CRYPTO_INSTR_MEMBUF_SET:
+                    {
+                        cy_stc_crypto_context_str_t *cfContext = xdata;
+                        tmpResult = Cy_Crypto_Core_SetVuMemoryAddress(CY_CRYPTO_BASE, cfContext->src0, cfContext->dataSize);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_MEMBUF_ADDR:
+                    {
+                        cy_stc_crypto_context_str_t *cfContext = xdata;
+                        *(uint32_t *)(cfContext->dst) = (uint32_t)Cy_Crypto_Core_GetVuMemoryAddress(CY_CRYPTO_BASE);
+                        tmpResult = CY_CRYPTO_SUCCESS;
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_MEMBUF_SIZE:
+                    {
+                        cy_stc_crypto_context_str_t *cfContext = xdata;
+                        *(uint32_t *)(cfContext->dst) = Cy_Crypto_Core_GetVuMemorySize(CY_CRYPTO_BASE);
+                        tmpResult = CY_CRYPTO_SUCCESS;
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_PRNG_INIT:
+                    if (NULL != cy_CryptoFunctionTable->prngInitFunc)
+                    {
+                        cy_stc_crypto_context_prng_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->prngInitFunc)(CY_CRYPTO_BASE,
+                            cfContext->lfsr32InitState, cfContext->lfsr31InitState, cfContext->lfsr29InitState);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_PRNG:
+                    if (NULL != cy_CryptoFunctionTable->prngFunc)
+                    {
+                        cy_stc_crypto_context_prng_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->prngFunc)(CY_CRYPTO_BASE,
+                            cfContext->max, cfContext->prngNum);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_TRNG:
+                    if (NULL != cy_CryptoFunctionTable->trngFunc)
+                    {
+                        cy_stc_crypto_context_trng_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->trngFunc)(CY_CRYPTO_BASE,
+                            cfContext->GAROPol, cfContext->FIROPol, cfContext->max, cfContext->trngNum);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_AES_INIT:
+                    if (NULL != cy_CryptoFunctionTable->aesInitFunc)
+                    {
+                        cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)xdata;
+                        tmpResult =
+                            (cy_CryptoFunctionTable->aesInitFunc)(CY_CRYPTO_BASE,
+                                (uint8_t*)cfContext->key, cfContext->keyLength, &cfContext->aesState, (cy_stc_crypto_aes_buffers_t *)(Cy_Crypto_Core_GetVuMemoryAddress(CY_CRYPTO_BASE)));
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_AES_ECB:
+                    if (NULL != cy_CryptoFunctionTable->aesEcbFunc)
+                    {
+                        cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)xdata;
+                        tmpResult =
+                            (cy_CryptoFunctionTable->aesEcbFunc)(CY_CRYPTO_BASE,
+                            cfContext->dirMode,
+                            (uint8_t*)cfContext->dst,
+                            (uint8_t*)cfContext->src,
+                            &cfContext->aesState);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_AES_CBC:
+                    if (NULL != cy_CryptoFunctionTable->aesCbcFunc)
                     {
-                    case CY_CRYPTO_INSTR_DISABLE:
-                         myData->resp = Cy_Crypto_Core_Disable(CY_CRYPTO_BASE);
-                        break;
-
-                    case CY_CRYPTO_INSTR_SRV_INFO:
-                         myData->resp = Cy_Crypto_Core_GetLibInfo((cy_en_crypto_lib_info_t*)myData->xdata);
-                        break;
-
-                    /* MEM_BUFF memory management */
-                    case CY_CRYPTO_INSTR_MEMBUF_SET:
-                        {
-                            cy_stc_crypto_context_str_t *cfContext = myData->xdata;
-                            myData->resp = Cy_Crypto_Core_SetVuMemoryAddress(CY_CRYPTO_BASE, cfContext->src0, cfContext->dataSize);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_MEMBUF_ADDR:
-                        {
-                            cy_stc_crypto_context_str_t *cfContext = myData->xdata;
-                            *(uint32_t *)(cfContext->dst) = (uint32_t)Cy_Crypto_Core_GetVuMemoryAddress(CY_CRYPTO_BASE);
-                            myData->resp = CY_CRYPTO_SUCCESS;
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_MEMBUF_SIZE:
-                        {
-                            cy_stc_crypto_context_str_t *cfContext = myData->xdata;
-                            *(uint32_t *)(cfContext->dst) = Cy_Crypto_Core_GetVuMemorySize(CY_CRYPTO_BASE);
-                            myData->resp = CY_CRYPTO_SUCCESS;
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_PRNG_INIT:
-                        if (NULL != cy_CryptoFunctionTable->prngInitFunc)
-                        {
-                            cy_stc_crypto_context_prng_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->prngInitFunc)(CY_CRYPTO_BASE,
-                                cfContext->lfsr32InitState, cfContext->lfsr31InitState, cfContext->lfsr29InitState);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_PRNG:
-                        if (NULL != cy_CryptoFunctionTable->prngFunc)
-                        {
-                            cy_stc_crypto_context_prng_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->prngFunc)(CY_CRYPTO_BASE,
-                                cfContext->max, cfContext->prngNum);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_TRNG:
-                        if (NULL != cy_CryptoFunctionTable->trngFunc)
-                        {
-                            cy_stc_crypto_context_trng_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->trngFunc)(CY_CRYPTO_BASE,
-                                cfContext->GAROPol, cfContext->FIROPol, cfContext->max, cfContext->trngNum);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_AES_INIT:
-                        if (NULL != cy_CryptoFunctionTable->aesInitFunc)
-                        {
-                            cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)myData->xdata;
-                            myData->resp =
-                                (cy_CryptoFunctionTable->aesInitFunc)(CY_CRYPTO_BASE,
-                                    (uint8_t*)cfContext->key, cfContext->keyLength, &cfContext->aesState, (cy_stc_crypto_aes_buffers_t *)(Cy_Crypto_Core_GetVuMemoryAddress(CY_CRYPTO_BASE)));
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_AES_ECB:
-                        if (NULL != cy_CryptoFunctionTable->aesEcbFunc)
-                        {
-                            cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)myData->xdata;
-                            myData->resp =
-                                (cy_CryptoFunctionTable->aesEcbFunc)(CY_CRYPTO_BASE,
+                        cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)xdata;
+                        tmpResult =
+                            (cy_CryptoFunctionTable->aesCbcFunc)(CY_CRYPTO_BASE,
                                 cfContext->dirMode,
+                                cfContext->srcSize,
+                                (uint8_t*)cfContext->ivPtr,
                                 (uint8_t*)cfContext->dst,
                                 (uint8_t*)cfContext->src,
                                 &cfContext->aesState);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_AES_CBC:
-                        if (NULL != cy_CryptoFunctionTable->aesCbcFunc)
-                        {
-                            cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)myData->xdata;
-                            myData->resp =
-                                (cy_CryptoFunctionTable->aesCbcFunc)(CY_CRYPTO_BASE,
-                                    cfContext->dirMode,
-                                    cfContext->srcSize,
-                                    (uint8_t*)cfContext->ivPtr,
-                                    (uint8_t*)cfContext->dst,
-                                    (uint8_t*)cfContext->src,
-                                    &cfContext->aesState);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_AES_CFB:
-                        if (NULL != cy_CryptoFunctionTable->aesCfbFunc)
-                        {
-                            cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)myData->xdata;
-                            myData->resp =
-                                (cy_CryptoFunctionTable->aesCfbFunc)(CY_CRYPTO_BASE,
-                                    cfContext->dirMode,
-                                    cfContext->srcSize,
-                                    (uint8_t*)cfContext->ivPtr,
-                                    (uint8_t*)cfContext->dst,
-                                    (uint8_t*)cfContext->src,
-                                    &cfContext->aesState);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_AES_CTR:
-                        if (NULL != cy_CryptoFunctionTable->aesCtrFunc)
-                        {
-                            cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)myData->xdata;
-                            myData->resp =
-                                (cy_CryptoFunctionTable->aesCtrFunc)(CY_CRYPTO_BASE,
-                                    cfContext->srcSize,
-                                    cfContext->srcOffset,
-                                    (uint8_t*)cfContext->ivPtr,
-                                    (uint8_t*)cfContext->streamBlock,
-                                    (uint8_t*)cfContext->dst,
-                                    (uint8_t*)cfContext->src,
-                                    &cfContext->aesState);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_CMAC:
-                        if (NULL != cy_CryptoFunctionTable->cmacFunc)
-                        {
-                            cy_stc_crypto_context_aes_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->cmacFunc)(CY_CRYPTO_BASE,
-                                (uint8_t*)cfContext->src, cfContext->srcSize, (uint8_t*)cfContext->key, cfContext->keyLength,
-                                (uint8_t*)cfContext->dst, &cfContext->aesState);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_SHA:
-                        if (NULL != cy_CryptoFunctionTable->shaFunc)
-                        {
-                            cy_stc_crypto_context_sha_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->shaFunc)(CY_CRYPTO_BASE,
-                                (uint8_t *)cfContext->message, cfContext->messageSize,
-                                (uint8_t *)cfContext->dst, cfContext->mode);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_HMAC:
-                        if (NULL != cy_CryptoFunctionTable->hmacFunc)
-                        {
-                            cy_stc_crypto_context_sha_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->hmacFunc)(CY_CRYPTO_BASE,
-                                (uint8_t *)cfContext->dst, (uint8_t *)cfContext->message, cfContext->messageSize,
-                                (uint8_t *)cfContext->key, cfContext->keyLength, cfContext->mode);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_MEM_CPY:
-                        if (NULL != cy_CryptoFunctionTable->memCpyFunc)
-                        {
-                            cy_stc_crypto_context_str_t *cfContext = myData->xdata;
-                            (cy_CryptoFunctionTable->memCpyFunc)(CY_CRYPTO_BASE,
-                                cfContext->dst, cfContext->src0, (uint16_t)cfContext->dataSize);
-                            myData->resp = CY_CRYPTO_SUCCESS;
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_MEM_SET:
-                        if (NULL != cy_CryptoFunctionTable->memSetFunc)
-                        {
-                            cy_stc_crypto_context_str_t *cfContext = myData->xdata;
-                            (cy_CryptoFunctionTable->memSetFunc)(CY_CRYPTO_BASE,
-                                cfContext->dst, (uint8_t)cfContext->data, (uint16_t)cfContext->dataSize);
-                            myData->resp = CY_CRYPTO_SUCCESS;
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_MEM_CMP:
-                        if (NULL != cy_CryptoFunctionTable->memCmpFunc)
-                        {
-                            cy_stc_crypto_context_str_t *cfContext = myData->xdata;
-                            *(uint32_t *)(cfContext->dst) =
-                                (cy_CryptoFunctionTable->memCmpFunc)(CY_CRYPTO_BASE,
-                                    cfContext->src0, cfContext->src1, (uint16_t)cfContext->dataSize);
-                            myData->resp = CY_CRYPTO_SUCCESS;
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_MEM_XOR:
-                        if (NULL != cy_CryptoFunctionTable->memXorFunc)
-                        {
-                            cy_stc_crypto_context_str_t *cfContext = myData->xdata;
-                            (cy_CryptoFunctionTable->memXorFunc)(CY_CRYPTO_BASE,
-                                cfContext->dst, cfContext->src0, cfContext->src1, (uint16_t)cfContext->dataSize);
-                            myData->resp = CY_CRYPTO_SUCCESS;
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_CRC_INIT:
-                        if (NULL != cy_CryptoFunctionTable->crcInitFunc)
-                        {
-                            cy_stc_crypto_context_crc_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->crcInitFunc)(CY_CRYPTO_BASE,
-                                cfContext->polynomial, cfContext->dataReverse, cfContext->dataXor, cfContext->remReverse, cfContext->remXor);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_CRC:
-                        if (NULL != cy_CryptoFunctionTable->crcFunc)
-                        {
-                            cy_stc_crypto_context_crc_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->crcFunc)(CY_CRYPTO_BASE,
-                                cfContext->crc, cfContext->data, cfContext->dataSize, cfContext->lfsrInitState);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_DES:
-                        if (NULL != cy_CryptoFunctionTable->desFunc)
-                        {
-                            cy_stc_crypto_context_des_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->desFunc)(CY_CRYPTO_BASE,
-                                cfContext->dirMode, (uint8_t const *)cfContext->key, (uint8_t *)cfContext->dst, (uint8_t const *)cfContext->src);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_3DES:
-                        if (NULL != cy_CryptoFunctionTable->tdesFunc)
-                        {
-                            cy_stc_crypto_context_des_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->tdesFunc)(CY_CRYPTO_BASE,
-                                cfContext->dirMode, (uint8_t const *)cfContext->key, (uint8_t *)cfContext->dst, (uint8_t  const *)cfContext->src);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_RSA_PROC:
-                        if (NULL != cy_CryptoFunctionTable->rsaProcFunc)
-                        {
-                            cy_stc_crypto_context_rsa_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->rsaProcFunc)(CY_CRYPTO_BASE,
-                                cfContext->key, (uint8_t const *)cfContext->message, cfContext->messageSize, (uint8_t *)cfContext->result);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_RSA_COEF:
-                        if (NULL != cy_CryptoFunctionTable->rsaCoefFunc)
-                        {
-                            cy_stc_crypto_context_rsa_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->rsaCoefFunc)(CY_CRYPTO_BASE, cfContext->key);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_RSA_VER:
-                        if (NULL != cy_CryptoFunctionTable->rsaVerifyFunc)
-                        {
-                            cy_stc_crypto_context_rsa_ver_t *cfContext = myData->xdata;
-                            myData->resp = (cy_CryptoFunctionTable->rsaVerifyFunc)(CY_CRYPTO_BASE,
-                                cfContext->verResult, cfContext->digestType, (uint8_t const *)cfContext->hash,
-                                (uint8_t const *)cfContext->decryptedSignature, cfContext->decryptedSignatureLength);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_ECDSA_SIGN:
-                        {
-                            cy_stc_crypto_context_ecc_t *cfContext = myData->xdata;
-                            myData->resp = Cy_Crypto_Core_ECC_SignHash(CY_CRYPTO_BASE,
-                                cfContext->src0, cfContext->datalen, cfContext->dst0,
-                                cfContext->key, cfContext->src1);
-                        }
-                        break;
-
-                    case CY_CRYPTO_INSTR_ECDSA_VER:
-                        {
-                            cy_stc_crypto_context_ecc_t *cfContext = myData->xdata;
-                            myData->resp = Cy_Crypto_Core_ECC_VerifyHash(CY_CRYPTO_BASE,
-                                cfContext->src1, cfContext->src0, cfContext->datalen,
-                                cfContext->dst0, cfContext->key);
-                        }
-                        break;
-
-                    default:
-                        myData->resp = CY_CRYPTO_NOT_SUPPORTED;
-                        break;
                     }
-                }
+                    break;
 
-                if (CY_CRYPTO_SUCCESS == myData->resp)
-                {
-                    myData->resp = Cy_Crypto_Core_CheckHwForErrors(myData);
+                case CY_CRYPTO_INSTR_AES_CFB:
+                    if (NULL != cy_CryptoFunctionTable->aesCfbFunc)
+                    {
+                        cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)xdata;
+                        tmpResult =
+                            (cy_CryptoFunctionTable->aesCfbFunc)(CY_CRYPTO_BASE,
+                                cfContext->dirMode,
+                                cfContext->srcSize,
+                                (uint8_t*)cfContext->ivPtr,
+                                (uint8_t*)cfContext->dst,
+                                (uint8_t*)cfContext->src,
+                                &cfContext->aesState);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_AES_CTR:
+                    if (NULL != cy_CryptoFunctionTable->aesCtrFunc)
+                    {
+                        cy_stc_crypto_context_aes_t *cfContext = (cy_stc_crypto_context_aes_t *)xdata;
+                        tmpResult =
+                            (cy_CryptoFunctionTable->aesCtrFunc)(CY_CRYPTO_BASE,
+                                cfContext->srcSize,
+                                cfContext->srcOffset,
+                                (uint8_t*)cfContext->ivPtr,
+                                (uint8_t*)cfContext->streamBlock,
+                                (uint8_t*)cfContext->dst,
+                                (uint8_t*)cfContext->src,
+                                &cfContext->aesState);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_CMAC:
+                    if (NULL != cy_CryptoFunctionTable->cmacFunc)
+                    {
+                        cy_stc_crypto_context_aes_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->cmacFunc)(CY_CRYPTO_BASE,
+                            (uint8_t*)cfContext->src, cfContext->srcSize, (uint8_t*)cfContext->key, cfContext->keyLength,
+                            (uint8_t*)cfContext->dst, &cfContext->aesState);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_SHA:
+                    if (NULL != cy_CryptoFunctionTable->shaFunc)
+                    {
+                        cy_stc_crypto_context_sha_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->shaFunc)(CY_CRYPTO_BASE,
+                            (uint8_t *)cfContext->message, cfContext->messageSize,
+                            (uint8_t *)cfContext->dst, cfContext->mode);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_HMAC:
+                    if (NULL != cy_CryptoFunctionTable->hmacFunc)
+                    {
+                        cy_stc_crypto_context_sha_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->hmacFunc)(CY_CRYPTO_BASE,
+                            (uint8_t *)cfContext->dst, (uint8_t *)cfContext->message, cfContext->messageSize,
+                            (uint8_t *)cfContext->key, cfContext->keyLength, cfContext->mode);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_MEM_CPY:
+                    if (NULL != cy_CryptoFunctionTable->memCpyFunc)
+                    {
+                        cy_stc_crypto_context_str_t *cfContext = xdata;
+                        (cy_CryptoFunctionTable->memCpyFunc)(CY_CRYPTO_BASE,
+                            cfContext->dst, cfContext->src0, (uint16_t)cfContext->dataSize);
+                        tmpResult = CY_CRYPTO_SUCCESS;
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_MEM_SET:
+                    if (NULL != cy_CryptoFunctionTable->memSetFunc)
+                    {
+                        cy_stc_crypto_context_str_t *cfContext = xdata;
+                        (cy_CryptoFunctionTable->memSetFunc)(CY_CRYPTO_BASE,
+                            cfContext->dst, (uint8_t)cfContext->data, (uint16_t)cfContext->dataSize);
+                        tmpResult = CY_CRYPTO_SUCCESS;
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_MEM_CMP:
+                    if (NULL != cy_CryptoFunctionTable->memCmpFunc)
+                    {
+                        cy_stc_crypto_context_str_t *cfContext = xdata;
+                        *(uint32_t *)(cfContext->dst) =
+                            (cy_CryptoFunctionTable->memCmpFunc)(CY_CRYPTO_BASE,
+                                cfContext->src0, cfContext->src1, (uint16_t)cfContext->dataSize);
+                        tmpResult = CY_CRYPTO_SUCCESS;
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_MEM_XOR:
+                    if (NULL != cy_CryptoFunctionTable->memXorFunc)
+                    {
+                        cy_stc_crypto_context_str_t *cfContext = xdata;
+                        (cy_CryptoFunctionTable->memXorFunc)(CY_CRYPTO_BASE,
+                            cfContext->dst, cfContext->src0, cfContext->src1, (uint16_t)cfContext->dataSize);
+                        tmpResult = CY_CRYPTO_SUCCESS;
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_CRC_INIT:
+                    if (NULL != cy_CryptoFunctionTable->crcInitFunc)
+                    {
+                        cy_stc_crypto_context_crc_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->crcInitFunc)(CY_CRYPTO_BASE,
+                            cfContext->polynomial, cfContext->dataReverse, cfContext->dataXor, cfContext->remReverse, cfContext->remXor);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_CRC:
+                    if (NULL != cy_CryptoFunctionTable->crcFunc)
+                    {
+                        cy_stc_crypto_context_crc_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->crcFunc)(CY_CRYPTO_BASE,
+                            cfContext->crc, cfContext->data, cfContext->dataSize, cfContext->lfsrInitState);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_DES:
+                    if (NULL != cy_CryptoFunctionTable->desFunc)
+                    {
+                        cy_stc_crypto_context_des_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->desFunc)(CY_CRYPTO_BASE,
+                            cfContext->dirMode, (uint8_t const *)cfContext->key, (uint8_t *)cfContext->dst, (uint8_t const *)cfContext->src);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_3DES:
+                    if (NULL != cy_CryptoFunctionTable->tdesFunc)
+                    {
+                        cy_stc_crypto_context_des_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->tdesFunc)(CY_CRYPTO_BASE,
+                            cfContext->dirMode, (uint8_t const *)cfContext->key, (uint8_t *)cfContext->dst, (uint8_t  const *)cfContext->src);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_RSA_PROC:
+                    if (NULL != cy_CryptoFunctionTable->rsaProcFunc)
+                    {
+                        cy_stc_crypto_context_rsa_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->rsaProcFunc)(CY_CRYPTO_BASE,
+                            cfContext->key, (uint8_t const *)cfContext->message, cfContext->messageSize, (uint8_t *)cfContext->result);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_RSA_COEF:
+                    if (NULL != cy_CryptoFunctionTable->rsaCoefFunc)
+                    {
+                        cy_stc_crypto_context_rsa_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->rsaCoefFunc)(CY_CRYPTO_BASE, cfContext->key);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_RSA_VER:
+                    if (NULL != cy_CryptoFunctionTable->rsaVerifyFunc)
+                    {
+                        cy_stc_crypto_context_rsa_ver_t *cfContext = xdata;
+                        tmpResult = (cy_CryptoFunctionTable->rsaVerifyFunc)(CY_CRYPTO_BASE,
+                            cfContext->verResult, cfContext->digestType, (uint8_t const *)cfContext->hash,
+                            (uint8_t const *)cfContext->decryptedSignature, cfContext->decryptedSignatureLength);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_ECDSA_SIGN:
+                    {
+                        cy_stc_crypto_context_ecc_t *cfContext = xdata;
+                        tmpResult = Cy_Crypto_Core_ECC_SignHash(CY_CRYPTO_BASE,
+                            cfContext->src0, cfContext->datalen, cfContext->dst0,
+                            cfContext->key, cfContext->src1);
+                    }
+                    break;
+
+                case CY_CRYPTO_INSTR_ECDSA_VER:
+                    {
+                        cy_stc_crypto_context_ecc_t *cfContext = xdata;
+                        tmpResult = Cy_Crypto_Core_ECC_VerifyHash(CY_CRYPTO_BASE,
+                            cfContext->src1, cfContext->src0, cfContext->datalen,
+                            cfContext->dst0, cfContext->key);
+                    }
+                    break;
+
+                default:
+                    tmpResult = CY_CRYPTO_NOT_SUPPORTED;
+                    break;
                 }
             }
+
+            if (CY_CRYPTO_SUCCESS == tmpResult)
+            {
+                tmpResult = Cy_Crypto_Core_CheckHwForErrors(hwErrorStatus);
+            }
         }
+    }
+
+    return (tmpResult);
+}
+
+/*******************************************************************************
+* Function Name: Cy_Crypto_Server_ProcessQueue
+****************************************************************************//**
+*
+* Drains the request queue registered by the client. All requests submitted
+* before the queue is checked are processed as one batch and the client is
+* notified once per batch.
+*
+* This function is internal and should not to be called directly by user software
+*
+* \param queue
+* The pointer to the \ref cy_stc_crypto_queue_t structure.
+*
+*******************************************************************************/
+static void Cy_Crypto_Server_ProcessQueue(cy_stc_crypto_queue_t *queue)
+{
+    cy_stc_crypto_request_t *request;
+    uint32_t done = queue->done;
+    uint32_t head = queue->head;
+
+    while (done != head)
+    {
+        /* Read the requests only after the head index */
+        __DMB();
+
+        do
+        {
+            request = queue->requests[done & (queue->size - 1u)];
+
+            request->resp = Cy_Crypto_Server_Run(request->instr, request->xdata, &request->hwErrorStatus);
+
+            /* The response must be visible before the completion flag */
+            __DMB();
+            request->isComplete = true;
+
+            done++;
+        } while (done != head);
+
+        queue->done = done;
+
+        /* Notify the client once per batch */
+        Cy_IPC_Drv_ReleaseNotify(Cy_IPC_Drv_GetIpcBaseAddress(cy_crypto_serverContext->ipcChannel),
+                                 (1uL << queue->releaseNotifierChannel));
+
+        /* Pick up the requests submitted while the batch was processed */
+        head = queue->head;
+    }
+}
+
+void Cy_Crypto_Server_Process(void)
+{
+    cy_stc_crypto_context_t* myData = processData;
+    uint32_t interruptState;
+
+    if (myData != NULL)
+    {
+        if (CY_CRYPTO_INSTR_QUEUE_INIT == myData->instr)
+        {
+            cy_crypto_serverContext->queue = (cy_stc_crypto_queue_t *)myData->xdata;
+            myData->resp = CY_CRYPTO_SUCCESS;
+        }
+        else
+        {
+            myData->resp = Cy_Crypto_Server_Run(myData->instr, myData->xdata, &myData->hwErrorStatus);
+        }
+
+        /* Clear the message and release the channel in one critical section:
+         * the Notify interrupt between them reads the message again from the
+         * still locked channel, and the one after them may already bring
+         * the next message.
+         */
+        interruptState = Cy_SysLib_EnterCriticalSection();
 
         processData = NULL;
 
         /* Release the Crypto IPC channel with the Release interrupt */
         (void)Cy_IPC_Drv_LockRelease(Cy_IPC_Drv_GetIpcBaseAddress(myData->ipcChannel),
                 (NULL != myData->userCompleteCallback) ? (1uL << myData->releaseNotifierChannel) : CY_IPC_NO_NOTIFICATION);
+
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    if ((NULL != cy_crypto_serverContext) && (NULL != cy_crypto_serverContext->queue))
+    {
+        Cy_Crypto_Server_ProcessQueue(cy_crypto_serverContext->queue);
     }
 }
 
 void Cy_Crypto_Server_GetDataHandler(void)
 {
     uint32_t interruptMasked;
+    cy_stc_crypto_context_t *msgData = NULL;
 
     /*
      * Check that there is really the IPC Crypto Notify interrupt,
@@ -748,12 +858,19 @@ void Cy_Crypto_Server_GetDataHandler(void)
     {
         Cy_IPC_Drv_ClearInterrupt(Cy_IPC_Drv_GetIntrBaseAddr(cy_crypto_serverContext->acquireNotifierChannel), CY_IPC_NO_NOTIFICATION, interruptMasked);
 
-        if(CY_IPC_DRV_SUCCESS == Cy_IPC_Drv_ReadMsgPtr(Cy_IPC_Drv_GetIpcBaseAddress(cy_crypto_serverContext->ipcChannel), (void**)&processData))
+        /*
+         * The notification is sent either with the locked IPC channel or by
+         * the request queue submission, which does not lock the channel.
+         * The message is valid only when the channel is locked.
+         */
+        if (CY_IPC_DRV_SUCCESS == Cy_IPC_Drv_ReadMsgPtr(Cy_IPC_Drv_GetIpcBaseAddress(cy_crypto_serverContext->ipcChannel), (void**)&msgData))
         {
-            if (cy_crypto_serverContext->getDataHandlerPtr == NULL)
-            {
-                Cy_Crypto_Server_Process();
-            }
+            processData = msgData;
+        }
+
+        if (cy_crypto_serverContext->getDataHandlerPtr == NULL)
+        {
+            Cy_Crypto_Server_Process();
         }
     }
 }
@@ -772,21 +889,20 @@ void Cy_Crypto_Server_GetDataHandler(void)
 * \param base
 * The pointer to the CRYPTO instance.
 *
-* \param cryptoContext
-* The pointer to cy_stc_crypto_context_t structure which stores
-* the Crypto driver context.
+* \param hwErrorStatus
+* The pointer to the structure to store the hardware error information.
 *
 * \return
 * \ref cy_en_crypto_status_t
 *
 *******************************************************************************/
-static cy_en_crypto_status_t Cy_Crypto_Core_CheckHwForErrors(cy_stc_crypto_context_t *cryptoContext)
+static cy_en_crypto_status_t Cy_Crypto_Core_CheckHwForErrors(cy_stc_crypto_hw_error_t *hwErrorStatus)
 {
     cy_en_crypto_status_t tmpResult = CY_CRYPTO_SUCCESS;
     uint32_t myErrorStatus0;
     uint32_t myErrorStatus1;
 
-    CY_ASSERT(NULL != cryptoContext);
+    CY_ASSERT(NULL != hwErrorStatus);
 
     if (false == cy_crypto_serverContext->isHwErrorOccured)
     {
@@ -815,8 +931,8 @@ static cy_en_crypto_status_t Cy_Crypto_Core_CheckHwForErrors(cy_stc_crypto_conte
         cy_crypto_serverContext->isHwErrorOccured = false;
     }
 
-    cryptoContext->hwErrorStatus.errorStatus0 = myErrorStatus0;
-    cryptoContext->hwErrorStatus.errorStatus1 = myErrorStatus1;
+    hwErrorStatus->errorStatus0 = myErrorStatus0;
+    hwErrorStatus->errorStatus1 = myErrorStatus1;
 
     return (tmpResult);
 }
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_flash.c
-* \version 3.40
+* \version 3.50
 *
 * \brief
 * Provides the public functions for the API for the PSoC 6 Flash Driver.
@@ -203,6 +203,7 @@ typedef cy_en_flashdrv_status_t (*Cy_Flash_Proxy)(cy_stc_flash_context_t *contex
 
 /* Static functions */
 static bool Cy_Flash_BoundsCheck(uint32_t flashAddr);
+static bool Cy_Flash_RegionBoundsCheck(uint32_t rowAddr, uint32_t numberOfRows);
 static uint32_t Cy_Flash_GetRowNum(uint32_t flashAddr);
 static cy_en_flashdrv_status_t Cy_Flash_ProcessOpcode(uint32_t opcode);
 static cy_en_flashdrv_status_t Cy_Flash_OperationStatus(void);
@@ -1229,6 +1230,150 @@ cy_en_flashdrv_status_t Cy_Flash_StartProgram(uint32_t rowAddr, const uint32_t*
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_Flash_StartProgramRegion
+****************************************************************************//**
+*
+* Starts writing several consecutive flash rows. The function starts erasing
+* the first row and returns immediately. The erase and program operations of
+* the rows are then started by \ref Cy_Flash_ProgramRegionProcess.
+* The same restrictions as for Cy_Flash_StartEraseRow() and
+* Cy_Flash_StartProgram() apply until the region is written.
+*
+* \param region The pointer to the region structure. The structure and the
+* data must not be modified until the region status is not
+* \ref CY_FLASH_DRV_OPCODE_BUSY. All the rows must be in the same flash area
+* (Application, Work or Supervisory flash).
+*
+* \return Returns the status of the Flash operation,
+* see \ref cy_en_flashdrv_status_t. If \ref CY_FLASH_DRV_IPC_BUSY is returned,
+* the region is not started and the function can be called again.
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t Cy_Flash_StartProgramRegion(cy_stc_flash_region_t *region)
+{
+    cy_en_flashdrv_status_t result = CY_FLASH_DRV_INVALID_INPUT_PARAMETERS;
+
+    if ((NULL != region) && (NULL != region->data) && (0UL < region->numberOfRows) &&
+        (Cy_Flash_RegionBoundsCheck(region->rowAddr, region->numberOfRows) != false))
+    {
+        region->rowsDone = 0UL;
+        region->programPhase = false;
+        region->retryStart = false;
+
+        result = Cy_Flash_StartEraseRow(region->rowAddr);
+
+        region->status = (CY_FLASH_DRV_OPERATION_STARTED == result) ? CY_FLASH_DRV_OPCODE_BUSY : result;
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_Flash_ProgramRegionProcess
+****************************************************************************//**
+*
+* Advances the region programming started by \ref Cy_Flash_StartProgramRegion.
+* If the current flash operation is complete, the function starts the next
+* one: the program of the erased row or the erase of the next row. After each
+* programmed row, the region callback is called. When all the rows are
+* written, the flash cache is cleared and the callback is called with the
+* final status.
+*
+* Call this function periodically, for example, from a timer interrupt.
+* It does not wait for the flash operation. If the next operation cannot be
+* started because the IPC structure is busy (\ref CY_FLASH_DRV_IPC_BUSY),
+* the region stays busy and the operation is started again on the next call.
+*
+* \param region The pointer to the region structure.
+*
+* \return \ref CY_FLASH_DRV_OPCODE_BUSY while the region is being written,
+* otherwise the final status of the region.
+*
+*******************************************************************************/
+cy_en_flashdrv_status_t Cy_Flash_ProgramRegionProcess(cy_stc_flash_region_t *region)
+{
+    cy_en_flashdrv_status_t result = CY_FLASH_DRV_INVALID_INPUT_PARAMETERS;
+    uint32_t rowAddr;
+
+    if (NULL != region)
+    {
+        result = region->status;
+
+        if (CY_FLASH_DRV_OPCODE_BUSY == result)
+        {
+            /* A failed start overwrites the previous operation result, so the
+            * status is not checked when the start is repeated.
+            */
+            result = region->retryStart ? CY_FLASH_DRV_SUCCESS : Cy_Flash_OperationStatus();
+
+            if (CY_FLASH_DRV_SUCCESS == result)
+            {
+                rowAddr = region->rowAddr + (region->rowsDone * CY_FLASH_SIZEOF_ROW);
+
+                if (!region->programPhase)
+                {
+                    /* The row is erased - program it */
+                    result = Cy_Flash_StartProgram(rowAddr,
+                                                   &region->data[region->rowsDone * CY_FLASH_SIZEOF_ROW_LONG_UNITS]);
+
+                    if (CY_FLASH_DRV_OPERATION_STARTED == result)
+                    {
+                        region->programPhase = true;
+                    }
+                }
+                else if ((region->rowsDone + 1UL) < region->numberOfRows)
+                {
+                    /* Erase the next row before reporting the progress */
+                    result = Cy_Flash_StartEraseRow(rowAddr + CY_FLASH_SIZEOF_ROW);
+
+                    if (CY_FLASH_DRV_OPERATION_STARTED == result)
+                    {
+                        region->programPhase = false;
+                        region->rowsDone++;
+
+                        if (NULL != region->callback)
+                        {
+                            region->callback(region);
+                        }
+                    }
+                }
+                else
+                {
+                    /* The last row is programmed */
+                    region->programPhase = false;
+                    region->rowsDone++;
+                }
+
+                /* Keep the row position and start the same operation on the next call */
+                region->retryStart = (CY_FLASH_DRV_IPC_BUSY == result);
+
+                if ((CY_FLASH_DRV_OPERATION_STARTED == result) || (region->retryStart))
+                {
+                    result = CY_FLASH_DRV_OPCODE_BUSY;
+                }
+            }
+
+            if (CY_FLASH_DRV_OPCODE_BUSY != result)
+            {
+                /* The region is complete or failed */
+                Cy_SysLib_ClearFlashCacheAndBuffer();
+
+                region->status = result;
+
+                if (NULL != region->callback)
+                {
+                    region->callback(region);
+                }
+            }
+        }
+    }
+
+    return (result);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_Flash_RowChecksum
 ****************************************************************************//**
@@ -1426,6 +1571,49 @@ static bool Cy_Flash_BoundsCheck(uint32_t flashAddr)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_Flash_RegionBoundsCheck
+****************************************************************************//**
+*
+* The function checks the following conditions:
+*  - if the first row address is equal to start address of the row
+*  - if all the rows are in one of the Application flash, Work flash or
+*    Supervisory flash
+*
+* \param rowAddr The address of the first row.
+*
+* \param numberOfRows The number of rows.
+*
+* \return false - out of bound, true - in flash bounds
+*
+*******************************************************************************/
+static bool Cy_Flash_RegionBoundsCheck(uint32_t rowAddr, uint32_t numberOfRows)
+{
+    uint32_t areaEnd = 0UL;
+
+    if ((rowAddr >= CY_FLASH_BASE) && (rowAddr < (CY_FLASH_BASE + CY_FLASH_SIZE)))
+    {
+        areaEnd = CY_FLASH_BASE + CY_FLASH_SIZE;
+    }
+    else if ((rowAddr >= CY_EM_EEPROM_BASE) && (rowAddr < (CY_EM_EEPROM_BASE + CY_EM_EEPROM_SIZE)))
+    {
+        areaEnd = CY_EM_EEPROM_BASE + CY_EM_EEPROM_SIZE;
+    }
+    else if ((rowAddr >= SFLASH_BASE) && (rowAddr < (SFLASH_BASE + SFLASH_SECTION_SIZE)))
+    {
+        areaEnd = SFLASH_BASE + SFLASH_SECTION_SIZE;
+    }
+    else
+    {
+        /* The address is out of the flash */
+    }
+
+    /* The rows are compared instead of the last row address to avoid the overflow */
+    return ((Cy_Flash_BoundsCheck(rowAddr) != false) && (0UL != areaEnd) &&
+            (numberOfRows <= ((areaEnd - rowAddr) / CY_FLASH_SIZEOF_ROW)));
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_Flash_ProcessOpcode
 ****************************************************************************//**
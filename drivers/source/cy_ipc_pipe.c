@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_ipc_pipe.c
-* \version 1.40.2
+* \version 1.50
 *
 *  Description:
 *   IPC Pipe Driver - This source file includes code for the Pipe layer on top
@@ -24,10 +24,23 @@
 *******************************************************************************/
 
 #include "cy_ipc_pipe.h"
+#include <string.h>
 
 /* Define a pointer to array of endPoints. */
 static cy_stc_ipc_pipe_ep_t * cy_ipc_pipe_epArray = NULL;
 
+static void Cy_IPC_Pipe_Dispatch(cy_stc_ipc_pipe_ep_t const * endpoint, uint32_t * msgPtr);
+static void Cy_IPC_Pipe_RingProcess(cy_stc_ipc_pipe_ep_t * endpoint);
+
+#if (CY_IPC_PIPE_STATS != 0U)
+/* The timestamp function used by the pipe statistics */
+static cy_ipc_pipe_timestamp_ptr_t cy_ipc_pipe_timestamp = NULL;
+
+static void Cy_IPC_Pipe_StatsDispatch(cy_stc_ipc_pipe_ep_t * endpoint, uint32_t * msgPtr,
+                                      uint32_t sendStamp, bool stampValid);
+static void Cy_IPC_Pipe_StatsHistAdd(uint32_t * hist, uint32_t * maxTicks, uint32_t ticks);
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
+
 
 /*******************************************************************************
 * Function Name: Cy_IPC_Pipe_Config
@@ -210,6 +223,10 @@ void Cy_IPC_Pipe_EndpointInit(uint32_t epAddr, cy_ipc_pipe_callback_array_ptr_t
     endpoint->clientCount   = cbCnt;
     endpoint->callbackArray = cbArray;
     endpoint->busy = CY_IPC_PIPE_ENDPOINT_NOTBUSY;
+    endpoint->ringPtr = NULL;
+#if (CY_IPC_PIPE_STATS != 0U)
+    (void)memset(&endpoint->stats, 0, sizeof(cy_stc_ipc_pipe_stats_t));
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
 
     if (NULL != epInterrupt)
     {
@@ -297,6 +314,15 @@ cy_en_ipc_pipe_status_t Cy_IPC_Pipe_SendMessage(uint32_t toAddr, uint32_t fromAd
                 /* Setup release callback function */
                 fromEp->releaseCallbackPtr = callBackPtr;
 
+            #if (CY_IPC_PIPE_STATS != 0U)
+                /* Pass the send timestamp to the receiver */
+                if ((!CY_IPC_V1) && (NULL != cy_ipc_pipe_timestamp))
+                {
+                    REG_IPC_STRUCT_DATA1(toEp->ipcPtr) = cy_ipc_pipe_timestamp();
+                }
+                toEp->stats.sent++;
+            #endif /* (CY_IPC_PIPE_STATS != 0U) */
+
                 /* Cause notify event/interrupt */
                 Cy_IPC_Drv_AcquireNotify(toEp->ipcPtr, notifyMask);
 
@@ -306,12 +332,18 @@ cy_en_ipc_pipe_status_t Cy_IPC_Pipe_SendMessage(uint32_t toAddr, uint32_t fromAd
             {
                 /* Channel was already acquired, return Error */
                 returnStatus = CY_IPC_PIPE_ERROR_SEND_BUSY;
+            #if (CY_IPC_PIPE_STATS != 0U)
+                toEp->stats.busy++;
+            #endif /* (CY_IPC_PIPE_STATS != 0U) */
             }
         }
         else
         {
             /* Channel may not be acquired, but the release interrupt has not executed yet */
             returnStatus = CY_IPC_PIPE_ERROR_SEND_BUSY;
+        #if (CY_IPC_PIPE_STATS != 0U)
+            toEp->stats.busy++;
+        #endif /* (CY_IPC_PIPE_STATS != 0U) */
         }
     }
     else
@@ -465,12 +497,9 @@ void Cy_IPC_Pipe_ExecuteCallback(uint32_t epAddr)
 void Cy_IPC_Pipe_ExecCallback(cy_stc_ipc_pipe_ep_t * endpoint)
 {
     uint32_t *msgPtr = NULL;
-    uint32_t clientID;
     uint32_t shadowIntr;
     uint32_t releaseMask = (uint32_t)0;
 
-    cy_ipc_pipe_callback_ptr_t callbackPtr;
-
     /* Parameters checking begin */
     CY_ASSERT_L1(NULL != endpoint);
     CY_ASSERT_L1(NULL != endpoint->ipcPtr);
@@ -493,23 +522,25 @@ void Cy_IPC_Pipe_ExecCallback(cy_stc_ipc_pipe_ep_t * endpoint)
             {
                 /* Get release mask */
                 releaseMask = _FLD2VAL(CY_IPC_PIPE_MSG_RELEASE, *msgPtr);
-                clientID    = _FLD2VAL(CY_IPC_PIPE_MSG_CLIENT,  *msgPtr);
-
-                /* Make sure client ID is within valid range */
-                if (endpoint->clientCount > clientID)
-                {
-                    callbackPtr = endpoint->callbackArray[clientID];  /* Get the callback function */
 
-                    if (callbackPtr != NULL)
-                    {
-                        callbackPtr(msgPtr);   /* Call the function pointer for "clientID" */
-                    }
-                }
+            #if (CY_IPC_PIPE_STATS != 0U)
+                /* The send timestamp is only passed by the IPC version 2 */
+                Cy_IPC_Pipe_StatsDispatch(endpoint, msgPtr,
+                                          (CY_IPC_V1) ? 0UL : REG_IPC_STRUCT_DATA1(endpoint->ipcPtr), !CY_IPC_V1);
+            #else
+                Cy_IPC_Pipe_Dispatch(endpoint, msgPtr);
+            #endif /* (CY_IPC_PIPE_STATS != 0U) */
             }
 
             /* Must always release the IPC channel */
             (void)Cy_IPC_Drv_LockRelease (endpoint->ipcPtr, releaseMask);
         }
+
+        /* The ring messages are posted without locking the IPC channel */
+        if (NULL != endpoint->ringPtr)
+        {
+            Cy_IPC_Pipe_RingProcess(endpoint);
+        }
     }
 
     /* Check to make sure the interrupt was a release interrupt */
@@ -541,6 +572,439 @@ void Cy_IPC_Pipe_ExecCallback(cy_stc_ipc_pipe_ep_t * endpoint)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_Dispatch
+****************************************************************************//**
+*
+* Calls the callback function registered for the client ID of the message.
+*
+* \param endpoint
+* Pointer to the receiving endpoint structure.
+*
+* \param msgPtr
+* Pointer to the received message.
+*
+*******************************************************************************/
+static void Cy_IPC_Pipe_Dispatch(cy_stc_ipc_pipe_ep_t const * endpoint, uint32_t * msgPtr)
+{
+    uint32_t clientID;
+    cy_ipc_pipe_callback_ptr_t callbackPtr;
+
+    clientID = _FLD2VAL(CY_IPC_PIPE_MSG_CLIENT, *msgPtr);
+
+    /* Make sure client ID is within valid range */
+    if (endpoint->clientCount > clientID)
+    {
+        callbackPtr = endpoint->callbackArray[clientID];  /* Get the callback function */
+
+        if (callbackPtr != NULL)
+        {
+            callbackPtr(msgPtr);   /* Call the function pointer for "clientID" */
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_RingProcess
+****************************************************************************//**
+*
+* Dispatches all messages posted to the message ring of the endpoint and
+* returns their buffers to the pool.
+*
+* \param endpoint
+* Pointer to the receiving endpoint structure.
+*
+*******************************************************************************/
+static void Cy_IPC_Pipe_RingProcess(cy_stc_ipc_pipe_ep_t * endpoint)
+{
+    cy_stc_ipc_pipe_ring_t * ring = endpoint->ringPtr;
+    uint32_t postHead = ring->postHead;
+    uint32_t blockIdx;
+
+    /* Read the descriptors only after the head index */
+    __DMB();
+
+    while (ring->postTail != postHead)
+    {
+        blockIdx = ring->postRing[ring->postTail & (ring->blockCount - 1UL)];
+        ring->postTail++;
+
+    #if (CY_IPC_PIPE_STATS != 0U)
+        Cy_IPC_Pipe_StatsDispatch(endpoint, (uint32_t *)(void *)&ring->buffers[blockIdx * ring->blockSize],
+                                  ring->stampRing[blockIdx], true);
+    #else
+        Cy_IPC_Pipe_Dispatch(endpoint, (uint32_t *)(void *)&ring->buffers[blockIdx * ring->blockSize]);
+    #endif /* (CY_IPC_PIPE_STATS != 0U) */
+
+        /* Return the buffer to the sender */
+        ring->freeRing[ring->freeHead & (ring->blockCount - 1UL)] = blockIdx;
+        __DMB();
+        ring->freeHead++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_RingInit
+****************************************************************************//**
+*
+* This function initializes a message ring. All buffers of the pool are free
+* after the call. The sender calls this function before the receiver registers
+* the ring with \ref Cy_IPC_Pipe_RegisterRing.
+*
+* \param ring
+* Pointer to the message ring structure, located in the shared memory.
+*
+* \param buffers
+* Pointer to the pool of blockCount buffers, located in the shared memory.
+* Must be 4-byte aligned.
+*
+* \param blockSize
+* Size of one buffer in bytes, a multiple of 4. It is the maximum message size.
+*
+* \param blockCount
+* Number of buffers, which is also the maximum number of messages in flight.
+* Must be a power of two, so the running indexes wrap around at 2^32 without
+* a jump in the ring.
+*
+* \param descriptors
+* Pointer to the array of \ref CY_IPC_PIPE_RING_DESCR_SIZE (blockCount) words,
+* located in the shared memory.
+*
+*******************************************************************************/
+void Cy_IPC_Pipe_RingInit(cy_stc_ipc_pipe_ring_t *ring, void *buffers, uint32_t blockSize,
+                          uint32_t blockCount, uint32_t *descriptors)
+{
+    uint32_t blockIdx;
+
+    /* Parameters checking begin */
+    CY_ASSERT_L1(NULL != ring);
+    CY_ASSERT_L1(NULL != buffers);
+    CY_ASSERT_L1(NULL != descriptors);
+    CY_ASSERT_L2((0UL != blockSize) && (0UL == (blockSize % 4UL)));
+    CY_ASSERT_L2((0UL != blockCount) && (0UL == (blockCount & (blockCount - 1UL))));
+    /* Parameters checking end */
+
+    ring->buffers    = (uint8_t *)buffers;
+    ring->blockSize  = blockSize;
+    ring->blockCount = blockCount;
+    ring->postRing   = descriptors;
+    ring->freeRing   = &descriptors[blockCount];
+#if (CY_IPC_PIPE_STATS != 0U)
+    ring->stampRing  = &descriptors[2UL * blockCount];
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
+
+    for (blockIdx = 0UL; blockIdx < blockCount; blockIdx++)
+    {
+        ring->freeRing[blockIdx] = blockIdx;
+    }
+
+    ring->postHead = 0UL;
+    ring->postTail = 0UL;
+    ring->freeHead = blockCount;
+    ring->freeTail = 0UL;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_RegisterRing
+****************************************************************************//**
+*
+* This function attaches a message ring to the receiving endpoint. The messages
+* posted to the ring are dispatched by \ref Cy_IPC_Pipe_ExecuteCallback.
+*
+* \param epAddr
+* This parameter is the address (or index in the array of endpoint structures)
+* that designates the endpoint that receives the messages.
+*
+* \param ring
+* Pointer to the message ring initialized by \ref Cy_IPC_Pipe_RingInit.
+* If this parameter is NULL, the current ring is detached.
+*
+*******************************************************************************/
+void Cy_IPC_Pipe_RegisterRing(uint32_t epAddr, cy_stc_ipc_pipe_ring_t *ring)
+{
+    CY_ASSERT_L1(NULL != cy_ipc_pipe_epArray);
+
+    cy_ipc_pipe_epArray[epAddr].ringPtr = ring;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_RingAlloc
+****************************************************************************//**
+*
+* This function takes a free buffer from the message ring pool. The sender
+* fills the message in place and posts it with \ref Cy_IPC_Pipe_RingPost.
+* Call this function from one context of the sender only.
+*
+* \param ring
+* Pointer to the message ring.
+*
+* \return
+* Pointer to the buffer of blockSize bytes, or NULL if all buffers are in use.
+*
+*******************************************************************************/
+void * Cy_IPC_Pipe_RingAlloc(cy_stc_ipc_pipe_ring_t *ring)
+{
+    void * msgPtr = NULL;
+    uint32_t blockIdx;
+
+    CY_ASSERT_L1(NULL != ring);
+
+    if (ring->freeTail != ring->freeHead)
+    {
+        /* Read the descriptor only after the head index */
+        __DMB();
+
+        blockIdx = ring->freeRing[ring->freeTail & (ring->blockCount - 1UL)];
+        ring->freeTail++;
+
+        msgPtr = (void *)&ring->buffers[blockIdx * ring->blockSize];
+    }
+
+    return (msgPtr);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_RingPost
+****************************************************************************//**
+*
+* This function posts a message to the message ring and generates a notify
+* interrupt on the receiving endpoint. The IPC channel is not locked, so the
+* sender can post the next message right away. The buffer belongs to the
+* receiver after this call.
+*
+* \param toAddr
+* This parameter is the address (or index in the array of endpoint structures)
+* of the endpoint to which you are sending the message.
+*
+* \param ring
+* Pointer to the message ring.
+*
+* \param msgPtr
+* Pointer to the buffer returned by \ref Cy_IPC_Pipe_RingAlloc. The first word
+* of the message is the client ID.
+*
+* \return
+*    CY_IPC_PIPE_SUCCESS:          Message was posted to the other end of the pipe
+*    CY_IPC_PIPE_ERROR_BAD_HANDLE: The handle provided for the pipe was not valid
+*
+*******************************************************************************/
+cy_en_ipc_pipe_status_t Cy_IPC_Pipe_RingPost(uint32_t toAddr, cy_stc_ipc_pipe_ring_t *ring, void *msgPtr)
+{
+    cy_en_ipc_pipe_status_t returnStatus = CY_IPC_PIPE_ERROR_BAD_HANDLE;
+    cy_stc_ipc_pipe_ep_t * toEp;
+    uint32_t blockIdx;
+
+    CY_ASSERT_L1(NULL != ring);
+    CY_ASSERT_L1(NULL != msgPtr);
+    CY_ASSERT_L1(NULL != cy_ipc_pipe_epArray);
+
+    toEp = &cy_ipc_pipe_epArray[toAddr];
+
+    /* Check if IPC channel valid */
+    if (toEp->ipcPtr != NULL)
+    {
+        blockIdx = (uint32_t)((uint8_t *)msgPtr - ring->buffers) / ring->blockSize;
+
+        CY_ASSERT_L1(blockIdx < ring->blockCount);
+
+        ring->postRing[ring->postHead & (ring->blockCount - 1UL)] = blockIdx;
+
+    #if (CY_IPC_PIPE_STATS != 0U)
+        ring->stampRing[blockIdx] = (NULL != cy_ipc_pipe_timestamp) ? cy_ipc_pipe_timestamp() : 0UL;
+        toEp->stats.sent++;
+    #endif /* (CY_IPC_PIPE_STATS != 0U) */
+
+        /* The message must be visible to the receiver before the new head index */
+        __DMB();
+        ring->postHead++;
+
+        /* Cause notify event/interrupt */
+        Cy_IPC_Drv_AcquireNotify(toEp->ipcPtr, (uint32_t)(1ul << (toEp->intrChan)));
+
+        returnStatus = CY_IPC_PIPE_SUCCESS;
+    }
+
+    return (returnStatus);
+}
+
+
+#if (CY_IPC_PIPE_STATS != 0U)
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_StatsDispatch
+****************************************************************************//**
+*
+* Counts the received message and dispatches it. When the timestamp function
+* is set, measures the send-to-callback latency and the callback execution time.
+*
+* \param endpoint
+* Pointer to the receiving endpoint structure.
+*
+* \param msgPtr
+* Pointer to the received message.
+*
+* \param sendStamp
+* The timestamp taken by the sender when the message was sent.
+*
+* \param stampValid
+* True if sendStamp is valid.
+*
+*******************************************************************************/
+static void Cy_IPC_Pipe_StatsDispatch(cy_stc_ipc_pipe_ep_t * endpoint, uint32_t * msgPtr,
+                                      uint32_t sendStamp, bool stampValid)
+{
+    uint32_t startStamp;
+
+    endpoint->stats.received++;
+
+    if (NULL != cy_ipc_pipe_timestamp)
+    {
+        startStamp = cy_ipc_pipe_timestamp();
+
+        if (stampValid)
+        {
+            Cy_IPC_Pipe_StatsHistAdd(endpoint->stats.latencyHist, &endpoint->stats.latencyMax, startStamp - sendStamp);
+        }
+
+        Cy_IPC_Pipe_Dispatch(endpoint, msgPtr);
+
+        Cy_IPC_Pipe_StatsHistAdd(endpoint->stats.callbackHist, &endpoint->stats.callbackMax,
+                                 cy_ipc_pipe_timestamp() - startStamp);
+    }
+    else
+    {
+        Cy_IPC_Pipe_Dispatch(endpoint, msgPtr);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_StatsHistAdd
+****************************************************************************//**
+*
+* Adds the duration to the logarithmic histogram and updates the maximum.
+*
+* \param hist
+* Pointer to the histogram of \ref CY_IPC_PIPE_STATS_HIST_BINS bins.
+*
+* \param maxTicks
+* Pointer to the maximum duration.
+*
+* \param ticks
+* The duration in the timestamp ticks.
+*
+*******************************************************************************/
+static void Cy_IPC_Pipe_StatsHistAdd(uint32_t * hist, uint32_t * maxTicks, uint32_t ticks)
+{
+    uint32_t bin = 0UL;
+    uint32_t value = ticks >> 1UL;
+
+    while ((0UL != value) && (bin < (CY_IPC_PIPE_STATS_HIST_BINS - 1UL)))
+    {
+        value >>= 1UL;
+        bin++;
+    }
+
+    hist[bin]++;
+
+    if (ticks > *maxTicks)
+    {
+        *maxTicks = ticks;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_SetTimestampSource
+****************************************************************************//**
+*
+* This function sets the timestamp function used to measure the callback
+* execution time and the send-to-callback latency. The function must return an
+* up-counting 32-bit tick count, for example DWT->CYCCNT on the CM4 core or a
+* TCPWM counter. To measure the latency, set the same time base on all cores,
+* for example a TCPWM counter read by both of them.
+*
+* \note This function is available when \ref CY_IPC_PIPE_STATS is enabled.
+*
+* \param timestampPtr
+* Pointer to the timestamp function. If this parameter is NULL, only the
+* message counters are updated.
+*
+*******************************************************************************/
+void Cy_IPC_Pipe_SetTimestampSource(cy_ipc_pipe_timestamp_ptr_t timestampPtr)
+{
+    cy_ipc_pipe_timestamp = timestampPtr;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_GetStats
+****************************************************************************//**
+*
+* This function returns a snapshot of the endpoint statistics.
+*
+* \note This function is available when \ref CY_IPC_PIPE_STATS is enabled.
+*
+* \param epAddr
+* This parameter is the address (or index in the array of endpoint structures)
+* that designates the endpoint.
+*
+* \param stats
+* Pointer to the structure to store the statistics.
+*
+* \return
+*    CY_IPC_PIPE_SUCCESS:           Statistics read successfully
+*
+*******************************************************************************/
+cy_en_ipc_pipe_status_t Cy_IPC_Pipe_GetStats(uint32_t epAddr, cy_stc_ipc_pipe_stats_t *stats)
+{
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != cy_ipc_pipe_epArray);
+    CY_ASSERT_L1(NULL != stats);
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    *stats = cy_ipc_pipe_epArray[epAddr].stats;
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+
+    return (CY_IPC_PIPE_SUCCESS);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Pipe_ClearStats
+****************************************************************************//**
+*
+* This function clears the endpoint statistics.
+*
+* \note This function is available when \ref CY_IPC_PIPE_STATS is enabled.
+*
+* \param epAddr
+* This parameter is the address (or index in the array of endpoint structures)
+* that designates the endpoint.
+*
+*******************************************************************************/
+void Cy_IPC_Pipe_ClearStats(uint32_t epAddr)
+{
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != cy_ipc_pipe_epArray);
+
+    interruptState = Cy_SysLib_EnterCriticalSection();
+
+    (void)memset(&cy_ipc_pipe_epArray[epAddr].stats, 0, sizeof(cy_stc_ipc_pipe_stats_t));
+
+    Cy_SysLib_ExitCriticalSection(interruptState);
+}
+#endif /* (CY_IPC_PIPE_STATS != 0U) */
+
+
 /*******************************************************************************
 * Function Name: Cy_IPC_Pipe_EndpointPause
 ****************************************************************************//**
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_ipc_sema.c
-* \version 1.40.2
+* \version 1.50
 *
 *  Description:
 *   IPC Semaphore Driver - This source file contains the source code for the
@@ -31,9 +31,23 @@
 /* Defines a mask to Check if semaphore count is a multiple of 32 */
 #define CY_IPC_SEMA_PER_WORD_MASK    (CY_IPC_SEMA_PER_WORD - 1ul)
 
+/* The index of the current core in the contention data */
+#define CY_IPC_SEMA_CORE_ID          ((CY_CPU_CORTEX_M0P) ? 0ul : 1ul)
+
+/* The turn flag fields: a waiting flag per core and the core that set the semaphore last */
+#define CY_IPC_SEMA_TURN_WAIT(core)  ((uint8_t)(1ul << (core)))
+#define CY_IPC_SEMA_TURN_OWNER_Pos   (4ul)
+#define CY_IPC_SEMA_TURN_OWNER_Msk   ((uint8_t)(1ul << CY_IPC_SEMA_TURN_OWNER_Pos))
+
 /* Pointer to IPC structure used for semaphores */
 static IPC_STRUCT_Type* cy_semaIpcStruct;
 
+/* Pointer to the contention data registered on this CPU, or NULL */
+static cy_stc_ipc_sema_contention_t *cy_semaContention = NULL;
+
+static cy_en_ipcsema_status_t Cy_IPC_Sema_TrySet(uint32_t semaNumber, bool preemptable, bool isWaiter);
+static void Cy_IPC_Sema_EndWait(uint32_t semaNumber, bool preemptable);
+
 
 /*******************************************************************************
 * Function Name: Cy_IPC_Sema_Init
@@ -81,6 +95,7 @@ cy_en_ipcsema_status_t Cy_IPC_Sema_Init(uint32_t ipcChannel,
     if( (NULL == memPtr) && (0u == count))
     {
         cy_semaIpcStruct = Cy_IPC_Drv_GetIpcBaseAddress(ipcChannel);
+        cy_semaContention = NULL;
 
         retStatus = CY_IPC_SEMA_SUCCESS;
     }
@@ -147,6 +162,7 @@ cy_en_ipcsema_status_t Cy_IPC_Sema_InitExt(uint32_t ipcChannel, cy_stc_ipc_sema_
             if( 0ul == (ipcSema->maxSema & CY_IPC_SEMA_PER_WORD_MASK))
             {
                 cy_semaIpcStruct = Cy_IPC_Drv_GetIpcBaseAddress(ipcChannel);
+                cy_semaContention = NULL;
 
                 /* Initialize all semaphores to released */
                 (void)memset(ipcSema->arrayPtr, 0, (ipcSema->maxSema /8u));
@@ -227,12 +243,42 @@ cy_en_ipcsema_status_t Cy_IPC_Sema_InitExt(uint32_t ipcChannel, cy_stc_ipc_sema_
 *
 *******************************************************************************/
 cy_en_ipcsema_status_t Cy_IPC_Sema_Set(uint32_t semaNumber, bool preemptable)
+{
+    return (Cy_IPC_Sema_TrySet(semaNumber, preemptable, false));
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Sema_TrySet
+****************************************************************************//**
+*
+* Makes one attempt to set the semaphore and updates the contention data.
+*
+* \param semaNumber
+*  The semaphore number to acquire.
+*
+* \param preemptable
+*  When this parameter is enabled the function can be preempted by another
+*  task or other forms of context switching in an RTOS environment.
+*
+* \param isWaiter
+*  True if the caller waits for the semaphore in \ref Cy_IPC_Sema_Acquire.
+*  The waiter marks itself in the turn flags and yields the semaphore to the
+*  other core if that core is waiting and this core set the semaphore last.
+*
+* \return Status of the operation, see \ref Cy_IPC_Sema_Set.
+*
+*******************************************************************************/
+static cy_en_ipcsema_status_t Cy_IPC_Sema_TrySet(uint32_t semaNumber, bool preemptable, bool isWaiter)
 {
     uint32_t semaIndex;
     uint32_t semaMask;
     uint32_t interruptState = 0ul;
+    uint32_t coreId = CY_IPC_SEMA_CORE_ID;
+    uint8_t  turn;
 
     cy_stc_ipc_sema_t      *semaStruct;
+    cy_stc_ipc_sema_contention_t *contention = cy_semaContention;
     cy_en_ipcsema_status_t  retStatus = CY_IPC_SEMA_LOCKED;
 
     /* Get pointer to structure */
@@ -252,14 +298,42 @@ cy_en_ipcsema_status_t Cy_IPC_Sema_Set(uint32_t semaNumber, bool preemptable)
            If so, check if specific channel can be locked. */
         if(CY_IPC_DRV_SUCCESS == Cy_IPC_Drv_LockAcquire (cy_semaIpcStruct))
         {
-            if((semaStruct->arrayPtr[semaIndex] & semaMask) == 0ul)
+            retStatus = CY_IPC_SEMA_NOT_ACQUIRED;
+
+            if ((NULL != contention) && (NULL != contention->turnPtr))
+            {
+                turn = contention->turnPtr[semaNumber];
+
+                if((semaStruct->arrayPtr[semaIndex] & semaMask) == 0ul)
+                {
+                    /* Yield to the other core if it waits and this core had the last turn */
+                    if ((!isWaiter) ||
+                        (0u == (turn & CY_IPC_SEMA_TURN_WAIT(1ul - coreId))) ||
+                        (coreId != _FLD2VAL(CY_IPC_SEMA_TURN_OWNER, turn)))
+                    {
+                        semaStruct->arrayPtr[semaIndex] |= semaMask;
+
+                        turn &= (uint8_t)~(CY_IPC_SEMA_TURN_WAIT(coreId) | CY_IPC_SEMA_TURN_OWNER_Msk);
+                        turn |= (uint8_t)_VAL2FLD(CY_IPC_SEMA_TURN_OWNER, coreId);
+                        retStatus = CY_IPC_SEMA_SUCCESS;
+                    }
+                }
+
+                if ((CY_IPC_SEMA_SUCCESS != retStatus) && isWaiter)
+                {
+                    turn |= CY_IPC_SEMA_TURN_WAIT(coreId);
+                }
+
+                contention->turnPtr[semaNumber] = turn;
+            }
+            else if((semaStruct->arrayPtr[semaIndex] & semaMask) == 0ul)
             {
                 semaStruct->arrayPtr[semaIndex] |= semaMask;
                 retStatus = CY_IPC_SEMA_SUCCESS;
             }
             else
             {
-                retStatus = CY_IPC_SEMA_NOT_ACQUIRED;
+                /* The semaphore is already set */
             }
 
             /* Release, but do not trigger a release event */
@@ -270,6 +344,18 @@ cy_en_ipcsema_status_t Cy_IPC_Sema_Set(uint32_t semaNumber, bool preemptable)
         {
             Cy_SysLib_ExitCriticalSection(interruptState);
         }
+
+        if ((NULL != contention) && (NULL != contention->statsPtr))
+        {
+            if (CY_IPC_SEMA_SUCCESS == retStatus)
+            {
+                contention->statsPtr[semaNumber].acquired[coreId]++;
+            }
+            else
+            {
+                contention->statsPtr[semaNumber].contended[coreId]++;
+            }
+        }
     }
     else
     {
@@ -280,6 +366,124 @@ cy_en_ipcsema_status_t Cy_IPC_Sema_Set(uint32_t semaNumber, bool preemptable)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_IPC_Sema_EndWait
+****************************************************************************//**
+*
+* Clears the waiting flag of the current core after \ref Cy_IPC_Sema_Acquire
+* times out and counts the timeout.
+*
+* \param semaNumber
+*  The semaphore number.
+*
+* \param preemptable
+*  When this parameter is enabled the function can be preempted by another
+*  task or other forms of context switching in an RTOS environment.
+*
+*******************************************************************************/
+static void Cy_IPC_Sema_EndWait(uint32_t semaNumber, bool preemptable)
+{
+    uint32_t interruptState = 0ul;
+    uint32_t coreId = CY_IPC_SEMA_CORE_ID;
+    cy_stc_ipc_sema_contention_t *contention = cy_semaContention;
+
+    if ((NULL != contention) && (NULL != contention->turnPtr))
+    {
+        if (!preemptable)
+        {
+            interruptState = Cy_SysLib_EnterCriticalSection();
+        }
+
+        /* The channel is held only for a few instructions by the semaphore functions */
+        while (CY_IPC_DRV_SUCCESS != Cy_IPC_Drv_LockAcquire (cy_semaIpcStruct))
+        {
+        }
+
+        contention->turnPtr[semaNumber] &= (uint8_t)~CY_IPC_SEMA_TURN_WAIT(coreId);
+
+        (void) Cy_IPC_Drv_LockRelease (cy_semaIpcStruct, CY_IPC_NO_NOTIFICATION);
+
+        if (!preemptable)
+        {
+            Cy_SysLib_ExitCriticalSection(interruptState);
+        }
+    }
+
+    if ((NULL != contention) && (NULL != contention->statsPtr))
+    {
+        contention->statsPtr[semaNumber].timeouts[coreId]++;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Sema_Acquire
+****************************************************************************//**
+*
+* This function acquires a semaphore, waiting until it is available or the
+* timeout expires. Between the attempts the function waits with an exponential
+* back-off, starting at minDelayUs and doubling up to maxDelayUs, so the
+* semaphores IPC channel is not locked in a tight loop.
+*
+* When the turn flags are registered with \ref Cy_IPC_Sema_InitContention,
+* the cores take turns: a core that set the semaphore last yields it to the
+* other core if that core is waiting in this function. \ref Cy_IPC_Sema_Set
+* does not wait for its turn.
+*
+* \param semaNumber
+*  The semaphore number to acquire.
+*
+* \param preemptable
+*  When this parameter is enabled the function can be preempted by another
+*  task or other forms of context switching in an RTOS environment.
+*  See the note for \ref Cy_IPC_Sema_Set.
+*
+* \param config
+*  The back-off and timeout configuration. See \ref cy_stc_ipc_sema_acquire_t.
+*
+* \return Status of the operation
+*    \retval CY_IPC_SEMA_SUCCESS:      The semaphore was set successfully
+*    \retval CY_IPC_SEMA_LOCKED:       The timeout expired, the semaphore
+*                              channel was busy or locked by another process
+*    \retval CY_IPC_SEMA_NOT_ACQUIRED: The timeout expired, the semaphore was set
+*    \retval CY_IPC_SEMA_OUT_OF_RANGE: The semaphore number is not valid
+*
+*******************************************************************************/
+cy_en_ipcsema_status_t Cy_IPC_Sema_Acquire(uint32_t semaNumber, bool preemptable,
+                                           cy_stc_ipc_sema_acquire_t const *config)
+{
+    uint32_t delayUs;
+    uint32_t elapsedUs = 0ul;
+    cy_en_ipcsema_status_t retStatus;
+
+    CY_ASSERT_L1(NULL != config);
+    CY_ASSERT_L2(0u != config->minDelayUs);
+    CY_ASSERT_L2(config->minDelayUs <= config->maxDelayUs);
+
+    delayUs = config->minDelayUs;
+
+    retStatus = Cy_IPC_Sema_TrySet(semaNumber, preemptable, true);
+
+    while (((CY_IPC_SEMA_LOCKED == retStatus) || (CY_IPC_SEMA_NOT_ACQUIRED == retStatus)) &&
+           ((CY_IPC_SEMA_WAIT_FOREVER == config->timeoutUs) || (elapsedUs < config->timeoutUs)))
+    {
+        Cy_SysLib_DelayUs((uint16_t)delayUs);
+        elapsedUs += delayUs;
+
+        delayUs = ((delayUs * 2ul) < config->maxDelayUs) ? (delayUs * 2ul) : config->maxDelayUs;
+
+        retStatus = Cy_IPC_Sema_TrySet(semaNumber, preemptable, true);
+    }
+
+    if ((CY_IPC_SEMA_LOCKED == retStatus) || (CY_IPC_SEMA_NOT_ACQUIRED == retStatus))
+    {
+        Cy_IPC_Sema_EndWait(semaNumber, preemptable);
+    }
+
+    return(retStatus);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_IPC_Sema_Clear
 ****************************************************************************//**
@@ -442,4 +646,136 @@ uint32_t Cy_IPC_Sema_GetMaxSems(void)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_IPC_Sema_InitContention
+****************************************************************************//**
+*
+* This function registers the turn flags used by \ref Cy_IPC_Sema_Acquire and
+* the contention counters. The data is kept in the contention structure
+* outside of \ref cy_stc_ipc_sema_t, so a CPU that does not call this function
+* (for example, running an image built with a previous driver version) keeps
+* the previous behavior.
+*
+* Call it after the semaphores subsystem is initialized and before the
+* semaphores are used. On one CPU pass the arrays to set up the contention
+* structure. On other CPUs pass the same structure and NULL arrays to use the
+* registered data. The structure and both arrays must be located in the memory
+* shared by the CPUs.
+*
+* \param contention
+*  The contention structure shared by the CPUs, or NULL to stop using the
+*  contention data on this CPU.
+*
+* \param turnArray
+*  The array of \ref Cy_IPC_Sema_GetMaxSems bytes for the turn flags, or NULL
+*  to disable the turns.
+*
+* \param statsArray
+*  The array of \ref Cy_IPC_Sema_GetMaxSems counter structures, or NULL to
+*  disable the counters.
+*
+* \return Status of the operation
+*    \retval CY_IPC_SEMA_SUCCESS:       The contention data is registered
+*    \retval CY_IPC_SEMA_BAD_PARAM:     Both arrays are NULL and the structure
+*                              is not set up for this semaphores subsystem
+*
+*******************************************************************************/
+cy_en_ipcsema_status_t Cy_IPC_Sema_InitContention(cy_stc_ipc_sema_contention_t *contention,
+                                                  uint8_t turnArray[], cy_stc_ipc_sema_stats_t statsArray[])
+{
+    cy_stc_ipc_sema_t      *semaStruct;
+    cy_en_ipcsema_status_t  retStatus = CY_IPC_SEMA_SUCCESS;
+
+    /* Get pointer to structure */
+    semaStruct = (cy_stc_ipc_sema_t *)Cy_IPC_Drv_ReadDataValue(cy_semaIpcStruct);
+
+    cy_semaContention = NULL;
+
+    if (NULL == contention)
+    {
+        /* The contention data is not used on this CPU */
+    }
+    else if ((NULL != turnArray) || (NULL != statsArray))
+    {
+        if (NULL != turnArray)
+        {
+            (void)memset(turnArray, 0, semaStruct->maxSema);
+        }
+
+        if (NULL != statsArray)
+        {
+            (void)memset(statsArray, 0, semaStruct->maxSema * sizeof(cy_stc_ipc_sema_stats_t));
+        }
+
+        contention->maxSema  = semaStruct->maxSema;
+        contention->turnPtr  = turnArray;
+        contention->statsPtr = statsArray;
+
+        /* The other CPUs check the version after the fields are set */
+        __DMB();
+        contention->version  = CY_IPC_SEMA_CONTENTION_VERSION;
+
+        cy_semaContention = contention;
+    }
+    else if ((CY_IPC_SEMA_CONTENTION_VERSION == contention->version) &&
+             (semaStruct->maxSema == contention->maxSema))
+    {
+        cy_semaContention = contention;
+    }
+    else
+    {
+        retStatus = CY_IPC_SEMA_BAD_PARAM;
+    }
+
+    return(retStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_IPC_Sema_GetStats
+****************************************************************************//**
+*
+* This function returns the contention counters of the semaphore.
+*
+* \param semaNumber
+*  The index of the semaphore.
+*
+* \param stats
+*  The pointer to the structure to store the counters.
+*
+* \return Status of the operation
+*    \retval CY_IPC_SEMA_SUCCESS:       The counters are returned
+*    \retval CY_IPC_SEMA_BAD_PARAM:     The counters are not registered
+*    \retval CY_IPC_SEMA_OUT_OF_RANGE:  The semaphore number is not valid
+*
+*******************************************************************************/
+cy_en_ipcsema_status_t Cy_IPC_Sema_GetStats(uint32_t semaNumber, cy_stc_ipc_sema_stats_t *stats)
+{
+    cy_stc_ipc_sema_t      *semaStruct;
+    cy_stc_ipc_sema_contention_t *contention = cy_semaContention;
+    cy_en_ipcsema_status_t  retStatus = CY_IPC_SEMA_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != stats);
+
+    /* Get pointer to structure */
+    semaStruct = (cy_stc_ipc_sema_t *)Cy_IPC_Drv_ReadDataValue(cy_semaIpcStruct);
+
+    if (semaNumber >= semaStruct->maxSema)
+    {
+        retStatus = CY_IPC_SEMA_OUT_OF_RANGE;
+    }
+    else if ((NULL != contention) && (NULL != contention->statsPtr))
+    {
+        *stats = contention->statsPtr[semaNumber];
+        retStatus = CY_IPC_SEMA_SUCCESS;
+    }
+    else
+    {
+        /* The counters are not registered */
+    }
+
+    return(retStatus);
+}
+
+
 /* [] END OF FILE */
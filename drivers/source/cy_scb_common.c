@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_common.c
-* \version 2.50
+* \version 2.60
 *
 * Provides common API implementation of the SCB driver.
 *
@@ -417,6 +417,156 @@ uint32_t Cy_SCB_WriteDefaultArray(CySCB_Type *base, uint32_t txData, uint32_t si
     return (numToCopy);
 }
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SCB_DmaSetDescriptors
+****************************************************************************//**
+*
+* Sets up the descriptor chain which moves data between the SCB FIFO and
+* the buffer: a 2D descriptor for the full rows of 256 data elements and a 1D
+* descriptor for the rest.
+*
+* \param descriptor
+* The descriptor chain of two descriptors.
+*
+* \param fifo
+* The address of the RX FIFO read or TX FIFO write register.
+*
+* \param buffer
+* The transfer buffer.
+*
+* \param size
+* The number of data elements to move.
+*
+* \param isRx
+* True - the data is moved from the FIFO to the buffer, false - from the buffer
+* to the FIFO.
+*
+* \param incBuffer
+* True - the buffer address is incremented, false - the same data element is
+* moved each time.
+*
+* \param byteMode
+* True - the data elements are bytes, false - half-words.
+*
+* \param nextDescriptor
+* The descriptor executed after the data is moved. NULL - the channel is
+* disabled after the data is moved.
+*
+*******************************************************************************/
+void Cy_SCB_DmaSetDescriptors(cy_stc_dma_descriptor_t descriptor[], void const *fifo, void *buffer,
+                              uint32_t size, bool isRx, bool incBuffer, bool byteMode,
+                              cy_stc_dma_descriptor_t *nextDescriptor)
+{
+    cy_stc_dma_descriptor_config_t descrConfig;
+    cy_stc_dma_descriptor_t *locDescr = &descriptor[0U];
+    uint8_t *locBuf = (uint8_t *) buffer;
+    uint32_t rows = size / CY_DMA_LOOP_COUNT_MAX;
+    uint32_t rest = size % CY_DMA_LOOP_COUNT_MAX;
+    int32_t  bufIncrement = (incBuffer) ? 1L : 0L;
+    cy_en_dma_channel_state_t lastState = (NULL != nextDescriptor) ? CY_DMA_CHANNEL_ENABLED : CY_DMA_CHANNEL_DISABLED;
+
+    descrConfig.retrigger       = CY_DMA_RETRIG_16CYC;
+    descrConfig.interruptType   = CY_DMA_DESCR_CHAIN;
+    descrConfig.triggerOutType  = CY_DMA_DESCR_CHAIN;
+    descrConfig.triggerInType   = CY_DMA_1ELEMENT;
+    descrConfig.dataSize        = (byteMode) ? CY_DMA_BYTE : CY_DMA_HALFWORD;
+    descrConfig.srcTransferSize = (isRx) ? CY_DMA_TRANSFER_SIZE_WORD : CY_DMA_TRANSFER_SIZE_DATA;
+    descrConfig.dstTransferSize = (isRx) ? CY_DMA_TRANSFER_SIZE_DATA : CY_DMA_TRANSFER_SIZE_WORD;
+    descrConfig.srcAddress      = NULL;
+    descrConfig.dstAddress      = NULL;
+    /* The FIFO address is fixed */
+    descrConfig.srcXincrement   = (isRx) ? 0L : bufIncrement;
+    descrConfig.dstXincrement   = (isRx) ? bufIncrement : 0L;
+    descrConfig.srcYincrement   = (isRx) ? 0L : (bufIncrement * (int32_t) CY_DMA_LOOP_COUNT_MAX);
+    descrConfig.dstYincrement   = (isRx) ? (bufIncrement * (int32_t) CY_DMA_LOOP_COUNT_MAX) : 0L;
+
+    if (0UL != rows)
+    {
+        descrConfig.descriptorType = CY_DMA_2D_TRANSFER;
+        descrConfig.xCount         = CY_DMA_LOOP_COUNT_MAX;
+        descrConfig.yCount         = rows;
+        descrConfig.channelState   = (0UL != rest) ? CY_DMA_CHANNEL_ENABLED : lastState;
+        descrConfig.nextDescriptor = (0UL != rest) ? &descriptor[1U] : nextDescriptor;
+
+        (void) Cy_DMA_Descriptor_Init(locDescr, &descrConfig);
+        Cy_DMA_Descriptor_SetSrcAddress(locDescr, (isRx) ? fifo : (void const *) locBuf);
+        Cy_DMA_Descriptor_SetDstAddress(locDescr, (isRx) ? (void const *) locBuf : fifo);
+
+        locDescr = &descriptor[1U];
+
+        if (incBuffer)
+        {
+            locBuf = &locBuf[((byteMode) ? 1UL : 2UL) * rows * CY_DMA_LOOP_COUNT_MAX];
+        }
+    }
+
+    if (0UL != rest)
+    {
+        descrConfig.descriptorType = CY_DMA_1D_TRANSFER;
+        descrConfig.xCount         = rest;
+        descrConfig.yCount         = 1UL;
+        descrConfig.channelState   = lastState;
+        descrConfig.nextDescriptor = nextDescriptor;
+
+        (void) Cy_DMA_Descriptor_Init(locDescr, &descrConfig);
+        Cy_DMA_Descriptor_SetSrcAddress(locDescr, (isRx) ? fifo : (void const *) locBuf);
+        Cy_DMA_Descriptor_SetDstAddress(locDescr, (isRx) ? (void const *) locBuf : fifo);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_DmaGetNumTransferred
+****************************************************************************//**
+*
+* Returns the number of data elements moved by the descriptor chain set up by
+* \ref Cy_SCB_DmaSetDescriptors. The channel must be disabled before calling
+* this function.
+*
+* \param dwBase
+* The pointer to the DW block.
+*
+* \param channel
+* The DW channel number.
+*
+* \param descriptor
+* The descriptor chain of two descriptors.
+*
+* \param size
+* The number of data elements the chain was set up to move.
+*
+* \return
+* The number of data elements moved.
+*
+*******************************************************************************/
+uint32_t Cy_SCB_DmaGetNumTransferred(DW_Type const *dwBase, uint32_t channel,
+                                     cy_stc_dma_descriptor_t const descriptor[], uint32_t size)
+{
+    cy_stc_dma_descriptor_t const *curDescr = Cy_DMA_Channel_GetCurrentDescriptor(dwBase, channel);
+    uint32_t chIdx = DW_CH_IDX(dwBase, channel);
+    uint32_t numMoved = size;
+
+    if (curDescr == &descriptor[0U])
+    {
+        numMoved = (_FLD2VAL(DW_CH_STRUCT_CH_IDX_Y_IDX, chIdx) * CY_DMA_LOOP_COUNT_MAX) +
+                    _FLD2VAL(DW_CH_STRUCT_CH_IDX_X_IDX, chIdx);
+    }
+    else if (curDescr == &descriptor[1U])
+    {
+        /* The 1D tail descriptor follows the full rows of the 2D descriptor */
+        numMoved = ((size / CY_DMA_LOOP_COUNT_MAX) * CY_DMA_LOOP_COUNT_MAX) +
+                    _FLD2VAL(DW_CH_STRUCT_CH_IDX_X_IDX, chIdx);
+    }
+    else
+    {
+        /* The chain is complete */
+    }
+
+    return (numMoved);
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_ezi2c.c
-* \version 2.50
+* \version 2.60
 *
 * Provides EZI2C API implementation of the SCB driver.
 *
@@ -42,6 +42,9 @@ static void HandleDataReceive (CySCB_Type *base, cy_stc_scb_ezi2c_context_t *con
 static void HandleDataTransmit(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
 static void HandleStop        (CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
 static void UpdateAddressMask (CySCB_Type *base, cy_stc_scb_ezi2c_context_t const *context);
+#if defined(CY_IP_M4CPUSS_DMA)
+static void DmaStartTransmit  (CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context);
+#endif /* CY_IP_M4CPUSS_DMA */
 
 
 /*******************************************************************************
@@ -133,6 +136,10 @@ cy_en_scb_ezi2c_status_t Cy_SCB_EZI2C_Init(CySCB_Type *base, cy_stc_scb_ezi2c_co
     context->buf1rwBondary = 0UL;
     context->baseAddr2     = 0UL;
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    context->dma = NULL;
+#endif /* CY_IP_M4CPUSS_DMA */
+
     return CY_SCB_EZI2C_SUCCESS;
 }
 
@@ -204,6 +211,13 @@ void Cy_SCB_EZI2C_Disable(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
     /* Set the state to default and clear the statuses */
     context->status = 0UL;
     context->state  = CY_SCB_EZI2C_STATE_IDLE;
+
+#if defined(CY_IP_M4CPUSS_DMA)
+    if (NULL != context->dma)
+    {
+        Cy_DMA_Channel_Disable(context->dma->dwBase, context->dma->txChannel);
+    }
+#endif /* CY_IP_M4CPUSS_DMA */
 }
 
 
@@ -744,6 +758,96 @@ void Cy_SCB_EZI2C_SetBuffer2(CySCB_Type const *base, uint8_t *buffer, uint32_t s
 }
 
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SCB_EZI2C_DmaInit
+****************************************************************************//**
+*
+* Initializes the DW channel which loads the TX FIFO during the read operation
+* and enables the DW block. After this function is called, the channel moves
+* the buffer data starting from the base address into the TX FIFO, followed by
+* 0xFF bytes when the read passes the end of the buffer. The channel is
+* stopped on the Stop condition, so no DW channel interrupt is required.
+*
+* \param base
+* The pointer to the EZI2C SCB instance.
+*
+* \param dma
+* The DMA configuration \ref cy_stc_scb_ezi2c_dma_t allocated by the user
+* in SRAM. The dwBase, txChannel and priority fields must be set.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_ezi2c_context_t
+* allocated by the user. The structure is used during the EZI2C operation for
+* internal configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_ezi2c_status_t
+*
+* \note
+* Call this function after \ref Cy_SCB_EZI2C_Init and before
+* \ref Cy_SCB_EZI2C_Enable.
+*
+*******************************************************************************/
+cy_en_scb_ezi2c_status_t Cy_SCB_EZI2C_DmaInit(CySCB_Type *base, cy_stc_scb_ezi2c_dma_t *dma,
+                                              cy_stc_scb_ezi2c_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L1(NULL != dma);
+
+    cy_en_scb_ezi2c_status_t retStatus = CY_SCB_EZI2C_BAD_PARAM;
+
+    if ((NULL != dma) && (NULL != dma->dwBase))
+    {
+        cy_stc_dma_descriptor_t *defaultDescr = &dma->descriptor[CY_SCB_EZI2C_DMA_DESCR_NUM - 1U];
+        cy_stc_dma_descriptor_config_t descrConfig;
+        cy_stc_dma_channel_config_t channelConfig;
+
+        dma->txDefault = CY_SCB_EZI2C_DEFAULT_TX;
+
+        /* The descriptor that loads the 0xFF bytes runs in a loop until Stop */
+        descrConfig.retrigger       = CY_DMA_RETRIG_16CYC;
+        descrConfig.interruptType   = CY_DMA_DESCR_CHAIN;
+        descrConfig.triggerOutType  = CY_DMA_DESCR_CHAIN;
+        descrConfig.channelState    = CY_DMA_CHANNEL_ENABLED;
+        descrConfig.triggerInType   = CY_DMA_1ELEMENT;
+        descrConfig.dataSize        = CY_DMA_BYTE;
+        descrConfig.srcTransferSize = CY_DMA_TRANSFER_SIZE_DATA;
+        descrConfig.dstTransferSize = CY_DMA_TRANSFER_SIZE_WORD;
+        descrConfig.descriptorType  = CY_DMA_1D_TRANSFER;
+        descrConfig.srcAddress      = (void *) &dma->txDefault;
+        descrConfig.dstAddress      = (void *) &SCB_TX_FIFO_WR(base);
+        descrConfig.srcXincrement   = 0L;
+        descrConfig.dstXincrement   = 0L;
+        descrConfig.xCount          = CY_DMA_LOOP_COUNT_MAX;
+        descrConfig.srcYincrement   = 0L;
+        descrConfig.dstYincrement   = 0L;
+        descrConfig.yCount          = 1UL;
+        descrConfig.nextDescriptor  = defaultDescr;
+
+        channelConfig.descriptor  = defaultDescr;
+        channelConfig.preemptable = false;
+        channelConfig.priority    = dma->priority;
+        channelConfig.enable      = false;
+        channelConfig.bufferable  = false;
+
+        if ((CY_DMA_SUCCESS == Cy_DMA_Descriptor_Init(defaultDescr, &descrConfig)) &&
+            (CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->txChannel, &channelConfig)))
+        {
+            Cy_DMA_Enable(dma->dwBase);
+
+            context->dma = dma;
+
+            retStatus = CY_SCB_EZI2C_SUCCESS;
+        }
+    }
+
+    return (retStatus);
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 * Function Name: Cy_SCB_EZI2C_Interrupt
 ****************************************************************************//**
@@ -949,7 +1053,17 @@ static void HandleAddress(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
                 context->bufSize = context->buf2Size - context->baseAddr2;
             }
 
-            Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
+        #if defined(CY_IP_M4CPUSS_DMA)
+            if (NULL != context->dma)
+            {
+                /* The DMA loads the TX FIFO until Stop */
+                DmaStartTransmit(base, context);
+            }
+            else
+        #endif /* CY_IP_M4CPUSS_DMA */
+            {
+                Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
+            }
         }
         else
         {
@@ -1238,6 +1352,13 @@ static void HandleStop(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
     if (CY_SCB_EZI2C_STATE_TX_DATA == context->state)
     {
         Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+
+    #if defined(CY_IP_M4CPUSS_DMA)
+        if (NULL != context->dma)
+        {
+            Cy_DMA_Channel_Disable(context->dma->dwBase, context->dma->txChannel);
+        }
+    #endif /* CY_IP_M4CPUSS_DMA */
     }
     else
     {
@@ -1266,6 +1387,47 @@ static void HandleStop(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
 }
 
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: DmaStartTransmit
+****************************************************************************//**
+*
+* Starts the DMA which loads the TX FIFO with the buffer data from the current
+* location followed by the 0xFF bytes.
+*
+* \param base
+* The pointer to the EZI2C SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_ezi2c_context_t allocated
+* by the user. The structure is used during the EZI2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void DmaStartTransmit(CySCB_Type *base, cy_stc_scb_ezi2c_context_t *context)
+{
+    cy_stc_scb_ezi2c_dma_t *dma = context->dma;
+    cy_stc_dma_descriptor_t *defaultDescr = &dma->descriptor[CY_SCB_EZI2C_DMA_DESCR_NUM - 1U];
+
+    if (context->bufSize > 0UL)
+    {
+        Cy_SCB_DmaSetDescriptors(dma->descriptor, (void const *) &SCB_TX_FIFO_WR(base),
+                                 context->curBuf, context->bufSize, false, true, true, defaultDescr);
+
+        Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->txChannel, &dma->descriptor[0U]);
+    }
+    else
+    {
+        /* The read starts past the end of the buffer */
+        Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->txChannel, defaultDescr);
+    }
+
+    Cy_DMA_Channel_Enable(dma->dwBase, dma->txChannel);
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 * Function Name: UpdateAddressMask
 ****************************************************************************//**
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_i2c.c
-* \version 2.50
+* \version 2.60
 *
 * Provides I2C API implementation of the SCB driver.
 *
@@ -44,11 +44,32 @@ static void MasterHandleDataTransmit(CySCB_Type *base, cy_stc_scb_i2c_context_t
 static void MasterHandleDataReceive (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 static void MasterHandleStop        (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
 static void MasterHandleComplete    (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+static void MasterHandleQueue       (CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+static cy_en_scb_i2c_status_t MasterStartXferPhase(CySCB_Type *base, cy_stc_scb_i2c_master_op_t *op,
+                                                   uint32_t phase, cy_stc_scb_i2c_context_t *context);
 
 static cy_en_scb_i2c_status_t HandleStatus(CySCB_Type *base, uint32_t status,
                                            cy_stc_scb_i2c_context_t *context);
 static uint32_t WaitOneUnit(uint32_t *timeout);
 
+/* The phases of the queued master operation */
+#define CY_SCB_I2C_XFER_START   (0UL)   /* Start the operation: either write or read */
+#define CY_SCB_I2C_XFER_WRITE   (1UL)   /* Write data into the slave */
+#define CY_SCB_I2C_XFER_READ    (2UL)   /* Read data from the slave using a ReStart */
+#define CY_SCB_I2C_XFER_STOP    (3UL)   /* Release the bus after the slave NAKed the write */
+#define CY_SCB_I2C_XFER_DONE    (4UL)   /* The operation is complete */
+
+#if defined(CY_IP_M4CPUSS_DMA)
+static bool MasterDmaStart(CySCB_Type *base, cy_stc_scb_i2c_context_t *context);
+static void MasterDmaStop (cy_stc_scb_i2c_context_t *context);
+
+/* The DMA is used for the transfers which do not fit into the FIFO */
+#define CY_SCB_I2C_DMA_SIZE_MIN     (CY_SCB_I2C_FIFO_SIZE)
+
+/* The largest transfer covered by the 2D descriptor and the 1D tail descriptor */
+#define CY_SCB_I2C_DMA_SIZE_MAX     (CY_DMA_LOOP_COUNT_MAX * CY_DMA_LOOP_COUNT_MAX)
+#endif /* CY_IP_M4CPUSS_DMA */
+
 
 /*******************************************************************************
 * Function Name: Cy_SCB_I2C_Init
@@ -141,6 +162,15 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_Init(CySCB_Type *base, cy_stc_scb_i2c_config_t
     context->masterStatus     = 0UL;
     context->masterBufferIdx  = 0UL;
 
+    context->masterXferHead   = NULL;
+    context->masterXferTail   = NULL;
+    context->masterXferPhase  = CY_SCB_I2C_XFER_DONE;
+
+#if defined(CY_IP_M4CPUSS_DMA)
+    context->masterDma        = NULL;
+    context->masterDmaSize    = 0UL;
+#endif /* CY_IP_M4CPUSS_DMA */
+
     /* Slave-specific */
     context->slaveStatus       = 0UL;
 
@@ -227,6 +257,14 @@ void Cy_SCB_I2C_Disable(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
     context->state        = CY_SCB_I2C_IDLE;
     context->masterStatus = 0UL;
     context->slaveStatus  = 0UL;
+
+    /* Discard the queued master transactions */
+    context->masterXferHead = NULL;
+    context->masterXferTail = NULL;
+
+#if defined(CY_IP_M4CPUSS_DMA)
+    MasterDmaStop(context);
+#endif /* CY_IP_M4CPUSS_DMA */
 }
 
 
@@ -1256,6 +1294,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterRead(CySCB_Type *base,
     if (0UL != (CY_SCB_I2C_IDLE_MASK & context->state))
     {
         uint32_t intrState;
+        uint32_t rxIntrMask = CY_SCB_RX_INTR_LEVEL;
 
         /* Set address byte (bit0 = 1, read direction) */
         uint32_t address = _VAL2FLD(CY_SCB_I2C_ADDRESS, xferConfig->slaveAddress) |
@@ -1310,6 +1349,14 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterRead(CySCB_Type *base,
                                         (context->masterBufferSize - 2UL) : ((fifoSize / 2UL) - 1UL));
 
             context->state = CY_SCB_I2C_MASTER_RX1;
+
+        #if defined(CY_IP_M4CPUSS_DMA)
+            if (MasterDmaStart(base, context))
+            {
+                /* The RX interrupt is enabled on the DMA completion */
+                rxIntrMask = CY_SCB_CLEAR_ALL_INTR_SRC;
+            }
+        #endif /* CY_IP_M4CPUSS_DMA */
         }
         else
         {
@@ -1324,7 +1371,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterRead(CySCB_Type *base,
         * interrupt sources.
         */
         intrState = Cy_SysLib_EnterCriticalSection();
-        Cy_SCB_SetRxInterruptMask    (base, CY_SCB_RX_INTR_LEVEL);
+        Cy_SCB_SetRxInterruptMask    (base, rxIntrMask);
         Cy_SCB_SetMasterInterruptMask(base, CY_SCB_I2C_MASTER_INTR);
         Cy_SysLib_ExitCriticalSection(intrState);
 
@@ -1363,8 +1410,16 @@ void Cy_SCB_I2C_MasterAbortRead(CySCB_Type *base, cy_stc_scb_i2c_context_t *cont
 
     intrState = Cy_SysLib_EnterCriticalSection();
 
+    /* Discard the queued transactions */
+    context->masterXferHead = NULL;
+    context->masterXferTail = NULL;
+
     if (0UL != (CY_SCB_I2C_MASTER_BUSY & context->masterStatus))
     {
+    #if defined(CY_IP_M4CPUSS_DMA)
+        MasterDmaStop(context);
+    #endif /* CY_IP_M4CPUSS_DMA */
+
         /* Catch state to abort read operation */
         if ((CY_SCB_I2C_MASTER_RX0 == context->state) || (CY_SCB_I2C_MASTER_RX1 == context->state))
         {
@@ -1484,6 +1539,7 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWrite(CySCB_Type *base,
     if (0UL != (CY_SCB_I2C_IDLE_MASK & context->state))
     {
         uint32_t intrState;
+        uint32_t txIntrMask = CY_SCB_TX_INTR_LEVEL;
 
         /* Set address byte (bit0 = 0, write direction) */
         uint32_t address = _VAL2FLD(CY_SCB_I2C_ADDRESS, xferConfig->slaveAddress);
@@ -1549,12 +1605,20 @@ cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterWrite(CySCB_Type *base,
         /* TX FIFO is empty. Set level to start transfer */
         Cy_SCB_SetTxFifoLevel(base, (context->useTxFifo) ? CY_SCB_I2C_HALF_FIFO_SIZE : (1UL));
 
+    #if defined(CY_IP_M4CPUSS_DMA)
+        if (MasterDmaStart(base, context))
+        {
+            /* The TX interrupt is enabled on the DMA completion */
+            txIntrMask = CY_SCB_CLEAR_ALL_INTR_SRC;
+        }
+    #endif /* CY_IP_M4CPUSS_DMA */
+
         /* Enable interrupt sources to continue transfer.
         * Requires critical section to not cause race condition between TX and Master
         * interrupt sources.
         */
         intrState = Cy_SysLib_EnterCriticalSection();
-        Cy_SCB_SetTxInterruptMask    (base, CY_SCB_TX_INTR_LEVEL);
+        Cy_SCB_SetTxInterruptMask    (base, txIntrMask);
         Cy_SCB_SetMasterInterruptMask(base, CY_SCB_I2C_MASTER_INTR);
         Cy_SysLib_ExitCriticalSection(intrState);
 
@@ -1603,8 +1667,16 @@ void Cy_SCB_I2C_MasterAbortWrite(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
 
     intrState = Cy_SysLib_EnterCriticalSection();
 
+    /* Discard the queued transactions */
+    context->masterXferHead = NULL;
+    context->masterXferTail = NULL;
+
     if (0UL != (CY_SCB_I2C_MASTER_BUSY & context->masterStatus))
     {
+    #if defined(CY_IP_M4CPUSS_DMA)
+        MasterDmaStop(context);
+    #endif /* CY_IP_M4CPUSS_DMA */
+
         /* Disable TX processing */
         Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
 
@@ -1694,6 +1766,184 @@ uint32_t Cy_SCB_I2C_MasterGetTransferCount(CySCB_Type const *base, cy_stc_scb_i2
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SCB_I2C_MasterTransferQueue
+****************************************************************************//**
+*
+* Adds the transaction to the master transaction queue. The transaction is
+* a list of operations \ref cy_stc_scb_i2c_master_op_t. Each operation writes
+* data into the slave and then reads data from the slave using a ReStart
+* condition. The operation ends with a Stop condition.
+*
+* If the queue is empty the first operation is started by this function,
+* otherwise the transaction is executed after the queued transactions.
+* \ref Cy_SCB_I2C_Interrupt starts the next operation as soon as the previous
+* one completes, therefore no CPU intervention is required between operations.
+* When all operations of the transaction are complete, the transaction
+* callback is called. The status of each operation is reported in its
+* status field.
+*
+* The \ref group_scb_i2c_macros_callback_events are not generated for the
+* queued operations, except \ref CY_SCB_I2C_MASTER_ERR_EVENT: it is generated
+* when \ref Cy_SCB_I2C_Interrupt fails to start the next operation or phase.
+* Such an operation is completed with the \ref CY_SCB_I2C_MASTER_ABORT_START
+* status and the queue continues with the next operation.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param transaction
+* The pointer to the transaction \ref cy_stc_scb_i2c_master_transaction_t.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_i2c_status_t. \ref CY_SCB_I2C_BAD_PARAM is returned when
+* the transaction has no operations.
+*
+* \note
+* * The transaction structure, operations and buffers must not be modified and
+*   must stay allocated until the transaction callback is called.
+*
+* * The queue must not be mixed with \ref Cy_SCB_I2C_MasterWrite or
+*   \ref Cy_SCB_I2C_MasterRead: the function returns
+*   \ref CY_SCB_I2C_MASTER_NOT_READY when the master is busy with a transfer
+*   that was not started by the queue.
+*
+* * \ref Cy_SCB_I2C_MasterAbortWrite and \ref Cy_SCB_I2C_MasterAbortRead
+*   abort the operation in progress and discard the queue. The callbacks of the
+*   discarded transactions are not called.
+*
+*******************************************************************************/
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterTransferQueue(CySCB_Type *base,
+                                              cy_stc_scb_i2c_master_transaction_t *transaction,
+                                              cy_stc_scb_i2c_context_t *context)
+{
+    CY_ASSERT_L1(NULL != transaction);
+    CY_ASSERT_L1(NULL != transaction->ops);
+    CY_ASSERT_L2(transaction->numOps > 0UL);
+
+    cy_en_scb_i2c_status_t retStatus = CY_SCB_I2C_BAD_PARAM;
+    uint32_t intrState;
+
+    if ((NULL != transaction) && (NULL != transaction->ops) && (0UL != transaction->numOps))
+    {
+        retStatus = CY_SCB_I2C_SUCCESS;
+
+        transaction->opIdx = 0UL;
+        transaction->next  = NULL;
+
+        intrState = Cy_SysLib_EnterCriticalSection();
+
+        if (NULL != context->masterXferHead)
+        {
+            /* Append the transaction to the queue */
+            context->masterXferTail->next = transaction;
+            context->masterXferTail       = transaction;
+        }
+        else
+        {
+            /* Start the first operation of the transaction */
+            retStatus = MasterStartXferPhase(base, &transaction->ops[0UL], CY_SCB_I2C_XFER_START, context);
+
+            if (CY_SCB_I2C_SUCCESS == retStatus)
+            {
+                context->masterXferHead = transaction;
+                context->masterXferTail = transaction;
+            }
+        }
+
+        Cy_SysLib_ExitCriticalSection(intrState);
+    }
+
+    return (retStatus);
+}
+
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SCB_I2C_MasterDmaInit
+****************************************************************************//**
+*
+* Initializes the DW channels which move the data between the I2C master FIFOs
+* and the buffers of \ref Cy_SCB_I2C_MasterWrite and \ref Cy_SCB_I2C_MasterRead,
+* unmasks the channel interrupts and enables the DW block.
+*
+* After this function is called, the transfers longer than the FIFO are
+* executed with the DMA: the TX channel loads all data bytes except the last
+* one, and the RX channel reads all data bytes except the last two.
+* The remaining bytes are handled by \ref Cy_SCB_I2C_Interrupt to generate
+* the NACK and Stop conditions. The interrupts of both channels must call
+* \ref Cy_SCB_I2C_MasterDmaInterrupt.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param dma
+* The DMA configuration \ref cy_stc_scb_i2c_master_dma_t allocated by the user
+* in SRAM. The dwBase, rxChannel, txChannel and priority fields must be set.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_i2c_status_t
+*
+* \note
+* The SCB must be configured as the I2C master or master-slave with the RX and
+* TX FIFOs enabled (useRxFifo and useTxFifo). Call this function when the
+* master is not busy.
+*
+*******************************************************************************/
+cy_en_scb_i2c_status_t Cy_SCB_I2C_MasterDmaInit(CySCB_Type *base, cy_stc_scb_i2c_master_dma_t *dma,
+                                                cy_stc_scb_i2c_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    CY_ASSERT_L1(NULL != dma);
+
+    cy_en_scb_i2c_status_t retStatus = CY_SCB_I2C_BAD_PARAM;
+    cy_stc_dma_channel_config_t channelConfig;
+
+    if ((NULL != dma) && (NULL != dma->dwBase) && (dma->rxChannel != dma->txChannel) &&
+        (context->useRxFifo) && (context->useTxFifo) &&
+        (((uint32_t) CY_SCB_I2C_SLAVE) != _FLD2VAL(CY_SCB_I2C_CTRL_MODE, SCB_I2C_CTRL(base))))
+    {
+        channelConfig.descriptor  = &dma->rxDescriptor[0U];
+        channelConfig.preemptable = false;
+        channelConfig.priority    = dma->priority;
+        channelConfig.enable      = false;
+        channelConfig.bufferable  = false;
+
+        if (CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->rxChannel, &channelConfig))
+        {
+            channelConfig.descriptor = &dma->txDescriptor[0U];
+
+            if (CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->txChannel, &channelConfig))
+            {
+                Cy_DMA_Channel_SetInterruptMask(dma->dwBase, dma->rxChannel, CY_DMA_INTR_MASK);
+                Cy_DMA_Channel_SetInterruptMask(dma->dwBase, dma->txChannel, CY_DMA_INTR_MASK);
+                Cy_DMA_Enable(dma->dwBase);
+
+                context->masterDma     = dma;
+                context->masterDmaSize = 0UL;
+
+                retStatus = CY_SCB_I2C_SUCCESS;
+            }
+        }
+    }
+
+    return (retStatus);
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 *                         I2C Master API: Low level
 *******************************************************************************/
@@ -2753,6 +3003,109 @@ void Cy_SCB_I2C_MasterInterrupt(CySCB_Type *base, cy_stc_scb_i2c_context_t *cont
 }
 
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SCB_I2C_MasterDmaInterrupt
+****************************************************************************//**
+*
+* The DMA completion handler for the master transfers started with the DMA
+* (see \ref Cy_SCB_I2C_MasterDmaInit). It must be called from the interrupt
+* handlers of both DW channels of \ref cy_stc_scb_i2c_master_dma_t. When the DMA
+* has moved its part of the data, it passes the remaining bytes to
+* \ref Cy_SCB_I2C_Interrupt.
+*
+* When a DW channel reports an error, the transfer is stopped as by
+* \ref Cy_SCB_I2C_MasterAbortWrite or \ref Cy_SCB_I2C_MasterAbortRead and
+* completes with \ref CY_SCB_I2C_MASTER_DMA_ERR. Only the current operation
+* fails: the queued transactions are kept and continue after the Stop.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+void Cy_SCB_I2C_MasterDmaInterrupt(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    cy_stc_scb_i2c_master_dma_t const *dma = context->masterDma;
+    uint32_t channel;
+    uint32_t intrState;
+
+    CY_ASSERT_L1(NULL != dma);
+
+    /* Protect the transfer state from Cy_SCB_I2C_Interrupt */
+    intrState = Cy_SysLib_EnterCriticalSection();
+
+    channel = (context->masterRdDir) ? dma->rxChannel : dma->txChannel;
+
+    if (0UL != Cy_DMA_Channel_GetInterruptStatus(dma->dwBase, channel))
+    {
+        cy_en_dma_intr_cause_t dmaStatus = Cy_DMA_Channel_GetStatus(dma->dwBase, channel);
+
+        Cy_DMA_Channel_ClearInterrupt(dma->dwBase, channel);
+
+        /* Skip the completion of the DMA already stopped by the master */
+        if (0UL != context->masterDmaSize)
+        {
+            if (CY_DMA_INTR_CAUSE_COMPLETION == dmaStatus)
+            {
+                uint32_t numMoved = context->masterDmaSize;
+
+                context->masterDmaSize     = 0UL;
+                context->masterBufferIdx  += numMoved;
+                context->masterBufferSize -= numMoved;
+                context->masterBuffer      = &context->masterBuffer[numMoved];
+
+                /* Continue the transfer from the interrupt */
+                if (context->masterRdDir)
+                {
+                    uint32_t halfFifoSize = CY_SCB_I2C_HALF_FIFO_SIZE;
+
+                    /* At least two bytes are left: Adjust the level in RX FIFO */
+                    Cy_SCB_SetRxFifoLevel(base, (context->masterBufferSize <= halfFifoSize) ?
+                                                (context->masterBufferSize - 2UL) : (halfFifoSize - 1UL));
+
+                    Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL);
+                }
+                else
+                {
+                    Cy_SCB_SetTxFifoLevel    (base, CY_SCB_I2C_HALF_FIFO_SIZE);
+                    Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
+                }
+            }
+            else
+            {
+                /* The DMA failed: abort the transfer but keep the queue, which
+                * continues when the Stop completes the failed operation.
+                */
+                cy_stc_scb_i2c_master_transaction_t *xferHead = context->masterXferHead;
+                cy_stc_scb_i2c_master_transaction_t *xferTail = context->masterXferTail;
+
+                if (context->masterRdDir)
+                {
+                    Cy_SCB_I2C_MasterAbortRead(base, context);
+                }
+                else
+                {
+                    Cy_SCB_I2C_MasterAbortWrite(base, context);
+                }
+
+                context->masterXferHead = xferHead;
+                context->masterXferTail = xferTail;
+                context->masterStatus  |= CY_SCB_I2C_MASTER_DMA_ERR;
+            }
+        }
+    }
+
+    Cy_SysLib_ExitCriticalSection(intrState);
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 * Function Name: MasterHandleMasterEvents
 ****************************************************************************//**
@@ -3017,6 +3370,10 @@ static void MasterHandleDataTransmit(CySCB_Type *base, cy_stc_scb_i2c_context_t
 *******************************************************************************/
 static void MasterHandleStop(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
 {
+#if defined(CY_IP_M4CPUSS_DMA)
+    MasterDmaStop(context);
+#endif /* CY_IP_M4CPUSS_DMA */
+
     /* Stop RX and TX processing */
     Cy_SCB_SetRxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
     Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
@@ -3063,6 +3420,11 @@ static void MasterHandleComplete(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
 
     /* Clean-up hardware */
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    /* Stop the DMA if the transfer ended before the DMA completion */
+    MasterDmaStop(context);
+#endif /* CY_IP_M4CPUSS_DMA */
+
     /* Disable auto data ACK option */
     SCB_I2C_CTRL(base) &= (uint32_t) ~SCB_I2C_CTRL_M_READY_DATA_ACK_Msk;
 
@@ -3127,8 +3489,13 @@ static void MasterHandleComplete(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
         context->state = (context->masterPause) ? CY_SCB_I2C_MASTER_WAIT : CY_SCB_I2C_IDLE;
     }
 
+    if (NULL != context->masterXferHead)
+    {
+        /* Continue the queued transaction */
+        MasterHandleQueue(base, context);
+    }
     /* An operation completion callback */
-    if (NULL != context->cbEvents)
+    else if (NULL != context->cbEvents)
     {
         /* Get completion events based on the hardware status */
         uint32_t locEvents = context->masterRdDir ? CY_SCB_I2C_MASTER_RD_CMPLT_EVENT : CY_SCB_I2C_MASTER_WR_CMPLT_EVENT;
@@ -3142,6 +3509,316 @@ static void MasterHandleComplete(CySCB_Type *base, cy_stc_scb_i2c_context_t *con
 
 
 
+/*******************************************************************************
+* Function Name: MasterHandleQueue
+****************************************************************************//**
+*
+* Handles the completion of the queued operation phase: continues the
+* operation, starts the next operation or completes the transaction.
+* The operation that cannot be started is completed with the
+* CY_SCB_I2C_MASTER_ABORT_START status and CY_SCB_I2C_MASTER_ERR_EVENT is
+* reported.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void MasterHandleQueue(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    cy_stc_scb_i2c_master_transaction_t *transaction = context->masterXferHead;
+    cy_stc_scb_i2c_master_transaction_t *doneXfer;
+    cy_stc_scb_i2c_master_op_t *op = &transaction->ops[transaction->opIdx];
+    uint32_t phase = CY_SCB_I2C_XFER_DONE;
+    bool opDone;
+    bool opFailed = false;
+    bool errEvent = false;
+
+    /* Collect errors of the completed phase */
+    op->status |= (CY_SCB_I2C_MASTER_ERR & context->masterStatus);
+
+    /* The write phase that is followed by the read keeps the bus */
+    if ((CY_SCB_I2C_XFER_WRITE == context->masterXferPhase) && (CY_SCB_I2C_MASTER_WAIT == context->state))
+    {
+        if (0UL == (CY_SCB_I2C_MASTER_ERR & op->status))
+        {
+            phase = CY_SCB_I2C_XFER_READ;
+        }
+        else if (0UL != ((CY_SCB_I2C_MASTER_ADDR_NAK | CY_SCB_I2C_MASTER_DATA_NAK) & op->status))
+        {
+            /* The slave NAKed: skip the read and release the bus */
+            phase = CY_SCB_I2C_XFER_STOP;
+        }
+        else
+        {
+            /* The start was aborted: the master does not own the bus */
+            context->state = CY_SCB_I2C_IDLE;
+        }
+    }
+
+    if (CY_SCB_I2C_XFER_DONE != phase)
+    {
+        /* Continue the operation */
+        opFailed = (CY_SCB_I2C_SUCCESS != MasterStartXferPhase(base, op, phase, context));
+    }
+
+    opDone = ((CY_SCB_I2C_XFER_DONE == phase) || opFailed);
+
+    /* Complete the operations until one is started or the queue is empty */
+    while (opDone)
+    {
+        if (opFailed)
+        {
+            /* The operation or its phase failed to start */
+            op->status |= CY_SCB_I2C_MASTER_ABORT_START;
+            errEvent = true;
+        }
+
+        /* The operation is complete */
+        op->status &= (uint32_t) ~CY_SCB_I2C_MASTER_BUSY;
+        context->masterXferPhase = CY_SCB_I2C_XFER_DONE;
+        opFailed = false;
+
+        ++transaction->opIdx;
+
+        if (transaction->opIdx < transaction->numOps)
+        {
+            /* Start the next operation of the transaction */
+            op = &transaction->ops[transaction->opIdx];
+            opFailed = (CY_SCB_I2C_SUCCESS != MasterStartXferPhase(base, op, CY_SCB_I2C_XFER_START, context));
+        }
+        else
+        {
+            /* The transaction is complete: start the next queued one */
+            doneXfer    = transaction;
+            transaction = transaction->next;
+            context->masterXferHead = transaction;
+
+            if (NULL == transaction)
+            {
+                context->masterXferTail = NULL;
+            }
+            else
+            {
+                op = &transaction->ops[0UL];
+                opFailed = (CY_SCB_I2C_SUCCESS != MasterStartXferPhase(base, op, CY_SCB_I2C_XFER_START, context));
+            }
+
+            if (NULL != doneXfer->callback)
+            {
+                doneXfer->callback(doneXfer);
+            }
+        }
+
+        opDone = opFailed;
+    }
+
+    if ((errEvent) && (NULL != context->cbEvents))
+    {
+        context->cbEvents(CY_SCB_I2C_MASTER_ERR_EVENT);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: MasterStartXferPhase
+****************************************************************************//**
+*
+* Starts the phase of the queued operation.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param op
+* The pointer to the operation \ref cy_stc_scb_i2c_master_op_t.
+*
+* \param phase
+* The phase to start. CY_SCB_I2C_XFER_START selects the first phase of
+* the operation: write or read, when the operation has nothing to write.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_i2c_status_t
+*
+*******************************************************************************/
+static cy_en_scb_i2c_status_t MasterStartXferPhase(CySCB_Type *base, cy_stc_scb_i2c_master_op_t *op,
+                                                   uint32_t phase, cy_stc_scb_i2c_context_t *context)
+{
+    cy_en_scb_i2c_status_t retStatus = CY_SCB_I2C_SUCCESS;
+    cy_stc_scb_i2c_master_xfer_config_t xferConfig;
+
+    xferConfig.slaveAddress = op->slaveAddress;
+
+    if (CY_SCB_I2C_XFER_START == phase)
+    {
+        op->status = CY_SCB_I2C_MASTER_BUSY;
+
+        phase = ((op->wrSize > 0UL) || (0UL == op->rdSize)) ? CY_SCB_I2C_XFER_WRITE : CY_SCB_I2C_XFER_READ;
+    }
+
+    context->masterXferPhase = phase;
+
+    switch (phase)
+    {
+        case CY_SCB_I2C_XFER_WRITE:
+        {
+            /* Keep the bus when the read follows */
+            xferConfig.buffer      = op->wrBuffer;
+            xferConfig.bufferSize  = op->wrSize;
+            xferConfig.xferPending = (op->rdSize > 0UL);
+
+            retStatus = Cy_SCB_I2C_MasterWrite(base, &xferConfig, context);
+        }
+        break;
+
+        case CY_SCB_I2C_XFER_READ:
+        {
+            xferConfig.buffer      = op->rdBuffer;
+            xferConfig.bufferSize  = op->rdSize;
+            xferConfig.xferPending = false;
+
+            retStatus = Cy_SCB_I2C_MasterRead(base, &xferConfig, context);
+        }
+        break;
+
+        default:
+        {
+            /* Release the bus held by the write phase */
+            context->masterStatus   = CY_SCB_I2C_MASTER_BUSY;
+            context->masterNumBytes = 0UL;
+            context->masterPause    = false;
+
+            /* Enable master interrupt sources to catch Stop condition */
+            Cy_SCB_SetMasterInterruptMask(base, CY_SCB_I2C_MASTER_INTR);
+
+            /* Complete transaction generating Stop */
+            SCB_I2C_M_CMD(base) = (SCB_I2C_M_CMD_M_STOP_Msk | SCB_I2C_M_CMD_M_NACK_Msk);
+            context->state = CY_SCB_I2C_MASTER_WAIT_STOP;
+        }
+        break;
+    }
+
+    return (retStatus);
+}
+
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: MasterDmaStart
+****************************************************************************//**
+*
+* Starts the DMA for the transfer set up by \ref Cy_SCB_I2C_MasterWrite or
+* \ref Cy_SCB_I2C_MasterRead if the DMA is initialized and the transfer does
+* not fit into the FIFO. The DMA moves all bytes except the last byte of the
+* write or the last two bytes of the read, which end the transfer.
+*
+* \param base
+* The pointer to the I2C SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* True - the DMA is started, false - the transfer is handled by the interrupt.
+*
+*******************************************************************************/
+static bool MasterDmaStart(CySCB_Type *base, cy_stc_scb_i2c_context_t *context)
+{
+    cy_stc_scb_i2c_master_dma_t *dma = context->masterDma;
+    bool dmaStarted = false;
+
+    if ((NULL != dma) && (context->masterBufferSize > CY_SCB_I2C_DMA_SIZE_MIN))
+    {
+        uint32_t size = context->masterBufferSize - ((context->masterRdDir) ? 2UL : 1UL);
+
+        if (size > CY_SCB_I2C_DMA_SIZE_MAX)
+        {
+            /* The interrupt handles the rest */
+            size = CY_SCB_I2C_DMA_SIZE_MAX;
+        }
+
+        if (context->masterRdDir)
+        {
+            Cy_SCB_DmaSetDescriptors(dma->rxDescriptor, (void const *) &SCB_RX_FIFO_RD(base),
+                                     context->masterBuffer, size, true, true, true, NULL);
+
+            Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->rxChannel, &dma->rxDescriptor[0U]);
+
+            /* Request the DMA while the RX FIFO is not empty */
+            Cy_SCB_SetRxFifoLevel(base, 0UL);
+            Cy_DMA_Channel_Enable(dma->dwBase, dma->rxChannel);
+        }
+        else
+        {
+            Cy_SCB_DmaSetDescriptors(dma->txDescriptor, (void const *) &SCB_TX_FIFO_WR(base),
+                                     context->masterBuffer, size, false, true, true, NULL);
+
+            Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->txChannel, &dma->txDescriptor[0U]);
+
+            /* Request the DMA while the TX FIFO is not full */
+            Cy_SCB_SetTxFifoLevel(base, CY_SCB_I2C_FIFO_SIZE - 1UL);
+            Cy_DMA_Channel_Enable(dma->dwBase, dma->txChannel);
+        }
+
+        context->masterDmaSize = size;
+        dmaStarted = true;
+    }
+
+    return (dmaStarted);
+}
+
+
+/*******************************************************************************
+* Function Name: MasterDmaStop
+****************************************************************************//**
+*
+* Stops the DMA of the master transfer which ends before the DMA completion
+* (NAK, error or abort) and updates the transfer progress with the number of
+* bytes moved by the DMA.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_i2c_context_t allocated
+* by the user. The structure is used during the I2C operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void MasterDmaStop(cy_stc_scb_i2c_context_t *context)
+{
+    if (0UL != context->masterDmaSize)
+    {
+        cy_stc_scb_i2c_master_dma_t const *dma = context->masterDma;
+        uint32_t channel = (context->masterRdDir) ? dma->rxChannel : dma->txChannel;
+        uint32_t numMoved;
+
+        Cy_DMA_Channel_Disable(dma->dwBase, channel);
+        Cy_DMA_Channel_ClearInterrupt(dma->dwBase, channel);
+
+        numMoved = Cy_SCB_DmaGetNumTransferred(dma->dwBase, channel, (context->masterRdDir) ?
+                                               dma->rxDescriptor : dma->txDescriptor, context->masterDmaSize);
+
+        context->masterDmaSize     = 0UL;
+        context->masterBufferIdx  += numMoved;
+        context->masterBufferSize -= numMoved;
+        context->masterBuffer      = &context->masterBuffer[numMoved];
+    }
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /******************************************************************************
 * Function Name: WaitOneUnit
 ****************************************************************************//**
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_spi.c
-* \version 2.50
+* \version 2.60
 *
 * Provides SPI API implementation of the SCB driver.
 *
@@ -34,6 +34,13 @@ extern "C" {
 static void HandleTransmit(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
 static void HandleReceive (CySCB_Type *base, cy_stc_scb_spi_context_t *context);
 static void DiscardArrayNoCheck(CySCB_Type const *base, uint32_t size);
+#if defined(CY_IP_M4CPUSS_DMA)
+static void DmaStartTransaction(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
+static void DmaStopQueue(CySCB_Type *base, cy_stc_scb_spi_context_t *context);
+
+/* The largest transaction covered by the 2D descriptor and the 1D tail descriptor */
+#define CY_SCB_SPI_DMA_SIZE_MAX     (CY_DMA_LOOP_COUNT_MAX * CY_DMA_LOOP_COUNT_MAX)
+#endif /* CY_IP_M4CPUSS_DMA */
 
 /*******************************************************************************
 * Function Name: Cy_SCB_SPI_Init
@@ -137,6 +144,10 @@ cy_en_scb_spi_status_t Cy_SCB_SPI_Init(CySCB_Type *base, cy_stc_scb_spi_config_t
 
         context->cbEvents = NULL;
 
+    #if defined(CY_IP_M4CPUSS_DMA)
+        context->dma = NULL;
+    #endif /* CY_IP_M4CPUSS_DMA */
+
     #if !defined(NDEBUG)
         /* Put an initialization key into the initKey variable to verify
         * context initialization in the transfer API.
@@ -691,6 +702,11 @@ cy_en_scb_spi_status_t Cy_SCB_SPI_Transfer(CySCB_Type *base, void *txBuffer, voi
 * the transfer is complete. Otherwise, received data will be kept and
 * copied to the buffer when \ref Cy_SCB_SPI_Transfer is called.
 *
+* \note
+* If the DMA is initialized by \ref Cy_SCB_SPI_DmaInit, the DW channels are
+* disabled and the transactions queued by \ref Cy_SCB_SPI_TransferQueue are
+* dropped without calling their callbacks.
+*
 * \sideeffect
 * The transmit FIFO clear operation also clears the shift register, so that
 * the shifter can be cleared in the middle of a data element transfer,
@@ -714,6 +730,18 @@ void Cy_SCB_SPI_AbortTransfer(CySCB_Type *base, cy_stc_scb_spi_context_t *contex
         Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_UNDERFLOW);
     }
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    if (NULL != context->dma)
+    {
+        uint32_t intrStatus = Cy_SysLib_EnterCriticalSection();
+
+        /* Stop the DW channels before the FIFOs are cleared */
+        DmaStopQueue(base, context);
+
+        Cy_SysLib_ExitCriticalSection(intrStatus);
+    }
+#endif /* CY_IP_M4CPUSS_DMA */
+
     /* Clear FIFOs */
     Cy_SCB_SPI_ClearTxFifo(base);
     Cy_SCB_SPI_ClearRxFifo(base);
@@ -786,6 +814,189 @@ uint32_t Cy_SCB_SPI_GetTransferStatus(CySCB_Type const *base, cy_stc_scb_spi_con
 }
 
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SCB_SPI_DmaInit
+****************************************************************************//**
+*
+* Initializes the DW channels which move the data between the SPI master FIFOs
+* and the transaction buffers for \ref Cy_SCB_SPI_TransferQueue, unmasks the
+* channel interrupts and enables the DW block.
+*
+* The TX channel loads one data element when the TX FIFO is not full, and the
+* RX channel reads one data element when the RX FIFO is not empty, so the
+* FIFOs never run dry during a transaction. The interrupts of both channels
+* must call \ref Cy_SCB_SPI_DmaInterrupt. When the queued transactions use
+* different slave select lines, the SCB interrupt must call
+* \ref Cy_SCB_SPI_Interrupt: a transaction which selects another slave is
+* started on the master done event, when the bus is idle.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param dma
+* The DMA configuration \ref cy_stc_scb_spi_dma_t allocated by the user in
+* SRAM. The dwBase, rxChannel, txChannel and priority fields must be set.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_spi_status_t
+*
+* \note
+* * The SCB must be configured as the SPI master.
+* * This function overrides all RX and TX FIFO interrupt sources and changes
+*   the RX and TX FIFO level. \ref Cy_SCB_SPI_Transfer restores them, but must
+*   not be called while the transaction queue is not empty.
+*
+*******************************************************************************/
+cy_en_scb_spi_status_t Cy_SCB_SPI_DmaInit(CySCB_Type *base, cy_stc_scb_spi_dma_t *dma,
+                                          cy_stc_scb_spi_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    #if !defined(NDEBUG)
+    CY_ASSERT_L1(CY_SCB_SPI_INIT_KEY == context->initKey);
+    #endif
+    CY_ASSERT_L1(NULL != dma);
+
+    cy_en_scb_spi_status_t retStatus = CY_SCB_SPI_BAD_PARAM;
+    cy_stc_dma_channel_config_t channelConfig;
+
+    if ((NULL != dma) && (NULL != dma->dwBase) && (dma->rxChannel != dma->txChannel) &&
+        _FLD2BOOL(SCB_SPI_CTRL_MASTER_MODE, SCB_SPI_CTRL(base)))
+    {
+        channelConfig.descriptor  = &dma->rxDescriptor[0U];
+        channelConfig.preemptable = false;
+        channelConfig.priority    = dma->priority;
+        channelConfig.enable      = false;
+        channelConfig.bufferable  = false;
+
+        if (CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->rxChannel, &channelConfig))
+        {
+            channelConfig.descriptor = &dma->txDescriptor[0U];
+
+            if (CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->txChannel, &channelConfig))
+            {
+                Cy_DMA_Channel_SetInterruptMask(dma->dwBase, dma->rxChannel, CY_DMA_INTR_MASK);
+                Cy_DMA_Channel_SetInterruptMask(dma->dwBase, dma->txChannel, CY_DMA_INTR_MASK);
+                Cy_DMA_Enable(dma->dwBase);
+
+                /* The DMA moves the data: disable the interrupt sources of Cy_SCB_SPI_Interrupt */
+                Cy_SCB_SetRxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+                Cy_SCB_SetTxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+
+                /* Request the DMA while the TX FIFO is not full and the RX FIFO is not empty */
+                Cy_SCB_SetTxFifoLevel(base, Cy_SCB_GetFifoSize(base) - 1UL);
+                Cy_SCB_SetRxFifoLevel(base, 0UL);
+
+                context->dma          = dma;
+                context->xferHead     = NULL;
+                context->xferTail     = NULL;
+                context->dmaTxDefault = CY_SCB_SPI_DEFAULT_TX;
+
+                retStatus = CY_SCB_SPI_SUCCESS;
+            }
+        }
+    }
+
+    return (retStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_SPI_TransferQueue
+****************************************************************************//**
+*
+* Adds a transaction to the SPI master DMA transaction queue. If no transfer
+* is in progress, it selects the slave and starts the DW channels.
+* \ref Cy_SCB_SPI_DmaInterrupt starts the queued transactions one after
+* another when the previous one is complete (all data is received).
+*
+* The transaction callback is called when the transaction is complete. When
+* the queue is empty, the \ref CY_SCB_SPI_TRANSFER_ACTIVE status is cleared
+* and the \ref CY_SCB_SPI_TRANSFER_CMPLT_EVENT event is generated.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param transaction
+* The pointer to the transaction \ref cy_stc_scb_spi_transaction_t allocated by
+* the user. The slaveSelect, txBuffer, rxBuffer, size, callback and userData
+* fields must be set.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_spi_status_t
+*
+* \note
+* * The DMA must be initialized by \ref Cy_SCB_SPI_DmaInit.
+* * The transaction and buffers must not be modified and must stay allocated
+*   until the transaction callback is called.
+* * The function returns \ref CY_SCB_SPI_TRANSFER_BUSY if the transfer started
+*   by \ref Cy_SCB_SPI_Transfer is in progress.
+*
+*******************************************************************************/
+cy_en_scb_spi_status_t Cy_SCB_SPI_TransferQueue(CySCB_Type *base, cy_stc_scb_spi_transaction_t *transaction,
+                                                cy_stc_scb_spi_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    #if !defined(NDEBUG)
+    CY_ASSERT_L1(CY_SCB_SPI_INIT_KEY == context->initKey);
+    #endif
+    CY_ASSERT_L1(NULL != transaction);
+    CY_ASSERT_L3(CY_SCB_SPI_IS_SLAVE_SEL_VALID(transaction->slaveSelect));
+
+    cy_en_scb_spi_status_t retStatus = CY_SCB_SPI_BAD_PARAM;
+
+    if ((NULL != context->dma) && (transaction->size > 0UL) && (transaction->size <= CY_SCB_SPI_DMA_SIZE_MAX))
+    {
+        uint32_t intrStatus;
+
+        transaction->next = NULL;
+
+        intrStatus = Cy_SysLib_EnterCriticalSection();
+
+        if (NULL != context->xferHead)
+        {
+            /* Start the transaction after the queued ones */
+            context->xferTail->next = transaction;
+            context->xferTail = transaction;
+
+            retStatus = CY_SCB_SPI_SUCCESS;
+        }
+        else if (0UL == (CY_SCB_SPI_TRANSFER_ACTIVE & context->status))
+        {
+            context->status   = CY_SCB_SPI_TRANSFER_ACTIVE;
+            context->xferHead = transaction;
+            context->xferTail = transaction;
+
+            DmaStartTransaction(base, context);
+
+            retStatus = CY_SCB_SPI_SUCCESS;
+        }
+        else
+        {
+            /* The transfer started by Cy_SCB_SPI_Transfer is in progress */
+            retStatus = CY_SCB_SPI_TRANSFER_BUSY;
+        }
+
+        Cy_SysLib_ExitCriticalSection(intrStatus);
+    }
+
+    return (retStatus);
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 * Function Name: Cy_SCB_SPI_Interrupt
 ****************************************************************************//**
@@ -807,6 +1018,7 @@ uint32_t Cy_SCB_SPI_GetTransferStatus(CySCB_Type const *base, cy_stc_scb_spi_con
 void Cy_SCB_SPI_Interrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
 {
      bool locXferErr = false;
+     bool locDmaQueue = false;
 
     /* Wake up on the slave select condition */
     if (0UL != (CY_SCB_SPI_INTR_WAKEUP & Cy_SCB_GetSpiInterruptStatusMasked(base)))
@@ -850,6 +1062,25 @@ void Cy_SCB_SPI_Interrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
         }
     }
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    /* The bus is idle: start the queued transaction which selects another slave */
+    if (0UL != (CY_SCB_MASTER_INTR_SPI_DONE & Cy_SCB_GetMasterInterruptStatusMasked(base)))
+    {
+        uint32_t intrStatus = Cy_SysLib_EnterCriticalSection();
+
+        Cy_SCB_SetMasterInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+        Cy_SCB_ClearMasterInterrupt(base, CY_SCB_MASTER_INTR_SPI_DONE);
+
+        if (NULL != context->xferHead)
+        {
+            Cy_SCB_SPI_SetActiveSlaveSelect(base, context->xferHead->slaveSelect);
+            DmaStartTransaction(base, context);
+        }
+
+        Cy_SysLib_ExitCriticalSection(intrStatus);
+    }
+#endif /* CY_IP_M4CPUSS_DMA */
+
     /* RX direction */
     if (0UL != (CY_SCB_RX_INTR_LEVEL & Cy_SCB_GetRxInterruptStatusMasked(base)))
     {
@@ -866,10 +1097,15 @@ void Cy_SCB_SPI_Interrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
         Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_LEVEL);
     }
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    /* The queued transactions are completed by Cy_SCB_SPI_DmaInterrupt */
+    locDmaQueue = (NULL != context->xferHead);
+#endif /* CY_IP_M4CPUSS_DMA */
+
     /* The transfer is complete: all data is loaded in the TX FIFO
     * and all data is read from the RX FIFO
     */
-    if ((0UL != (context->status & CY_SCB_SPI_TRANSFER_ACTIVE)) &&
+    if ((!locDmaQueue) && (0UL != (context->status & CY_SCB_SPI_TRANSFER_ACTIVE)) &&
         (0UL == context->rxBufSize) && (0UL == context->txBufSize))
     {
         /* The transfer is complete */
@@ -883,6 +1119,120 @@ void Cy_SCB_SPI_Interrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
 }
 
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SCB_SPI_DmaInterrupt
+****************************************************************************//**
+*
+* The DMA completion handler for the transactions queued by
+* \ref Cy_SCB_SPI_TransferQueue. It must be called from the interrupt handlers
+* of both DW channels of \ref cy_stc_scb_spi_dma_t. When the RX channel has
+* received all data of the transaction, it starts the next queued transaction
+* and calls the transaction callback.
+*
+* When a DW channel reports an error, both channels are disabled, the FIFOs are
+* cleared, the queued transactions are dropped without calling their callbacks
+* and the \ref CY_SCB_SPI_TRANSFER_ERR_EVENT event is generated.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+void Cy_SCB_SPI_DmaInterrupt(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
+{
+    cy_stc_scb_spi_dma_t const *dma = context->dma;
+    bool locXferErr = false;
+    bool locRxDone  = false;
+
+    CY_ASSERT_L1(NULL != dma);
+
+    if (0UL != Cy_DMA_Channel_GetInterruptStatus(dma->dwBase, dma->txChannel))
+    {
+        if (CY_DMA_INTR_CAUSE_COMPLETION != Cy_DMA_Channel_GetStatus(dma->dwBase, dma->txChannel))
+        {
+            locXferErr = true;
+        }
+
+        Cy_DMA_Channel_ClearInterrupt(dma->dwBase, dma->txChannel);
+    }
+
+    if (0UL != Cy_DMA_Channel_GetInterruptStatus(dma->dwBase, dma->rxChannel))
+    {
+        if (CY_DMA_INTR_CAUSE_COMPLETION != Cy_DMA_Channel_GetStatus(dma->dwBase, dma->rxChannel))
+        {
+            locXferErr = true;
+        }
+        else
+        {
+            locRxDone = true;
+        }
+
+        Cy_DMA_Channel_ClearInterrupt(dma->dwBase, dma->rxChannel);
+    }
+
+    if (locXferErr)
+    {
+        /* Drop the queue */
+        DmaStopQueue(base, context);
+
+        /* Clear FIFOs */
+        Cy_SCB_SPI_ClearTxFifo(base);
+        Cy_SCB_SPI_ClearRxFifo(base);
+
+        context->status  &= (uint32_t) ~CY_SCB_SPI_TRANSFER_ACTIVE;
+
+        if (NULL != context->cbEvents)
+        {
+            context->cbEvents(CY_SCB_SPI_TRANSFER_ERR_EVENT);
+        }
+    }
+    else if (locRxDone && (NULL != context->xferHead))
+    {
+        cy_stc_scb_spi_transaction_t *transaction;
+        bool     queueDone;
+        uint32_t intrStatus = Cy_SysLib_EnterCriticalSection();
+
+        /* The transaction is complete: start the next one */
+        transaction = context->xferHead;
+        context->xferHead = transaction->next;
+        queueDone = (NULL == context->xferHead);
+
+        if (queueDone)
+        {
+            context->xferTail = NULL;
+            context->status  &= (uint32_t) ~CY_SCB_SPI_TRANSFER_ACTIVE;
+        }
+        else
+        {
+            DmaStartTransaction(base, context);
+        }
+
+        Cy_SysLib_ExitCriticalSection(intrStatus);
+
+        if (NULL != transaction->callback)
+        {
+            transaction->callback(transaction);
+        }
+
+        if (queueDone && (NULL != context->cbEvents))
+        {
+            context->cbEvents(CY_SCB_SPI_TRANSFER_CMPLT_EVENT);
+        }
+    }
+    else
+    {
+        /* The TX channel has loaded all data, wait for the RX channel */
+    }
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 * Function Name: HandleReceive
 ****************************************************************************//**
@@ -1036,6 +1386,114 @@ static void DiscardArrayNoCheck(CySCB_Type const *base, uint32_t size)
     }
 }
 
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: DmaStartTransaction
+****************************************************************************//**
+*
+* Selects the slave of the transaction at the head of the queue, sets up the
+* RX and TX descriptor chains and enables the DW channels.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void DmaStartTransaction(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
+{
+    cy_stc_scb_spi_transaction_t const *transaction = context->xferHead;
+    cy_stc_scb_spi_dma_t *dma = context->dma;
+    bool busIdle = true;
+
+    if (transaction->slaveSelect != (cy_en_scb_spi_slave_select_t) _FLD2VAL(SCB_SPI_CTRL_SSEL, SCB_SPI_CTRL(base)))
+    {
+        /* The slave select is de-asserted shortly after the last data element:
+        * it can be changed only when the bus is idle.
+        */
+        if (Cy_SCB_SPI_IsBusBusy(base))
+        {
+            /* Cy_SCB_SPI_Interrupt starts the transaction on the master done event */
+            Cy_SCB_ClearMasterInterrupt(base, CY_SCB_MASTER_INTR_SPI_DONE);
+            Cy_SCB_SetMasterInterruptMask(base, CY_SCB_MASTER_INTR_SPI_DONE);
+
+            busIdle = !Cy_SCB_SPI_IsBusBusy(base);
+
+            if (busIdle)
+            {
+                /* The bus became idle before the event was unmasked */
+                Cy_SCB_SetMasterInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+                Cy_SCB_ClearMasterInterrupt(base, CY_SCB_MASTER_INTR_SPI_DONE);
+            }
+        }
+
+        if (busIdle)
+        {
+            Cy_SCB_SPI_SetActiveSlaveSelect(base, transaction->slaveSelect);
+        }
+    }
+
+    if (busIdle)
+    {
+        Cy_SCB_DmaSetDescriptors(dma->rxDescriptor, (void const *) &SCB_RX_FIFO_RD(base),
+                          (NULL != transaction->rxBuffer) ? transaction->rxBuffer : (void *) &context->dmaRxDiscard,
+                          transaction->size, true, (NULL != transaction->rxBuffer), Cy_SCB_IsRxDataWidthByte(base), NULL);
+
+        Cy_SCB_DmaSetDescriptors(dma->txDescriptor, (void const *) &SCB_TX_FIFO_WR(base),
+                          (NULL != transaction->txBuffer) ? transaction->txBuffer : (void *) &context->dmaTxDefault,
+                          transaction->size, false, (NULL != transaction->txBuffer), Cy_SCB_IsTxDataWidthByte(base), NULL);
+
+        Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->rxChannel, &dma->rxDescriptor[0U]);
+        Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->txChannel, &dma->txDescriptor[0U]);
+
+        /* Enable the RX channel first: the master starts the transfer as soon as the TX FIFO is loaded */
+        Cy_DMA_Channel_Enable(dma->dwBase, dma->rxChannel);
+        Cy_DMA_Channel_Enable(dma->dwBase, dma->txChannel);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: DmaStopQueue
+****************************************************************************//**
+*
+* Disables the DW channels, clears their interrupts and drops the queued
+* transactions without calling their callbacks.
+*
+* \param base
+* The pointer to the SPI SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_spi_context_t allocated
+* by the user. The structure is used during the SPI operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void DmaStopQueue(CySCB_Type *base, cy_stc_scb_spi_context_t *context)
+{
+    cy_stc_scb_spi_dma_t const *dma = context->dma;
+
+    Cy_DMA_Channel_Disable(dma->dwBase, dma->txChannel);
+    Cy_DMA_Channel_Disable(dma->dwBase, dma->rxChannel);
+
+    Cy_DMA_Channel_ClearInterrupt(dma->dwBase, dma->txChannel);
+    Cy_DMA_Channel_ClearInterrupt(dma->dwBase, dma->rxChannel);
+
+    /* Cancel the pending transaction start */
+    Cy_SCB_SetMasterInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+    Cy_SCB_ClearMasterInterrupt(base, CY_SCB_MASTER_INTR_SPI_DONE);
+
+    context->xferHead = NULL;
+    context->xferTail = NULL;
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_scb_uart.c
-* \version 2.50
+* \version 2.60
 *
 * Provides UART API implementation of the SCB driver.
 *
@@ -34,7 +34,16 @@ extern "C" {
 static void HandleDataReceive (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 static void HandleRingBuffer  (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
 static void HandleDataTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *context);
+static void HandleTxQueue     (CySCB_Type *base, cy_stc_scb_uart_context_t *context);
+static void StartTransmit     (CySCB_Type *base);
 static uint32_t SelectRxFifoLevel(CySCB_Type const *base);
+#if defined(CY_IP_M4CPUSS_DMA)
+static void HandleRingBufferDma(CySCB_Type const *base, cy_stc_scb_uart_context_t *context);
+static uint32_t GetRingBufferDmaHead(cy_stc_scb_uart_context_t const *context);
+
+/* The largest ring buffer covered by the 2D descriptor and the 1D tail descriptor */
+#define CY_SCB_UART_DMA_RING_SIZE_MAX   (CY_DMA_LOOP_COUNT_MAX * CY_DMA_LOOP_COUNT_MAX)
+#endif /* CY_IP_M4CPUSS_DMA */
 
 
 /*******************************************************************************
@@ -168,8 +177,16 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Init(CySCB_Type *base, cy_stc_scb_uart_confi
         context->rxBufIdx  = 0UL;
         context->txLeftToTransmit = 0UL;
 
+        context->txQueueHead   = NULL;
+        context->txQueueTail   = NULL;
+        context->txQueueActive = false;
+
         context->cbEvents = NULL;
 
+    #if defined(CY_IP_M4CPUSS_DMA)
+        context->rxRingDma = NULL;
+    #endif /* CY_IP_M4CPUSS_DMA */
+
     #if !defined(NDEBUG)
         /* Put an initialization key into the initKey variable to verify
         * context initialization in the transfer API.
@@ -449,6 +466,8 @@ cy_en_syspm_status_t Cy_SCB_UART_HibernateCallback(cy_stc_syspm_callback_params_
 *   operates.
 * * This function overrides the RX interrupt sources and changes the
 *   RX FIFO level.
+* * If the ring buffer is filled by the DMA, the DMA channel is disabled and
+*   the interrupt fills the new ring buffer.
 *
 *******************************************************************************/
 void Cy_SCB_UART_StartRingBuffer(CySCB_Type *base, void *buffer, uint32_t size, cy_stc_scb_uart_context_t *context)
@@ -463,6 +482,15 @@ void Cy_SCB_UART_StartRingBuffer(CySCB_Type *base, void *buffer, uint32_t size,
     {
         uint32_t irqRxLevel =  SelectRxFifoLevel(base);
 
+    #if defined(CY_IP_M4CPUSS_DMA)
+        /* The interrupt fills the ring buffer instead of the DMA */
+        if (NULL != context->rxRingDma)
+        {
+            Cy_DMA_Channel_Disable(context->rxRingDma->dwBase, context->rxRingDma->rxChannel);
+            context->rxRingDma = NULL;
+        }
+    #endif /* CY_IP_M4CPUSS_DMA */
+
         context->rxRingBuf     = buffer;
         context->rxRingBufSize = size;
         context->rxRingBufHead = 0UL;
@@ -500,6 +528,7 @@ static uint32_t SelectRxFifoLevel(CySCB_Type const *base)
 ****************************************************************************//**
 *
 * Stops receiving data into the ring buffer and clears the ring buffer.
+* If the ring buffer is filled by the DMA, the DMA channel is disabled.
 *
 * \param base
 * The pointer to the UART SCB instance.
@@ -516,6 +545,14 @@ void Cy_SCB_UART_StopRingBuffer(CySCB_Type *base, cy_stc_scb_uart_context_t *con
     Cy_SCB_SetRxInterruptMask  (base, CY_SCB_CLEAR_ALL_INTR_SRC);
     Cy_SCB_UART_ClearRingBuffer(base, context);
 
+#if defined(CY_IP_M4CPUSS_DMA)
+    if (NULL != context->rxRingDma)
+    {
+        Cy_DMA_Channel_Disable(context->rxRingDma->dwBase, context->rxRingDma->rxChannel);
+        context->rxRingDma = NULL;
+    }
+#endif /* CY_IP_M4CPUSS_DMA */
+
     context->rxRingBuf     = NULL;
     context->rxRingBufSize = 0UL;
 }
@@ -540,8 +577,10 @@ void Cy_SCB_UART_StopRingBuffer(CySCB_Type *base, cy_stc_scb_uart_context_t *con
 * The number of data elements in the receive ring buffer.
 *
 * \note
-* One data element is used for internal use, so when the buffer is full,
-* this function returns (Ring Buffer size - 1).
+* * One data element is used for internal use, so when the buffer is full,
+*   this function returns (Ring Buffer size - 1).
+* * If the ring buffer is filled by the DMA, the returned number is updated
+*   by \ref Cy_SCB_UART_RingBufferDmaUpdate.
 *
 *******************************************************************************/
 uint32_t Cy_SCB_UART_GetNumInRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_context_t const *context)
@@ -558,7 +597,7 @@ uint32_t Cy_SCB_UART_GetNumInRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_
     }
     else
     {
-        size = (locHead + (context->rxBufSize - context->rxRingBufTail));
+        size = (locHead + (context->rxRingBufSize - context->rxRingBufTail));
     }
 
     return (size);
@@ -586,8 +625,235 @@ void Cy_SCB_UART_ClearRingBuffer(CySCB_Type const *base, cy_stc_scb_uart_context
     /* Suppress a compiler warning about unused variables */
     (void) base;
 
-    context->rxRingBufHead = context->rxRingBufTail;
+#if defined(CY_IP_M4CPUSS_DMA)
+    if (NULL != context->rxRingDma)
+    {
+        /* The DMA owns the head: drop the data up to the current write position */
+        context->rxRingBufHead = GetRingBufferDmaHead(context);
+        context->rxRingBufTail = context->rxRingBufHead;
+    }
+    else
+#endif /* CY_IP_M4CPUSS_DMA */
+    {
+        context->rxRingBufHead = context->rxRingBufTail;
+    }
+}
+
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_StartRingBufferDma
+****************************************************************************//**
+*
+* Starts the receive ring buffer operation with the DMA.
+* The DW channel runs a circular descriptor chain which moves each data
+* element from the RX FIFO straight into the ring buffer. The CPU is not
+* involved while the data arrives: the DMA write position is published to the
+* ring buffer head by \ref Cy_SCB_UART_RingBufferDmaUpdate and on every RX
+* interrupt handled by \ref Cy_SCB_UART_Interrupt.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param buffer
+* Pointer to the user defined ring buffer.
+* The element size is defined by the data type, which depends on the configured
+* data width.
+*
+* \param size
+* The size of the receive ring buffer. Must be greater than 1 and not greater
+* than 65536. Note that one data element is used for internal use, so if the
+* size is 32, then only 31 data elements are used for data storage.
+*
+* \param dma
+* The DMA configuration \ref cy_stc_scb_uart_dma_t allocated by the user in
+* SRAM. The dwBase, rxChannel and priority fields must be set.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_uart_status_t
+*
+* \note
+* * The buffer and the DMA configuration must not be modified and stay
+*   allocated while the ring buffer operates.
+* * This function overrides the RX interrupt sources (only the RX-error
+*   sources stay enabled) and sets the RX FIFO level to 0.
+* * The DMA does not stop when the ring buffer is full: the oldest data is
+*   overwritten and the \ref CY_SCB_UART_RB_FULL_EVENT is generated when the
+*   head is published.
+* * Call \ref Cy_SCB_UART_StopRingBuffer to disable the DMA channel.
+*
+*******************************************************************************/
+cy_en_scb_uart_status_t Cy_SCB_UART_StartRingBufferDma(CySCB_Type *base, void *buffer, uint32_t size,
+                                                       cy_stc_scb_uart_dma_t *dma,
+                                                       cy_stc_scb_uart_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    #if !defined(NDEBUG)
+    CY_ASSERT_L1(CY_SCB_UART_INIT_KEY == context->initKey);
+    #endif
+    CY_ASSERT_L1(CY_SCB_IS_BUFFER_VALID(buffer, size));
+    CY_ASSERT_L1(NULL != dma);
+
+    cy_en_scb_uart_status_t retStatus = CY_SCB_UART_BAD_PARAM;
+
+    if ((NULL != buffer) && (size > 1UL) && (size <= CY_SCB_UART_DMA_RING_SIZE_MAX) &&
+        (NULL != dma) && (NULL != dma->dwBase))
+    {
+        cy_stc_dma_channel_config_t    channelConfig;
+        cy_stc_dma_descriptor_config_t descrConfig;
+        cy_stc_dma_descriptor_t *descriptor = &dma->descriptor[0U];
+        uint8_t  *ringBuf  = (uint8_t *) buffer;
+        uint32_t  rows     = size / CY_DMA_LOOP_COUNT_MAX;
+        uint32_t  rest     = size % CY_DMA_LOOP_COUNT_MAX;
+        bool      byteMode = Cy_SCB_IsRxDataWidthByte(base);
+
+        /* Stop the interrupt-driven ring buffer update */
+        Cy_SCB_SetRxInterruptMask(base, CY_SCB_CLEAR_ALL_INTR_SRC);
+        Cy_DMA_Channel_Disable(dma->dwBase, dma->rxChannel);
+
+        descrConfig.retrigger       = CY_DMA_RETRIG_16CYC;
+        descrConfig.interruptType   = CY_DMA_DESCR;
+        descrConfig.triggerOutType  = CY_DMA_DESCR;
+        descrConfig.triggerInType   = CY_DMA_1ELEMENT;
+        descrConfig.channelState    = CY_DMA_CHANNEL_ENABLED;
+        descrConfig.dataSize        = (byteMode) ? CY_DMA_BYTE : CY_DMA_HALFWORD;
+        descrConfig.srcTransferSize = CY_DMA_TRANSFER_SIZE_WORD;
+        descrConfig.dstTransferSize = CY_DMA_TRANSFER_SIZE_DATA;
+        descrConfig.srcAddress      = NULL;
+        descrConfig.dstAddress      = NULL;
+        /* The FIFO address is fixed, the ring buffer address is incremented */
+        descrConfig.srcXincrement   = 0L;
+        descrConfig.dstXincrement   = 1L;
+        descrConfig.srcYincrement   = 0L;
+        descrConfig.dstYincrement   = (int32_t) CY_DMA_LOOP_COUNT_MAX;
+
+        if (0UL != rows)
+        {
+            descrConfig.descriptorType = CY_DMA_2D_TRANSFER;
+            descrConfig.xCount         = CY_DMA_LOOP_COUNT_MAX;
+            descrConfig.yCount         = rows;
+            descrConfig.nextDescriptor = (0UL != rest) ? &dma->descriptor[1U] : &dma->descriptor[0U];
+
+            (void) Cy_DMA_Descriptor_Init(descriptor, &descrConfig);
+            Cy_DMA_Descriptor_SetSrcAddress(descriptor, (void const *) &SCB_RX_FIFO_RD(base));
+            Cy_DMA_Descriptor_SetDstAddress(descriptor, (void const *) ringBuf);
+
+            descriptor = &dma->descriptor[1U];
+            ringBuf = &ringBuf[((byteMode) ? 1UL : 2UL) * rows * CY_DMA_LOOP_COUNT_MAX];
+        }
+
+        if (0UL != rest)
+        {
+            descrConfig.descriptorType = CY_DMA_1D_TRANSFER;
+            descrConfig.xCount         = rest;
+            descrConfig.yCount         = 1UL;
+            descrConfig.nextDescriptor = &dma->descriptor[0U];
+
+            (void) Cy_DMA_Descriptor_Init(descriptor, &descrConfig);
+            Cy_DMA_Descriptor_SetSrcAddress(descriptor, (void const *) &SCB_RX_FIFO_RD(base));
+            Cy_DMA_Descriptor_SetDstAddress(descriptor, (void const *) ringBuf);
+        }
+
+        channelConfig.descriptor  = &dma->descriptor[0U];
+        channelConfig.preemptable = false;
+        channelConfig.priority    = dma->priority;
+        channelConfig.enable      = false;
+        channelConfig.bufferable  = false;
+
+        if (CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->rxChannel, &channelConfig))
+        {
+            /* The DMA writes the first data element at index 0, so the empty
+            * ring buffer starts at the last index.
+            */
+            context->rxRingBuf     = buffer;
+            context->rxRingBufSize = size;
+            context->rxRingBufHead = size - 1UL;
+            context->rxRingBufTail = size - 1UL;
+
+            context->rxRingDma         = dma;
+            context->rxRingDmaIdleHead = size - 1UL;
+            context->rxRingDmaActive   = false;
+
+            /* Request the DMA for every data element in the RX FIFO */
+            Cy_SCB_SetRxFifoLevel(base, 0UL);
+            Cy_SCB_SetRxInterruptMask(base, CY_SCB_UART_RECEIVE_ERR);
+
+            Cy_DMA_Channel_Enable(dma->dwBase, dma->rxChannel);
+            Cy_DMA_Enable(dma->dwBase);
+
+            retStatus = CY_SCB_UART_SUCCESS;
+        }
+    }
+
+    return (retStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_RingBufferDmaUpdate
+****************************************************************************//**
+*
+* Publishes the DMA write position to the ring buffer head, completes the
+* receive operation started by \ref Cy_SCB_UART_Receive if enough data is
+* available, and detects the idle line.
+*
+* Call this function periodically to detect the end of a data burst, for
+* example, from a TCPWM counter interrupt with a period of a few character
+* times. The \ref CY_SCB_UART_RB_IDLE_EVENT is generated when no data was
+* written by the DMA since the previous call, and data was written before it.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \note
+* This function does nothing if the ring buffer was not started by
+* \ref Cy_SCB_UART_StartRingBufferDma. It must not preempt and must not be
+* preempted by \ref Cy_SCB_UART_Interrupt or \ref Cy_SCB_UART_Receive.
+*
+*******************************************************************************/
+void Cy_SCB_UART_RingBufferDmaUpdate(CySCB_Type const *base, cy_stc_scb_uart_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+
+    if (NULL != context->rxRingDma)
+    {
+        HandleRingBufferDma(base, context);
+
+        if (context->rxRingDmaIdleHead != context->rxRingBufHead)
+        {
+            /* The data is flowing: wait for the next check */
+            context->rxRingDmaIdleHead = context->rxRingBufHead;
+            context->rxRingDmaActive   = true;
+        }
+        else if (context->rxRingDmaActive)
+        {
+            /* No data since the last check: the line is idle */
+            context->rxRingDmaActive = false;
+
+            if (NULL != context->cbEvents)
+            {
+                context->cbEvents(CY_SCB_UART_RB_IDLE_EVENT);
+            }
+        }
+        else
+        {
+            /* The line is still idle */
+        }
+    }
 }
+#endif /* CY_IP_M4CPUSS_DMA */
 
 
 /*******************************************************************************
@@ -655,6 +921,14 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Receive(CySCB_Type *base, void *buffer, uint
 
         if (NULL != context->rxRingBuf)
         {
+        #if defined(CY_IP_M4CPUSS_DMA)
+            if (NULL != context->rxRingDma)
+            {
+                /* Publish the DMA write position before reading the ring buffer */
+                HandleRingBufferDma(base, context);
+            }
+        #endif /* CY_IP_M4CPUSS_DMA */
+
             /* Get the items available in the ring buffer */
             numToCopy = Cy_SCB_UART_GetNumInRingBuffer(base, context);
 
@@ -717,7 +991,13 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Receive(CySCB_Type *base, void *buffer, uint
                     }
 
                     /* Continue receiving data in the ring buffer */
-                    Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL);
+                #if defined(CY_IP_M4CPUSS_DMA)
+                    /* The DMA moves the data, keep only the RX-error interrupt sources */
+                    if (NULL == context->rxRingDma)
+                #endif /* CY_IP_M4CPUSS_DMA */
+                    {
+                        Cy_SCB_SetRxInterruptMask(base, CY_SCB_RX_INTR_LEVEL);
+                    }
                 }
                 else
                 {
@@ -726,6 +1006,27 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Receive(CySCB_Type *base, void *buffer, uint
             }
         }
 
+    #if defined(CY_IP_M4CPUSS_DMA)
+        if (NULL != context->rxRingDma)
+        {
+            /* The DMA owns the RX FIFO: the rest of data is copied from the ring
+            * buffer by Cy_SCB_UART_RingBufferDmaUpdate when it arrives.
+            */
+            Cy_SCB_SetRxInterruptMask(base, CY_SCB_UART_RECEIVE_ERR);
+
+            if (size > 0UL)
+            {
+                context->rxStatus  = CY_SCB_UART_RECEIVE_ACTIVE;
+
+                context->rxBuf     = (void *) tmpBuf;
+                context->rxBufSize = size;
+                context->rxBufIdx  = numToCopy;
+
+                size = 0UL;
+            }
+        }
+    #endif /* CY_IP_M4CPUSS_DMA */
+
         /* Set up a direct RX FIFO receive */
         if (size > 0UL)
         {
@@ -913,23 +1214,150 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Transmit(CySCB_Type *base, void *buffer, uin
         context->txBuf     = buffer;
         context->txBufSize = size;
 
-        /* Set the level in TX FIFO to start a transfer */
-        Cy_SCB_SetTxFifoLevel(base, (Cy_SCB_GetFifoSize(base) / 2UL));
+        StartTransmit(base);
+
+        retStatus = CY_SCB_UART_SUCCESS;
+    }
+
+    return (retStatus);
+}
+
+
+/*******************************************************************************
+* Function Name: StartTransmit
+****************************************************************************//**
+*
+* Sets the TX FIFO level and enables the TX interrupt sources to start loading
+* the TX FIFO from \ref Cy_SCB_UART_Interrupt.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+*******************************************************************************/
+static void StartTransmit(CySCB_Type *base)
+{
+    /* Set the level in TX FIFO to start a transfer */
+    Cy_SCB_SetTxFifoLevel(base, (Cy_SCB_GetFifoSize(base) / 2UL));
+
+    /* Enable the interrupt sources */
+    if (((uint32_t) CY_SCB_UART_SMARTCARD) == _FLD2VAL(SCB_UART_CTRL_MODE, SCB_UART_CTRL(base)))
+    {
+        /* Transfer data into TX FIFO and track SmartCard-specific errors */
+        Cy_SCB_SetTxInterruptMask(base, CY_SCB_UART_TX_INTR);
+    }
+    else
+    {
+        /* Transfer data into TX FIFO */
+        Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_TransmitQueue
+****************************************************************************//**
+*
+* Adds a buffer to the transmit queue. If no transmit operation is in
+* progress, it configures the transmit interrupt sources and returns. The
+* \ref Cy_SCB_UART_Interrupt loads the queued buffers into the TX FIFO one
+* after another, so the buffers are sent on the bus without gaps.
+*
+* The buffer callback is called when the last data element of the buffer is
+* loaded into the TX FIFO. When all queued buffers are sent on the bus, the
+* \ref CY_SCB_UART_TRANSMIT_ACTIVE status is cleared and the
+* \ref CY_SCB_UART_TRANSMIT_DONE_EVENT event is generated.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param txBuf
+* The pointer to the buffer description \ref cy_stc_scb_uart_tx_buf_t
+* allocated by the user. The buffer, size, callback and userData fields must
+* be set.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* \ref cy_en_scb_uart_status_t
+*
+* \note
+* * The buffer structure and data must not be modified and must stay
+*   allocated until the buffer callback is called.
+* * The function returns \ref CY_SCB_UART_TRANSMIT_BUSY if the transmit
+*   operation started by \ref Cy_SCB_UART_Transmit is in progress.
+* * \ref Cy_SCB_UART_AbortTransmit drops all queued buffers, their callbacks
+*   are not called.
+* * This function overrides the TX FIFO interrupt sources and changes the
+*   TX FIFO level.
+*
+*******************************************************************************/
+cy_en_scb_uart_status_t Cy_SCB_UART_TransmitQueue(CySCB_Type *base, cy_stc_scb_uart_tx_buf_t *txBuf,
+                                                  cy_stc_scb_uart_context_t *context)
+{
+    CY_ASSERT_L1(NULL != context);
+    #if !defined(NDEBUG)
+    CY_ASSERT_L1(CY_SCB_UART_INIT_KEY == context->initKey);
+    #endif
+    CY_ASSERT_L1(NULL != txBuf);
+    CY_ASSERT_L1(CY_SCB_IS_BUFFER_VALID(txBuf->buffer, txBuf->size));
+
+    cy_en_scb_uart_status_t retStatus = CY_SCB_UART_TRANSMIT_BUSY;
+    uint32_t intrStatus;
+
+    txBuf->next = NULL;
+
+    intrStatus = Cy_SysLib_EnterCriticalSection();
 
-        /* Enable the interrupt sources */
-        if (((uint32_t) CY_SCB_UART_SMARTCARD) == _FLD2VAL(SCB_UART_CTRL_MODE, SCB_UART_CTRL(base)))
+    if (context->txQueueActive)
+    {
+        if (NULL != context->txQueueHead)
         {
-            /* Transfer data into TX FIFO and track SmartCard-specific errors */
-            Cy_SCB_SetTxInterruptMask(base, CY_SCB_UART_TX_INTR);
+            /* Append the buffer to be loaded after the queued ones */
+            context->txQueueTail->next = txBuf;
+            context->txQueueTail = txBuf;
         }
         else
         {
-            /* Transfer data into TX FIFO */
-            Cy_SCB_SetTxInterruptMask(base, CY_SCB_TX_INTR_LEVEL);
+            /* All queued data is in the TX FIFO: continue loading it */
+            context->txQueueHead = txBuf;
+            context->txQueueTail = txBuf;
+
+            context->txBuf     = txBuf->buffer;
+            context->txBufSize = txBuf->size;
+
+            context->txStatus &= (uint32_t) ~CY_SCB_UART_TRANSMIT_IN_FIFO;
+
+            StartTransmit(base);
         }
 
         retStatus = CY_SCB_UART_SUCCESS;
     }
+    else if (0UL == (CY_SCB_UART_TRANSMIT_ACTIVE & context->txStatus))
+    {
+        /* Set up context */
+        context->txStatus      = CY_SCB_UART_TRANSMIT_ACTIVE;
+        context->txQueueActive = true;
+
+        context->txQueueHead = txBuf;
+        context->txQueueTail = txBuf;
+
+        context->txBuf     = txBuf->buffer;
+        context->txBufSize = txBuf->size;
+
+        StartTransmit(base);
+
+        retStatus = CY_SCB_UART_SUCCESS;
+    }
+    else
+    {
+        /* The transmit operation started by Cy_SCB_UART_Transmit is in progress */
+    }
+
+    Cy_SysLib_ExitCriticalSection(intrStatus);
 
     return (retStatus);
 }
@@ -941,7 +1369,7 @@ cy_en_scb_uart_status_t Cy_SCB_UART_Transmit(CySCB_Type *base, void *buffer, uin
 *
 * Aborts the current transmit operation.
 * It disables the transmit interrupt sources and clears the transmit FIFO
-* and status.
+* and status. The buffers queued by \ref Cy_SCB_UART_TransmitQueue are dropped.
 *
 * \param base
 * The pointer to the UART SCB instance.
@@ -968,6 +1396,10 @@ void Cy_SCB_UART_AbortTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *cont
     context->txBufSize = 0UL;
     context->txLeftToTransmit = 0UL;
 
+    context->txQueueHead   = NULL;
+    context->txQueueTail   = NULL;
+    context->txQueueActive = false;
+
     context->txStatus  = 0UL;
 }
 
@@ -1140,6 +1572,14 @@ void Cy_SCB_UART_Interrupt(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
             Cy_SCB_ClearRxInterrupt(base, CY_SCB_RX_INTR_UART_BREAK_DETECT);
         }
 
+    #if defined(CY_IP_M4CPUSS_DMA)
+        if (NULL != context->rxRingDma)
+        {
+            /* Publish the DMA write position to the ring buffer head */
+            HandleRingBufferDma(base, context);
+        }
+    #endif /* CY_IP_M4CPUSS_DMA */
+
         /* Copy the received data */
         if (0UL != (CY_SCB_RX_INTR_LEVEL & Cy_SCB_GetRxInterruptStatusMasked(base)))
         {
@@ -1189,7 +1629,14 @@ void Cy_SCB_UART_Interrupt(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
         /* Load data to transmit */
         if (0UL != (CY_SCB_TX_INTR_LEVEL & Cy_SCB_GetTxInterruptStatusMasked(base)))
         {
-            HandleDataTransmit(base, context);
+            if (context->txQueueActive)
+            {
+                HandleTxQueue(base, context);
+            }
+            else
+            {
+                HandleDataTransmit(base, context);
+            }
 
             Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_LEVEL);
         }
@@ -1202,6 +1649,7 @@ void Cy_SCB_UART_Interrupt(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
 
             context->txStatus &= (uint32_t) ~CY_SCB_UART_TRANSMIT_ACTIVE;
             context->txLeftToTransmit = 0UL;
+            context->txQueueActive = false;
 
             if (NULL != context->cbEvents)
             {
@@ -1377,6 +1825,157 @@ static void HandleRingBuffer(CySCB_Type *base, cy_stc_scb_uart_context_t *contex
 }
 
 
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: GetRingBufferDmaHead
+****************************************************************************//**
+*
+* Returns the ring buffer index of the last data element written by the DMA.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return
+* The ring buffer head index.
+*
+*******************************************************************************/
+static uint32_t GetRingBufferDmaHead(cy_stc_scb_uart_context_t const *context)
+{
+    cy_stc_scb_uart_dma_t const *dma = context->rxRingDma;
+    cy_stc_dma_descriptor_t const *descriptor;
+    uint32_t chIdx;
+    uint32_t writeIdx;
+
+    /* Read the indices again if the DMA moved to another descriptor meanwhile */
+    do
+    {
+        descriptor = Cy_DMA_Channel_GetCurrentDescriptor(dma->dwBase, dma->rxChannel);
+        chIdx      = DW_CH_IDX(dma->dwBase, dma->rxChannel);
+    }
+    while (descriptor != Cy_DMA_Channel_GetCurrentDescriptor(dma->dwBase, dma->rxChannel));
+
+    writeIdx = _FLD2VAL(DW_CH_STRUCT_CH_IDX_X_IDX, chIdx);
+
+    if (descriptor == &dma->descriptor[1U])
+    {
+        /* The 1D tail descriptor follows the full rows of the 2D descriptor */
+        writeIdx += (context->rxRingBufSize / CY_DMA_LOOP_COUNT_MAX) * CY_DMA_LOOP_COUNT_MAX;
+    }
+    else
+    {
+        writeIdx += _FLD2VAL(DW_CH_STRUCT_CH_IDX_Y_IDX, chIdx) * CY_DMA_LOOP_COUNT_MAX;
+    }
+
+    /* The DMA writes the next element at writeIdx, the head is one element before */
+    return ((writeIdx > 0UL) ? (writeIdx - 1UL) : (context->rxRingBufSize - 1UL));
+}
+
+
+/*******************************************************************************
+* Function Name: HandleRingBufferDma
+****************************************************************************//**
+*
+* Publishes the DMA write position to the ring buffer head and copies data
+* from the ring buffer into the buffer provided by \ref Cy_SCB_UART_Receive.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void HandleRingBufferDma(CySCB_Type const *base, cy_stc_scb_uart_context_t *context)
+{
+    uint32_t locHead = GetRingBufferDmaHead(context);
+    uint32_t numFree = (context->rxRingBufSize - 1UL) - Cy_SCB_UART_GetNumInRingBuffer(base, context);
+    uint32_t numNew;
+
+    numNew = (locHead >= context->rxRingBufHead) ? (locHead - context->rxRingBufHead) :
+                                                   (locHead + (context->rxRingBufSize - context->rxRingBufHead));
+
+    /* Update the head index */
+    context->rxRingBufHead = locHead;
+
+    if (numNew > numFree)
+    {
+        /* The DMA has overwritten the oldest data, keep the newest (size - 1) elements */
+        context->rxRingBufTail = ((locHead + 1UL) == context->rxRingBufSize) ? 0UL : (locHead + 1UL);
+
+        if (NULL != context->cbEvents)
+        {
+            context->cbEvents(CY_SCB_UART_RB_FULL_EVENT);
+        }
+    }
+
+    /* Continue the receive operation started by Cy_SCB_UART_Receive */
+    if ((0UL != (context->rxStatus & CY_SCB_UART_RECEIVE_ACTIVE)) && (context->rxBufSize > 0UL))
+    {
+        uint32_t numToCopy = Cy_SCB_UART_GetNumInRingBuffer(base, context);
+
+        if (numToCopy > context->rxBufSize)
+        {
+            numToCopy = context->rxBufSize;
+        }
+
+        if (numToCopy > 0UL)
+        {
+            uint32_t idx;
+            uint32_t locTail = context->rxRingBufTail;
+            bool     byteMode = Cy_SCB_IsRxDataWidthByte(base);
+            uint8_t *buf = (uint8_t *) context->rxBuf;
+
+            /* Copy the data elements from the ring buffer */
+            for (idx = 0UL; idx < numToCopy; ++idx)
+            {
+                ++locTail;
+
+                if (locTail == context->rxRingBufSize)
+                {
+                    locTail = 0UL;
+                }
+
+                if (byteMode)
+                {
+                    buf[idx] = ((uint8_t *) context->rxRingBuf)[locTail];
+                }
+                else
+                {
+                    ((uint16_t *) context->rxBuf)[idx] = ((uint16_t *) context->rxRingBuf)[locTail];
+                }
+            }
+
+            /* Update the ring buffer tail after data has been copied */
+            context->rxRingBufTail = locTail;
+
+            /* Move the buffer */
+            context->rxBuf      = (void *) &buf[(byteMode) ? (numToCopy) : (2UL * numToCopy)];
+            context->rxBufIdx  += numToCopy;
+            context->rxBufSize -= numToCopy;
+
+            if (0UL == context->rxBufSize)
+            {
+                /* Update the status */
+                context->rxStatus &= (uint32_t) ~CY_SCB_UART_RECEIVE_ACTIVE;
+
+                /* Notify that receive is done in a callback */
+                if (NULL != context->cbEvents)
+                {
+                    context->cbEvents(CY_SCB_UART_RECEIVE_DONE_EVENT);
+                }
+            }
+        }
+    }
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 * Function Name: HandleDataTransmit
 ****************************************************************************//**
@@ -1451,6 +2050,104 @@ static void HandleDataTransmit(CySCB_Type *base, cy_stc_scb_uart_context_t *cont
 }
 
 
+/*******************************************************************************
+* Function Name: HandleTxQueue
+****************************************************************************//**
+*
+* Loads the transmit FIFO with data from the buffers queued by
+* \ref Cy_SCB_UART_TransmitQueue and calls the buffer callbacks.
+*
+* \param base
+* The pointer to the UART SCB instance.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_scb_uart_context_t allocated
+* by the user. The structure is used during the UART operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+*******************************************************************************/
+static void HandleTxQueue(CySCB_Type *base, cy_stc_scb_uart_context_t *context)
+{
+    cy_stc_scb_uart_tx_buf_t *txBuf;
+    uint32_t numCopied;
+    uint32_t intrStatus;
+    uint32_t fifoSize = Cy_SCB_GetFifoSize(base);
+    bool     byteMode = Cy_SCB_IsTxDataWidthByte(base);
+
+    while ((NULL != context->txQueueHead) && (fifoSize != Cy_SCB_GetNumInTxFifo(base)))
+    {
+        uint8_t *buf = (uint8_t *) context->txBuf;
+
+        /* Get the number of items left for transmission */
+        context->txLeftToTransmit = context->txBufSize;
+
+        /* Put data into TX FIFO */
+        numCopied = Cy_SCB_UART_PutArray(base, context->txBuf, context->txBufSize);
+
+        /* Move the buffer */
+        context->txBufSize -= numCopied;
+
+        buf = &buf[(byteMode) ? (numCopied) : (2UL * numCopied)];
+        context->txBuf = (void *) buf;
+
+        if (0UL == context->txBufSize)
+        {
+            /* The buffer is in the TX FIFO: move to the next queued buffer */
+            intrStatus = Cy_SysLib_EnterCriticalSection();
+
+            txBuf = context->txQueueHead;
+            context->txQueueHead = txBuf->next;
+
+            if (NULL != context->txQueueHead)
+            {
+                context->txBuf     = context->txQueueHead->buffer;
+                context->txBufSize = context->txQueueHead->size;
+            }
+            else
+            {
+                context->txQueueTail = NULL;
+            }
+
+            Cy_SysLib_ExitCriticalSection(intrStatus);
+
+            /* The buffer can be reused */
+            if (NULL != txBuf->callback)
+            {
+                txBuf->callback(txBuf);
+            }
+        }
+    }
+
+    intrStatus = Cy_SysLib_EnterCriticalSection();
+
+    if (NULL == context->txQueueHead)
+    {
+        /* Make sure that "TX done" happens for the data in the TX FIFO */
+        if (!Cy_SCB_IsTxComplete(base))
+        {
+            Cy_SCB_ClearTxInterrupt(base, CY_SCB_TX_INTR_UART_DONE);
+        }
+
+        /* Disable the level interrupt source and enable "transfer done" */
+        Cy_SCB_SetTxInterruptMask(base, (CY_SCB_TX_INTR_UART_DONE |
+                    (Cy_SCB_GetTxInterruptMask(base) & (uint32_t) ~CY_SCB_TX_INTR_LEVEL)));
+
+        context->txLeftToTransmit = 0UL;
+
+        /* Data is copied into TX FIFO */
+        context->txStatus |= CY_SCB_UART_TRANSMIT_IN_FIFO;
+    }
+
+    Cy_SysLib_ExitCriticalSection(intrStatus);
+
+    if ((NULL == context->txQueueHead) && (NULL != context->cbEvents))
+    {
+        context->cbEvents(CY_SCB_UART_TRANSMIT_IN_FIFO_EVENT);
+    }
+}
+
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1,6 +1,6 @@
 /*******************************************************************************
 * \file cy_sd_host.c
-* \version 1.50.1
+* \version 1.60
 *
 * \brief
 *  This file provides the driver code to the API for the SD Host Controller
@@ -43,6 +43,9 @@ extern "C" {
 
 #define CY_SD_HOST_EMMC_CMD6_TIMEOUT_MULT   (10UL)   /* The 10x multiplier of GENERIC_CMD6_TIME[248]. */
 #define CY_SD_HOST_RETRY_TIME               (1000UL) /* The number loops to make the timeout in msec. */
+#define CY_SD_HOST_TUNING_RETRY             (40UL)   /* The maximum number of the tuning commands. */
+#define CY_SD_HOST_TUNING_BLOCK_SIZE        (64UL)   /* The tuning block size in 4-bit mode. */
+#define CY_SD_HOST_TUNING_BLOCK_SIZE_8BIT   (128UL)  /* The tuning block size in 8-bit mode. */
 #define CY_SD_HOST_VOLTAGE_CHECK_RETRY      (2UL)    /* The number loops for voltage check. */
 #define CY_SD_HOST_SDIO_CMD5_TIMEOUT_MS     (1000U)  /* The SDIO CMD5 timeout. */
 #define CY_SD_HOST_ACMD41_TIMEOUT_MS        (1000U)  /* The ACMD41 timeout. */
@@ -76,6 +79,7 @@ extern "C" {
 #define CY_SD_HOST_SD_CMD16                 (16UL)
 #define CY_SD_HOST_SD_CMD17                 (17UL)
 #define CY_SD_HOST_SD_CMD18                 (18UL)
+#define CY_SD_HOST_SD_CMD19                 (19UL)
 
 #define CY_SD_HOST_SD_CMD23                 (23UL)
 #define CY_SD_HOST_SD_CMD24                 (24UL)
@@ -99,10 +103,12 @@ extern "C" {
 
 #define CY_SD_HOST_MMC_CMD_TAG              (0x80UL)
 #define CY_SD_HOST_MMC_CMD8                 (0x8UL | CY_SD_HOST_MMC_CMD_TAG)
+#define CY_SD_HOST_MMC_CMD21                (21UL)
 
 #define CY_SD_HOST_SD_ACMD_OFFSET           (0x40UL)
 #define CY_SD_HOST_SD_ACMD6                 (CY_SD_HOST_SD_ACMD_OFFSET + 6UL)
 #define CY_SD_HOST_SD_ACMD13                (CY_SD_HOST_SD_ACMD_OFFSET + 13UL)
+#define CY_SD_HOST_SD_ACMD23                (CY_SD_HOST_SD_ACMD_OFFSET + 23UL)
 #define CY_SD_HOST_SD_ACMD41                (CY_SD_HOST_SD_ACMD_OFFSET + 41UL)
 #define CY_SD_HOST_SD_ACMD51                (CY_SD_HOST_SD_ACMD_OFFSET + 51UL)
 
@@ -153,10 +159,14 @@ extern "C" {
 #define CY_SD_HOST_SDR12_SPEED              (0UL)  /* The SDR12/Legacy speed. */
 #define CY_SD_HOST_SDR25_SPEED              (1UL)  /* The SDR25/High Speed SDR speed. */
 #define CY_SD_HOST_SDR50_SPEED              (2UL)  /* The SDR50 speed. */
+#define CY_SD_HOST_SDR104_SPEED             (3UL)  /* The SDR104/HS200 speed. */
+#define CY_SD_HOST_EMMC_HS200_TIMING        (2UL)  /* The HS_TIMING value of HS200. */
 #define CY_SD_HOST_EMMC_BUS_WIDTH_ADDR      (0xB7UL)
 #define CY_SD_HOST_EMMC_HS_TIMING_ADDR      (0xB9UL)
 #define CY_SD_HOST_CMD23_BLOCKS_NUM_MASK    (0xFFFFUL)
 #define CY_SD_HOST_CMD23_RELIABLE_WRITE_POS (31U)
+#define CY_SD_HOST_CMD23_PACKED_POS         (30U)
+#define CY_SD_HOST_ACMD23_BLOCKS_NUM_MASK   (0x7FFFFFUL)
 #define CY_SD_HOST_RCA_SHIFT                (16U)
 #define CY_SD_HOST_RESPONSE_SIZE            (4U)
 #define CY_SD_HOST_CID_SIZE                 (4U)
@@ -179,6 +189,15 @@ extern "C" {
 #define CY_SD_HOST_EXTCSD_GENERIC_CMD6_TIME (62U)
 #define CY_SD_HOST_EXTCSD_GENERIC_CMD6_TIME_MSK (0xFFUL)
 #define CY_SD_HOST_EXTCSD_SIZE              (128U)
+#define CY_SD_HOST_EXTCSD_MAX_PACKED_WRITES (125U) /* EXT_CSD[501] */
+#define CY_SD_HOST_EXTCSD_MAX_PACKED_WRITES_POS (8U)
+#define CY_SD_HOST_EXTCSD_MAX_PACKED_WRITES_MSK (0xFFUL)
+
+/* The packed command header. */
+#define CY_SD_HOST_PACKED_VERSION           (0x01UL)
+#define CY_SD_HOST_PACKED_WRITE             (0x02UL)
+#define CY_SD_HOST_PACKED_RW_POS            (8U)
+#define CY_SD_HOST_PACKED_NUM_ENTRIES_POS   (16U)
 
 /* CSD register masks/positions. */
 #define CY_SD_HOST_CSD_V1_C_SIZE_MSB_MASK   (0x00000003UL)
@@ -221,6 +240,7 @@ extern "C" {
 #define CY_SD_HOST_CCCR_SPEED_EHS_MASK      (0x2UL)
 #define CY_SD_HOST_CCCR_SPEED_BSS0_MASK     (0x2UL)
 #define CY_SD_HOST_CCCR_SPEED_BSS1_MASK     (0x4UL)
+#define CY_SD_HOST_CCCR_SPEED_BSS2_MASK     (0x8UL)
 #define CY_SD_HOST_CCCR_BUS_INTERFACE_CTR   (0x00007UL)
 #define CY_SD_HOST_CCCR_BUS_WIDTH_0         (0x1UL)
 #define CY_SD_HOST_CCCR_BUS_WIDTH_1         (0x2UL)
@@ -264,6 +284,8 @@ extern "C" {
 #define CY_SD_HOST_CLK_10M                  (10UL * 1000UL * 1000UL) /* 10 MHz. */
 #define CY_SD_HOST_CLK_20M                  (20UL * 1000UL * 1000UL) /* 20 MHz. */
 
+#define CY_SD_HOST_INSTANCES                (2UL)    /* The maximum number of the SD host instances. */
+
 /** \endcond */
 
 /** \cond PARAM_CHECK_MACROS */
@@ -314,7 +336,9 @@ extern "C" {
                                                          (CY_SD_HOST_BUS_SPEED_SDR25 == (speedMode)) || \
                                                          (CY_SD_HOST_BUS_SPEED_SDR50 == (speedMode)) || \
                                                          (CY_SD_HOST_BUS_SPEED_EMMC_LEGACY == (speedMode)) || \
-                                                         (CY_SD_HOST_BUS_SPEED_EMMC_HIGHSPEED_SDR == (speedMode)))
+                                                         (CY_SD_HOST_BUS_SPEED_EMMC_HIGHSPEED_SDR == (speedMode)) || \
+                                                         (CY_SD_HOST_BUS_SPEED_SDR104 == (speedMode)) || \
+                                                         (CY_SD_HOST_BUS_SPEED_EMMC_HS200 == (speedMode)))
 
 #define CY_SD_HOST_IS_DMA_WR_RD_VALID(dmaType)          ((CY_SD_HOST_DMA_SDMA == (dmaType)) || \
                                                          (CY_SD_HOST_DMA_ADMA2 == (dmaType)))
@@ -376,7 +400,8 @@ __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_PollBufferReadReady(SDHC_Type
 __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_PollBufferWriteReady(SDHC_Type *base);
 __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_PollCmdComplete(SDHC_Type *base);
 __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_PollTransferComplete(SDHC_Type *base);
-static void Cy_SD_Host_ErrorReset(SDHC_Type *base);
+static bool Cy_SD_Host_ErrorReset(SDHC_Type *base);
+static bool Cy_SD_Host_IsRetuneError(SDHC_Type const *base, uint32_t intError);
 static void Cy_SD_Host_NormalReset(SDHC_Type *base);
 __STATIC_INLINE bool Cy_SD_Host_VoltageCheck(SDHC_Type *base);
 __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_IoOcr(SDHC_Type *base,
@@ -395,6 +420,18 @@ __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_SdOcr(SDHC_Type *base,
 __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_PollCmdLineFree(SDHC_Type const *base);
 __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_PollDataLineNotInhibit(SDHC_Type const *base);
 __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_PollDataLineFree(SDHC_Type const *base);
+static cy_en_sd_host_status_t Cy_SD_Host_QueueSendRequest(cy_stc_sd_host_queue_t const *queue,
+                                                          cy_stc_sd_host_request_t *request);
+static void Cy_SD_Host_QueueStart(cy_stc_sd_host_queue_t *queue);
+static cy_en_sd_host_status_t Cy_SD_Host_OpsSetWrBlkEraseCount(SDHC_Type *base,
+                                                               uint32_t blockNum,
+                                                               cy_stc_sd_host_context_t const *context);
+static uint32_t Cy_SD_Host_GetInstance(SDHC_Type const *base);
+
+/* The retuning requests of the SD host instances, see Cy_SD_Host_Retune(). They
+*  are kept out of the context, which Cy_SD_Host_AbortTransfer() cannot modify.
+*/
+static volatile bool cy_sd_host_retuneNeeded[CY_SD_HOST_INSTANCES];
 
 /* High-level section */
 
@@ -461,7 +498,7 @@ __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_eMMC_InitCard(SDHC_Type *base,
         }
         else
         {
-            Cy_SD_Host_ErrorReset(base);
+            (void)Cy_SD_Host_ErrorReset(base);
 
             Cy_SysLib_DelayUs(CY_SD_HOST_CMD1_TIMEOUT_MS); /* The CMD1 timeout. */
         }
@@ -492,7 +529,7 @@ __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_eMMC_InitCard(SDHC_Type *base,
             /* Get OCR (CMD1). */
             ret = Cy_SD_Host_MmcOpsSendOpCond(base, &ocrReg, CY_SD_HOST_EMMC_VOLTAGE_WINDOW);
 
-            Cy_SD_Host_ErrorReset(base);
+            (void)Cy_SD_Host_ErrorReset(base);
 
             if (CY_SD_HOST_SUCCESS == ret)
             {
@@ -1212,59 +1249,1069 @@ cy_en_sd_host_status_t Cy_SD_Host_Erase(SDHC_Type *base,
             }
             cmd.commandArgument = endAddr;
 
-            ret = Cy_SD_Host_SendCommand(base, &cmd);
+            ret = Cy_SD_Host_SendCommand(base, &cmd);
+
+            if (CY_SD_HOST_SUCCESS == ret)
+            {
+                /* Wait for the Command Complete event. */
+                ret = Cy_SD_Host_PollCmdComplete(base);
+            }
+
+            /* Erase (CMD38) */
+            cmd.commandIndex = CY_SD_HOST_SD_CMD38;
+
+            switch (eraseType)
+            {
+                case CY_SD_HOST_ERASE_ERASE:
+                    cmd.commandArgument = CY_SD_HOST_ERASE;
+                    break;
+                case CY_SD_HOST_ERASE_DISCARD:
+                    if (CY_SD_HOST_EMMC == context->cardType)
+                    {
+                        cmd.commandArgument = CY_SD_HOST_EMMC_DISCARD;
+                    }
+                    else
+                    {
+                        cmd.commandArgument = CY_SD_HOST_SD_DISCARD;
+                    }
+                    break;
+                case CY_SD_HOST_ERASE_FULE:
+                    cmd.commandArgument = CY_SD_HOST_SD_FULE;
+                    break;
+                case CY_SD_HOST_ERASE_SECURE:
+                    cmd.commandArgument = CY_SD_HOST_EMMC_SECURE_ERASE;
+                    break;
+                case CY_SD_HOST_ERASE_SECURE_TRIM_STEP_2:
+                    cmd.commandArgument = CY_SD_HOST_EMMC_SECURE_TRIM_STEP_2;
+                    break;
+                case CY_SD_HOST_ERASE_SECURE_TRIM_STEP_1:
+                    cmd.commandArgument = CY_SD_HOST_EMMC_SECURE_TRIM_STEP_1;
+                    break;
+                case CY_SD_HOST_ERASE_TRIM:
+                    cmd.commandArgument = CY_SD_HOST_EMMC_TRIM;
+                    break;
+                default:
+                    ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+                    break;
+            }
+
+            ret = Cy_SD_Host_SendCommand(base, &cmd);
+        }
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_QueueInit
+****************************************************************************//**
+*
+*  Initializes the request queue for the interrupt-driven block reads and
+*  writes. The queue transfers the data with ADMA2, so the SD host must be
+*  initialized with the CY_SD_HOST_DMA_ADMA2 DMA type.
+*
+*  The function enables the Transfer complete and error interrupt signals.
+*  The user must configure the SDHC interrupt and call
+*  \ref Cy_SD_Host_QueueInterrupt from the interrupt handler.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \param *queue
+*     The pointer to the queue structure allocated by the user.
+*
+* \param dataTimeout
+*     The timeout value for the transfers.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_sd_host_context_t allocated
+* by the user. The card must be initialized by \ref Cy_SD_Host_InitCard.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_QueueInit(SDHC_Type *base,
+                                            cy_stc_sd_host_queue_t *queue,
+                                            uint32_t dataTimeout,
+                                            cy_stc_sd_host_context_t const *context)
+{
+    cy_en_sd_host_status_t ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+
+    if ((NULL != base) && (NULL != queue) && (NULL != context) &&
+        (CY_SD_HOST_DMA_ADMA2 == context->dmaType))
+    {
+        CY_ASSERT_L2(CY_SD_HOST_IS_TIMEOUT_VALID(dataTimeout));
+
+        queue->base = base;
+        queue->context = context;
+        queue->head = NULL;
+        queue->tail = NULL;
+        queue->dataTimeout = dataTimeout;
+
+        /* The queue is driven by the Transfer complete and error interrupts. */
+        Cy_SD_Host_SetNormalInterruptMask(base, Cy_SD_Host_GetNormalInterruptMask(base) |
+                                                CY_SD_HOST_XFER_COMPLETE);
+        Cy_SD_Host_SetErrorInterruptMask(base, Cy_SD_Host_GetErrorInterruptMask(base) |
+                                               CY_SD_HOST_ERROR_INT_MSK);
+
+        ret = CY_SD_HOST_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_QueueSubmit
+****************************************************************************//**
+*
+*  Adds a block read or write request to the queue and exits. If the queue is
+*  empty, the command of the request is sent immediately. Otherwise
+*  \ref Cy_SD_Host_QueueInterrupt sends it when the previous request completes,
+*  so the queued requests are transferred back to back.
+*
+*  The request status is CY_SD_HOST_OPERATION_INPROGRESS until the request is
+*  complete. Then the callback of the request is called from
+*  \ref Cy_SD_Host_QueueInterrupt.
+*
+* \note The data buffer must be word-aligned. The data must not be accessed
+* until the request is complete.
+*
+* \param *queue
+*     The pointer to the queue structure initialized by \ref Cy_SD_Host_QueueInit.
+*
+* \param *request
+*     The pointer to the request. The request is owned by the driver until it
+*     is complete.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_QueueSubmit(cy_stc_sd_host_queue_t *queue,
+                                              cy_stc_sd_host_request_t *request)
+{
+    cy_en_sd_host_status_t ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    uint32_t               interruptState;
+    uint32_t               blocks;
+    uint32_t               line;
+    uint32_t               lineBlocks;
+    uint32_t               maxSectorNum;
+
+    if ((NULL != queue) && (NULL != request) && (NULL != request->data) &&
+        (0UL < request->numberOfBlocks) && (CY_SD_HOST_QUEUE_MAX_BLOCKS >= request->numberOfBlocks))
+    {
+        maxSectorNum = queue->context->maxSectorNum;
+
+        /* 0 < maxSectorNum check is needed for legacy cards. */
+        if (!((0UL < maxSectorNum) &&
+             ((maxSectorNum - request->address) < request->numberOfBlocks)))
+        {
+            /* Build the ADMA2 descriptor table of the request. */
+            blocks = request->numberOfBlocks;
+            line = 0UL;
+            while (0UL < blocks)
+            {
+                lineBlocks = (CY_SD_HOST_QUEUE_LINE_BLOCKS < blocks) ? CY_SD_HOST_QUEUE_LINE_BLOCKS : blocks;
+                blocks -= lineBlocks;
+
+                request->adma2Descr[line] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | /* Attr Valid */
+                                     (((0UL == blocks) ? 1UL : 0UL) << CY_SD_HOST_ADMA_ATTR_END_POS) | /* Attr End */
+                                     (0UL << CY_SD_HOST_ADMA_ATTR_INT_POS) |   /* Attr Int */
+                                     (CY_SD_HOST_ADMA_TRAN << CY_SD_HOST_ADMA_ACT_POS) |
+                                     ((CY_SD_HOST_BLOCK_SIZE * lineBlocks) << CY_SD_HOST_ADMA_LEN_POS); /* Len */
+
+                request->adma2Descr[line + 1UL] = (uint32_t)request->data +
+                    (CY_SD_HOST_BLOCK_SIZE * CY_SD_HOST_QUEUE_LINE_BLOCKS * (line / CY_SD_HOST_ADMA2_DESCR_SIZE));
+
+                line += CY_SD_HOST_ADMA2_DESCR_SIZE;
+            }
+
+            request->next = NULL;
+            request->status = CY_SD_HOST_OPERATION_INPROGRESS;
+            ret = CY_SD_HOST_SUCCESS;
+
+            interruptState = Cy_SysLib_EnterCriticalSection();
+
+            if (NULL == queue->head)
+            {
+                /* The queue is idle - start the request now. */
+                ret = Cy_SD_Host_QueueSendRequest(queue, request);
+
+                if (CY_SD_HOST_SUCCESS == ret)
+                {
+                    queue->head = request;
+                    queue->tail = request;
+                }
+                else
+                {
+                    request->status = ret;
+                }
+            }
+            else
+            {
+                queue->tail->next = request;
+                queue->tail = request;
+            }
+
+            Cy_SysLib_ExitCriticalSection(interruptState);
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_QueueIsBusy
+****************************************************************************//**
+*
+*  Checks whether the queue has requests in progress.
+*
+* \param *queue
+*     The pointer to the queue structure initialized by \ref Cy_SD_Host_QueueInit.
+*
+* \return bool
+*     true - the queue has requests in progress, false - the queue is empty.
+*
+*******************************************************************************/
+bool Cy_SD_Host_QueueIsBusy(cy_stc_sd_host_queue_t const *queue)
+{
+    return (NULL != queue->head);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_QueueInterrupt
+****************************************************************************//**
+*
+*  Handles the Transfer complete and error events of the queued requests.
+*  The function must be called from the SDHC interrupt handler.
+*
+*  When the request in progress completes, the function sends the command of
+*  the next queued request first and then calls the callback of the completed
+*  request. On an error, the transfer is aborted with
+*  \ref Cy_SD_Host_AbortTransfer, the request completes with the CY_SD_HOST_ERROR
+*  status and the queue continues with the next request.
+*
+*  The function handles only the Transfer complete, Command complete and error
+*  events. The other events, for example, Card Insertion, can be handled by
+*  the user in the same interrupt handler.
+*
+* \param *queue
+*     The pointer to the queue structure initialized by \ref Cy_SD_Host_QueueInit.
+*
+*******************************************************************************/
+void Cy_SD_Host_QueueInterrupt(cy_stc_sd_host_queue_t *queue)
+{
+    cy_stc_sd_host_request_t *request = queue->head;
+    uint32_t                 intNormal;
+    uint32_t                 intError;
+
+    if (NULL != request)
+    {
+        intNormal = Cy_SD_Host_GetNormalInterruptStatus(queue->base);
+
+        if (0UL != (intNormal & CY_SD_HOST_ERR_INTERRUPT))
+        {
+            intError = Cy_SD_Host_GetErrorInterruptStatus(queue->base);
+            Cy_SD_Host_ClearErrorInterruptStatus(queue->base, intError);
+            Cy_SD_Host_ClearNormalInterruptStatus(queue->base, CY_SD_HOST_CMD_COMPLETE |
+                                                               CY_SD_HOST_XFER_COMPLETE);
+
+            if (Cy_SD_Host_IsRetuneError(queue->base, intError))
+            {
+                cy_sd_host_retuneNeeded[Cy_SD_Host_GetInstance(queue->base)] = true;
+            }
+
+            /* Reset the lines and return the card to the transfer state. */
+            Cy_SD_Host_SoftwareReset(queue->base, CY_SD_HOST_RESET_CMD_LINE);
+            Cy_SD_Host_SoftwareReset(queue->base, CY_SD_HOST_RESET_DATALINE);
+            (void)Cy_SD_Host_AbortTransfer(queue->base, queue->context);
+
+            request->status = CY_SD_HOST_ERROR;
+        }
+        else if (0UL != (intNormal & CY_SD_HOST_XFER_COMPLETE))
+        {
+            Cy_SD_Host_ClearNormalInterruptStatus(queue->base, CY_SD_HOST_CMD_COMPLETE |
+                                                               CY_SD_HOST_XFER_COMPLETE);
+
+            request->status = CY_SD_HOST_SUCCESS;
+        }
+        else
+        {
+            /* The request is in progress. */
+        }
+
+        if (CY_SD_HOST_OPERATION_INPROGRESS != request->status)
+        {
+            queue->head = request->next;
+            if (NULL == queue->head)
+            {
+                queue->tail = NULL;
+            }
+
+            /* Keep the bus busy: start the next request before the callback. */
+            Cy_SD_Host_QueueStart(queue);
+
+            if (NULL != request->callback)
+            {
+                request->callback(request);
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_QueueSendRequest
+****************************************************************************//**
+*
+*  Initializes the ADMA2 transfer of the queued request and sends its command.
+*  Multiple-block transfers are stopped by Auto CMD12.
+*
+* \param *queue
+*     The pointer to the queue structure.
+*
+* \param *request
+*     The pointer to the request to start.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+static cy_en_sd_host_status_t Cy_SD_Host_QueueSendRequest(cy_stc_sd_host_queue_t const *queue,
+                                                          cy_stc_sd_host_request_t *request)
+{
+    cy_en_sd_host_status_t       ret;
+    cy_stc_sd_host_cmd_config_t  cmd;
+    cy_stc_sd_host_data_config_t dataConfig;
+    uint32_t                     dataAddress = request->address;
+    bool                         multiBlock = (1UL < request->numberOfBlocks);
+
+    if (CY_SD_HOST_SDSC == queue->context->cardCapacity)
+    {
+        /* The SDSC card uses a byte-unit address, multiply by 512 */
+        dataAddress = dataAddress << CY_SD_HOST_SDSC_ADDR_SHIFT;
+    }
+
+    if (request->read)
+    {
+        cmd.commandIndex = multiBlock ? CY_SD_HOST_SD_CMD18 : CY_SD_HOST_SD_CMD17;
+    }
+    else
+    {
+        cmd.commandIndex = multiBlock ? CY_SD_HOST_SD_CMD25 : CY_SD_HOST_SD_CMD24;
+    }
+
+    dataConfig.blockSize = CY_SD_HOST_BLOCK_SIZE;
+    dataConfig.numberOfBlock = request->numberOfBlocks;
+    dataConfig.enableDma = true;
+    dataConfig.autoCommand = multiBlock ? CY_SD_HOST_AUTO_CMD_12 : CY_SD_HOST_AUTO_CMD_NONE;
+    dataConfig.read = request->read;
+    dataConfig.data = &request->adma2Descr[0];
+    dataConfig.dataTimeout = queue->dataTimeout;
+    dataConfig.enableIntAtBlockGap = false;
+    dataConfig.enReliableWrite = false;
+
+    ret = Cy_SD_Host_InitDataTransfer(queue->base, &dataConfig);
+
+    if (CY_SD_HOST_SUCCESS == ret)
+    {
+        cmd.commandArgument = dataAddress;
+        cmd.dataPresent     = true;
+        cmd.enableAutoResponseErrorCheck = false;
+        cmd.respType        = CY_SD_HOST_RESPONSE_LEN_48;
+        cmd.enableCrcCheck  = true;
+        cmd.enableIdxCheck  = true;
+        cmd.cmdType         = CY_SD_HOST_CMD_NORMAL;
+
+        ret = Cy_SD_Host_SendCommand(queue->base, &cmd);
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_QueueStart
+****************************************************************************//**
+*
+*  Starts the request at the head of the queue. The requests which cannot be
+*  started are completed with an error.
+*
+* \param *queue
+*     The pointer to the queue structure.
+*
+*******************************************************************************/
+static void Cy_SD_Host_QueueStart(cy_stc_sd_host_queue_t *queue)
+{
+    cy_stc_sd_host_request_t *request = queue->head;
+    cy_en_sd_host_status_t   ret;
+
+    while (NULL != request)
+    {
+        ret = Cy_SD_Host_QueueSendRequest(queue, request);
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            break;
+        }
+
+        queue->head = request->next;
+        if (NULL == queue->head)
+        {
+            queue->tail = NULL;
+        }
+
+        request->status = ret;
+        if (NULL != request->callback)
+        {
+            request->callback(request);
+        }
+
+        request = queue->head;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_BatchTransfer
+****************************************************************************//**
+*
+*  Starts a batch of block reads and writes in the ADMA3 mode. For each entry,
+*  the function builds a Command descriptor (the Block Count, Block Size,
+*  Argument, Transfer Mode and Command registers) followed by the ADMA2
+*  descriptors of the data, and links the Command descriptors in the
+*  Integrated descriptor table. Writing the Integrated Descriptor Address
+*  starts the batch, the SD host executes all the commands without the CPU.
+*  Multiple-block entries are stopped by Auto CMD12.
+*
+*  This function does not wait for the transfers. The Transfer complete event
+*  is set when the last command completes. The Command complete and Response
+*  interrupts of the commands are disabled and the R1 responses are checked
+*  by the SD host; any error stops the batch with an error event.
+*
+* \note The arena and the data buffers must be word-aligned and must not be
+* modified until the batch completes.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \param *entries
+*     The array of the batch entries.
+*
+* \param numberOfEntries
+*     The number of entries in the batch.
+*
+* \param *arena
+*     The pointer to the memory for the descriptors.
+*
+* \param arenaSize
+*     The arena size in 32-bit words, see \ref CY_SD_HOST_ADMA3_ARENA_SIZE.
+*
+* \param dataTimeout
+*     The timeout value for the transfers.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_sd_host_context_t allocated
+* by the user. The SD host must be initialized with the CY_SD_HOST_DMA_ADMA2_ADMA3
+* DMA type.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_BatchTransfer(SDHC_Type *base,
+                                                cy_stc_sd_host_batch_entry_t const *entries,
+                                                uint32_t numberOfEntries,
+                                                uint32_t *arena,
+                                                uint32_t arenaSize,
+                                                uint32_t dataTimeout,
+                                                cy_stc_sd_host_context_t const *context)
+{
+    cy_en_sd_host_status_t ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    uint32_t               *descr;
+    uint32_t               requiredSize;
+    uint32_t               dataAddress;
+    uint32_t               transferMode;
+    uint32_t               command;
+    uint32_t               blocks;
+    uint32_t               lineBlocks;
+    uint32_t               lineAddress;
+    uint32_t               i;
+
+    if ((NULL != base) && (NULL != entries) && (NULL != arena) && (NULL != context) &&
+        (0UL < numberOfEntries) && (CY_SD_HOST_DMA_ADMA2_ADMA3 == context->dmaType))
+    {
+        CY_ASSERT_L2(CY_SD_HOST_IS_TIMEOUT_VALID(dataTimeout));
+
+        ret = CY_SD_HOST_SUCCESS;
+        requiredSize = numberOfEntries * CY_SD_HOST_ADMA3_ID_SIZE;
+
+        for (i = 0UL; (i < numberOfEntries) && (CY_SD_HOST_SUCCESS == ret); i++)
+        {
+            /* 0 < maxSectorNum check is needed for legacy cards. */
+            if ((NULL == entries[i].data) || (0UL == entries[i].numberOfBlocks) ||
+                ((0UL < context->maxSectorNum) &&
+                 ((context->maxSectorNum - entries[i].address) < entries[i].numberOfBlocks)))
+            {
+                ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+            }
+
+            requiredSize += CY_SD_HOST_ADMA3_CMD_DESCR_SIZE + (CY_SD_HOST_ADMA2_DESCR_SIZE *
+                ((entries[i].numberOfBlocks + CY_SD_HOST_QUEUE_LINE_BLOCKS - 1UL) / CY_SD_HOST_QUEUE_LINE_BLOCKS));
+        }
+
+        if (requiredSize > arenaSize)
+        {
+            ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+        }
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            ret = Cy_SD_Host_PollCmdLineFree(base);
+        }
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            ret = Cy_SD_Host_PollDataLineNotInhibit(base);
+        }
+    }
+
+    if (CY_SD_HOST_SUCCESS == ret)
+    {
+        /* The Command descriptors follow the Integrated descriptor table. */
+        descr = &arena[numberOfEntries * CY_SD_HOST_ADMA3_ID_SIZE];
+
+        for (i = 0UL; i < numberOfEntries; i++)
+        {
+            dataAddress = entries[i].address;
+            blocks = entries[i].numberOfBlocks;
+
+            if (CY_SD_HOST_SDSC == context->cardCapacity)
+            {
+                /* The SDSC card uses a byte-unit address, multiply by 512 */
+                dataAddress = dataAddress << CY_SD_HOST_SDSC_ADDR_SHIFT;
+            }
+
+            if (entries[i].read)
+            {
+                command = (1UL < blocks) ? CY_SD_HOST_SD_CMD18 : CY_SD_HOST_SD_CMD17;
+            }
+            else
+            {
+                command = (1UL < blocks) ? CY_SD_HOST_SD_CMD25 : CY_SD_HOST_SD_CMD24;
+            }
+
+            command = _VAL2FLD(SDHC_CORE_CMD_R_RESP_TYPE_SELECT, (uint32_t)CY_SD_HOST_RESPONSE_LEN_48) |
+                      _VAL2FLD(SDHC_CORE_CMD_R_CMD_TYPE, (uint32_t)CY_SD_HOST_CMD_NORMAL) |
+                      _VAL2FLD(SDHC_CORE_CMD_R_DATA_PRESENT_SEL, 1UL) |
+                      _VAL2FLD(SDHC_CORE_CMD_R_CMD_IDX_CHK_ENABLE, 1UL) |
+                      _VAL2FLD(SDHC_CORE_CMD_R_CMD_CRC_CHK_ENABLE, 1UL) |
+                      _VAL2FLD(SDHC_CORE_CMD_R_CMD_INDEX, command);
+
+            transferMode = _VAL2FLD(SDHC_CORE_XFER_MODE_R_DMA_ENABLE, 1UL) |
+                           _VAL2FLD(SDHC_CORE_XFER_MODE_R_BLOCK_COUNT_ENABLE, 1UL) |
+                           _VAL2FLD(SDHC_CORE_XFER_MODE_R_AUTO_CMD_ENABLE, ((1UL < blocks) ? 1UL : 0UL)) |
+                           _BOOL2FLD(SDHC_CORE_XFER_MODE_R_DATA_XFER_DIR, entries[i].read) |
+                           _VAL2FLD(SDHC_CORE_XFER_MODE_R_MULTI_BLK_SEL, ((1UL < blocks) ? 1UL : 0UL)) |
+                           _VAL2FLD(SDHC_CORE_XFER_MODE_R_RESP_TYPE, 0UL) | /* R1 - memory. */
+                           _VAL2FLD(SDHC_CORE_XFER_MODE_R_RESP_ERR_CHK_ENABLE, 1UL) |
+                           _VAL2FLD(SDHC_CORE_XFER_MODE_R_RESP_INT_DISABLE, 1UL);
+
+            /* The Integrated descriptor of the entry. */
+            arena[i * CY_SD_HOST_ADMA3_ID_SIZE] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | /* Attr Valid */
+                                 (((i == (numberOfEntries - 1UL)) ? 1UL : 0UL) << CY_SD_HOST_ADMA_ATTR_END_POS) | /* Attr End */
+                                 (0UL << CY_SD_HOST_ADMA_ATTR_INT_POS) |   /* Attr Int */
+                                 (CY_SD_HOST_ADMA3_INTERGRATED << CY_SD_HOST_ADMA_ACT_POS);
+            arena[(i * CY_SD_HOST_ADMA3_ID_SIZE) + 1UL] = (uint32_t)descr;
+
+            /* The Command descriptor: the 32-bit Block Count, the Block Size
+            * (the 16-bit Block Count is 0 to select the 32-bit one),
+            * the Argument, the Transfer Mode and the Command registers.
+            */
+            descr[0] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | (CY_SD_HOST_ADMA3_CMD << CY_SD_HOST_ADMA_ACT_POS);
+            descr[1] = blocks;
+            descr[2] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | (CY_SD_HOST_ADMA3_CMD << CY_SD_HOST_ADMA_ACT_POS);
+            descr[3] = CY_SD_HOST_BLOCK_SIZE;
+            descr[4] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | (CY_SD_HOST_ADMA3_CMD << CY_SD_HOST_ADMA_ACT_POS);
+            descr[5] = dataAddress;
+            descr[6] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | (1UL << CY_SD_HOST_ADMA_ATTR_END_POS) |
+                       (CY_SD_HOST_ADMA3_CMD << CY_SD_HOST_ADMA_ACT_POS);
+            descr[7] = transferMode | (command << 16U);
+            descr = &descr[CY_SD_HOST_ADMA3_CMD_DESCR_SIZE];
+
+            /* The ADMA2 descriptors of the entry data. */
+            lineAddress = (uint32_t)entries[i].data;
+            while (0UL < blocks)
+            {
+                lineBlocks = (CY_SD_HOST_QUEUE_LINE_BLOCKS < blocks) ? CY_SD_HOST_QUEUE_LINE_BLOCKS : blocks;
+                blocks -= lineBlocks;
+
+                descr[0] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | /* Attr Valid */
+                           (((0UL == blocks) ? 1UL : 0UL) << CY_SD_HOST_ADMA_ATTR_END_POS) | /* Attr End */
+                           (0UL << CY_SD_HOST_ADMA_ATTR_INT_POS) |   /* Attr Int */
+                           (CY_SD_HOST_ADMA_TRAN << CY_SD_HOST_ADMA_ACT_POS) |
+                           ((CY_SD_HOST_BLOCK_SIZE * lineBlocks) << CY_SD_HOST_ADMA_LEN_POS); /* Len */
+                descr[1] = lineAddress;
+
+                lineAddress += CY_SD_HOST_BLOCK_SIZE * lineBlocks;
+                descr = &descr[CY_SD_HOST_ADMA2_DESCR_SIZE];
+            }
+        }
+
+        /* Set the data timeout (Base clock*2^27). */
+        SDHC_CORE_TOUT_CTRL_R(base) = _CLR_SET_FLD8U(SDHC_CORE_TOUT_CTRL_R(base),
+                                                SDHC_CORE_TOUT_CTRL_R_TOUT_CNT,
+                                                dataTimeout);
+
+        /* Writing the Integrated Descriptor Address starts the batch. */
+        SDHC_CORE_ADMA_ID_LOW_R(base) = (uint32_t)arena;
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_eMMC_PackedWrite
+****************************************************************************//**
+*
+*  Writes several block ranges to the eMMC with one packed write command.
+*  The function fills the packed header (the CMD23 and CMD25 arguments of each
+*  entry) and the ADMA2 descriptors in the arena, sends CMD23 with the Packed
+*  flag and the total number of blocks including the header, and then starts
+*  CMD25. The device can program the entries in any order.
+*
+*  This function does not wait for the data transfer. Wait for the Transfer
+*  complete event. If the device reports an error, the status of the entries
+*  is in the PACKED_COMMAND_STATUS and PACKED_FAILURE_INDEX fields of EXT_CSD.
+*
+* \note The arena and the data buffers must be word-aligned and must not be
+* modified until the transfer completes.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \param *entries
+*     The array of the write entries, the read member must be false.
+*
+* \param numberOfEntries
+*     The number of entries, from 1 to the value returned by
+*     \ref Cy_SD_Host_eMMC_GetMaxPackedWrites.
+*
+* \param *arena
+*     The pointer to the memory for the packed header and the descriptors.
+*
+* \param arenaSize
+*     The arena size in 32-bit words, see \ref CY_SD_HOST_PACKED_ARENA_SIZE.
+*
+* \param dataTimeout
+*     The timeout value for the transfer.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_sd_host_context_t allocated
+* by the user. The SD host must be initialized with the CY_SD_HOST_DMA_ADMA2
+* DMA type.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_eMMC_PackedWrite(SDHC_Type *base,
+                                                   cy_stc_sd_host_batch_entry_t const *entries,
+                                                   uint32_t numberOfEntries,
+                                                   uint32_t *arena,
+                                                   uint32_t arenaSize,
+                                                   uint32_t dataTimeout,
+                                                   cy_stc_sd_host_context_t const *context)
+{
+    cy_en_sd_host_status_t       ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    cy_stc_sd_host_cmd_config_t  cmd;
+    cy_stc_sd_host_data_config_t dataConfig;
+    uint32_t                     *descr;
+    uint32_t                     requiredSize;
+    uint32_t                     totalBlocks;
+    uint32_t                     blocks;
+    uint32_t                     lineBlocks;
+    uint32_t                     lineAddress;
+    uint32_t                     addrShift = 0UL;
+    uint32_t                     i;
+
+    if ((NULL != base) && (NULL != entries) && (NULL != arena) && (NULL != context) &&
+        (0UL < numberOfEntries) && (CY_SD_HOST_PACKED_MAX_ENTRIES >= numberOfEntries) &&
+        (CY_SD_HOST_EMMC == context->cardType) && (CY_SD_HOST_DMA_ADMA2 == context->dmaType))
+    {
+        ret = CY_SD_HOST_SUCCESS;
+        totalBlocks = 1UL; /* The packed header. */
+        requiredSize = (CY_SD_HOST_BLOCK_SIZE / 4UL) + CY_SD_HOST_ADMA2_DESCR_SIZE;
+
+        for (i = 0UL; (i < numberOfEntries) && (CY_SD_HOST_SUCCESS == ret); i++)
+        {
+            /* 0 < maxSectorNum check is needed for legacy cards. */
+            if ((NULL == entries[i].data) || (0UL == entries[i].numberOfBlocks) || (entries[i].read) ||
+                ((0UL < context->maxSectorNum) &&
+                 ((context->maxSectorNum - entries[i].address) < entries[i].numberOfBlocks)))
+            {
+                ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+            }
+
+            totalBlocks += entries[i].numberOfBlocks;
+            requiredSize += CY_SD_HOST_ADMA2_DESCR_SIZE *
+                ((entries[i].numberOfBlocks + CY_SD_HOST_QUEUE_LINE_BLOCKS - 1UL) / CY_SD_HOST_QUEUE_LINE_BLOCKS);
+        }
+
+        if ((requiredSize > arenaSize) || (CY_SD_HOST_CMD23_BLOCKS_NUM_MASK < totalBlocks))
+        {
+            ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+        }
+    }
+
+    if (CY_SD_HOST_SUCCESS == ret)
+    {
+        /* The packed header block. */
+        (void)memset(arena, 0, CY_SD_HOST_BLOCK_SIZE);
+        arena[0] = CY_SD_HOST_PACKED_VERSION |
+                   (CY_SD_HOST_PACKED_WRITE << CY_SD_HOST_PACKED_RW_POS) |
+                   (numberOfEntries << CY_SD_HOST_PACKED_NUM_ENTRIES_POS);
+
+        /* The ADMA2 descriptors: the header and the entries data. */
+        descr = &arena[CY_SD_HOST_BLOCK_SIZE / 4UL];
+        descr[0] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | /* Attr Valid */
+                   (0UL << CY_SD_HOST_ADMA_ATTR_END_POS) |   /* Attr End */
+                   (0UL << CY_SD_HOST_ADMA_ATTR_INT_POS) |   /* Attr Int */
+                   (CY_SD_HOST_ADMA_TRAN << CY_SD_HOST_ADMA_ACT_POS) |
+                   (CY_SD_HOST_BLOCK_SIZE << CY_SD_HOST_ADMA_LEN_POS); /* Len */
+        descr[1] = (uint32_t)arena;
+
+        if (CY_SD_HOST_SDSC == context->cardCapacity)
+        {
+            /* The eMMC of 2 GB or less uses a byte-unit address, multiply by 512 */
+            addrShift = CY_SD_HOST_SDSC_ADDR_SHIFT;
+        }
+        descr = &descr[CY_SD_HOST_ADMA2_DESCR_SIZE];
+
+        for (i = 0UL; i < numberOfEntries; i++)
+        {
+            /* The CMD23 and CMD25 arguments of the entry. */
+            arena[(i + 1UL) * 2UL] = entries[i].numberOfBlocks;
+            arena[((i + 1UL) * 2UL) + 1UL] = entries[i].address << addrShift;
+
+            blocks = entries[i].numberOfBlocks;
+            lineAddress = (uint32_t)entries[i].data;
+            while (0UL < blocks)
+            {
+                lineBlocks = (CY_SD_HOST_QUEUE_LINE_BLOCKS < blocks) ? CY_SD_HOST_QUEUE_LINE_BLOCKS : blocks;
+                blocks -= lineBlocks;
+
+                descr[0] = (1UL << CY_SD_HOST_ADMA_ATTR_VALID_POS) | /* Attr Valid */
+                           ((((0UL == blocks) && (i == (numberOfEntries - 1UL))) ? 1UL : 0UL) <<
+                            CY_SD_HOST_ADMA_ATTR_END_POS) | /* Attr End */
+                           (0UL << CY_SD_HOST_ADMA_ATTR_INT_POS) |   /* Attr Int */
+                           (CY_SD_HOST_ADMA_TRAN << CY_SD_HOST_ADMA_ACT_POS) |
+                           ((CY_SD_HOST_BLOCK_SIZE * lineBlocks) << CY_SD_HOST_ADMA_LEN_POS); /* Len */
+                descr[1] = lineAddress;
+
+                lineAddress += CY_SD_HOST_BLOCK_SIZE * lineBlocks;
+                descr = &descr[CY_SD_HOST_ADMA2_DESCR_SIZE];
+            }
+        }
+
+        /* CMD23 with the Packed flag. */
+        cmd.commandIndex    = CY_SD_HOST_SD_CMD23;
+        cmd.commandArgument = totalBlocks | (1UL << CY_SD_HOST_CMD23_PACKED_POS);
+        cmd.dataPresent     = false;
+        cmd.enableAutoResponseErrorCheck = false;
+        cmd.respType        = CY_SD_HOST_RESPONSE_LEN_48;
+        cmd.enableCrcCheck  = true;
+        cmd.enableIdxCheck  = true;
+        cmd.cmdType         = CY_SD_HOST_CMD_NORMAL;
+
+        ret = Cy_SD_Host_SendCommand(base, &cmd);
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            /* Wait for the Command Complete event. */
+            ret = Cy_SD_Host_PollCmdComplete(base);
+        }
+
+        Cy_SysLib_DelayUs(CY_SD_HOST_NCC_MIN_US);
+    }
+
+    if (CY_SD_HOST_SUCCESS == ret)
+    {
+        /* The block count is predefined by CMD23, no CMD12 is needed. */
+        dataConfig.blockSize = CY_SD_HOST_BLOCK_SIZE;
+        dataConfig.numberOfBlock = totalBlocks;
+        dataConfig.enableDma = true;
+        dataConfig.autoCommand = CY_SD_HOST_AUTO_CMD_NONE;
+        dataConfig.read = false;
+        dataConfig.data = &arena[CY_SD_HOST_BLOCK_SIZE / 4UL];
+        dataConfig.dataTimeout = dataTimeout;
+        dataConfig.enableIntAtBlockGap = false;
+        dataConfig.enReliableWrite = false;
+
+        ret = Cy_SD_Host_InitDataTransfer(base, &dataConfig);
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            /* CMD25 with the address of the first entry. */
+            cmd.commandIndex    = CY_SD_HOST_SD_CMD25;
+            cmd.commandArgument = entries[0].address << addrShift;
+            cmd.dataPresent     = true;
+
+            ret = Cy_SD_Host_SendCommand(base, &cmd);
+
+            if (CY_SD_HOST_SUCCESS == ret)
+            {
+                /* Wait for the Command Complete event. */
+                ret = Cy_SD_Host_PollCmdComplete(base);
+            }
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_StreamOpen
+****************************************************************************//**
+*
+*  Starts an open-ended multiple-block write (CMD25 without the block count)
+*  for continuous recording. For SD cards, ACMD23 is sent first to pre-erase
+*  preEraseBlocks blocks ahead of the write, which reduces the card write
+*  latency. The data is added by \ref Cy_SD_Host_StreamWrite and the write
+*  is finished by \ref Cy_SD_Host_StreamFlush.
+*
+*  The stream transfers the data through the buffer data port, the DMA is not
+*  used. No other command can be sent until the stream is flushed.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \param *stream
+*     The pointer to the stream structure allocated by the user.
+*
+* \param address
+*     The address of the first block on the card.
+*
+* \param preEraseBlocks
+*     The number of blocks to pre-erase (SD cards only), 0 - no pre-erase.
+*
+* \param dataTimeout
+*     The timeout value for the transfer.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_sd_host_context_t allocated
+* by the user. The structure is used during the SD host operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_StreamOpen(SDHC_Type *base,
+                                             cy_stc_sd_host_stream_t *stream,
+                                             uint32_t address,
+                                             uint32_t preEraseBlocks,
+                                             uint32_t dataTimeout,
+                                             cy_stc_sd_host_context_t const *context)
+{
+    cy_en_sd_host_status_t      ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    cy_stc_sd_host_cmd_config_t cmd;
+    uint32_t                    dataAddress = address;
+
+    if ((NULL != base) && (NULL != stream) && (NULL != context) &&
+        (!((0UL < context->maxSectorNum) && (context->maxSectorNum <= address))))
+    {
+        CY_ASSERT_L2(CY_SD_HOST_IS_TIMEOUT_VALID(dataTimeout));
+
+        stream->base = base;
+        stream->context = context;
+        stream->address = address;
+        stream->open = false;
+
+        ret = CY_SD_HOST_SUCCESS;
+
+        if ((0UL < preEraseBlocks) &&
+            ((CY_SD_HOST_SD == context->cardType) || (CY_SD_HOST_COMBO == context->cardType)))
+        {
+            /* Set the number of blocks to pre-erase (ACMD23). */
+            ret = Cy_SD_Host_OpsSetWrBlkEraseCount(base, preEraseBlocks, context);
+        }
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            if (CY_SD_HOST_SDSC == context->cardCapacity)
+            {
+                /* The SDSC card uses a byte-unit address, multiply by 512 */
+                dataAddress = dataAddress << CY_SD_HOST_SDSC_ADDR_SHIFT;
+            }
+
+            /* Set the block size and clear the block counts. */
+            SDHC_CORE_BLOCKSIZE_R(base) = (uint16_t)_VAL2FLD(SDHC_CORE_BLOCKSIZE_R_XFER_BLOCK_SIZE,
+                                                             CY_SD_HOST_BLOCK_SIZE);
+            SDHC_CORE_BLOCKCOUNT_R(base) = 0U;
+            SDHC_CORE_SDMASA_R(base) = 0UL;
+
+            /* The multi-block write without the block count and DMA. */
+            SDHC_CORE_XFER_MODE_R(base) = (uint16_t)(_BOOL2FLD(SDHC_CORE_XFER_MODE_R_MULTI_BLK_SEL, true) |
+                                                     _BOOL2FLD(SDHC_CORE_XFER_MODE_R_DATA_XFER_DIR, false) |
+                                                     _BOOL2FLD(SDHC_CORE_XFER_MODE_R_BLOCK_COUNT_ENABLE, false) |
+                                                     _BOOL2FLD(SDHC_CORE_XFER_MODE_R_DMA_ENABLE, false));
+
+            /* Set the data timeout (Base clock*2^27). */
+            SDHC_CORE_TOUT_CTRL_R(base) = _CLR_SET_FLD8U(SDHC_CORE_TOUT_CTRL_R(base),
+                                                    SDHC_CORE_TOUT_CTRL_R_TOUT_CNT,
+                                                    dataTimeout);
+
+            cmd.commandIndex    = CY_SD_HOST_SD_CMD25;
+            cmd.commandArgument = dataAddress;
+            cmd.dataPresent     = true;
+            cmd.enableAutoResponseErrorCheck = false;
+            cmd.respType        = CY_SD_HOST_RESPONSE_LEN_48;
+            cmd.enableCrcCheck  = true;
+            cmd.enableIdxCheck  = true;
+            cmd.cmdType         = CY_SD_HOST_CMD_NORMAL;
+
+            ret = Cy_SD_Host_SendCommand(base, &cmd);
+
+            if (CY_SD_HOST_SUCCESS == ret)
+            {
+                /* Wait for the Command Complete event. */
+                ret = Cy_SD_Host_PollCmdComplete(base);
+            }
+
+            stream->open = (CY_SD_HOST_SUCCESS == ret);
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_StreamWrite
+****************************************************************************//**
+*
+*  Writes the blocks of the user buffer to the open stream. The function waits
+*  for the Buffer Write ready event before each block. The write on the SD bus
+*  is not stopped between the calls.
+*
+* \param *stream
+*     The pointer to the stream structure opened by \ref Cy_SD_Host_StreamOpen.
+*
+* \param *data
+*     The pointer to the data, word-aligned.
+*
+* \param numberOfBlocks
+*     The number of blocks to write.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_StreamWrite(cy_stc_sd_host_stream_t *stream,
+                                              uint32_t const *data,
+                                              uint32_t numberOfBlocks)
+{
+    cy_en_sd_host_status_t ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    uint32_t               maxSectorNum;
+    uint32_t               block;
+    uint32_t               i;
+
+    if ((NULL != stream) && (NULL != data) && (stream->open))
+    {
+        maxSectorNum = stream->context->maxSectorNum;
+
+        /* 0 < maxSectorNum check is needed for legacy cards. */
+        if (!((0UL < maxSectorNum) && ((maxSectorNum - stream->address) < numberOfBlocks)))
+        {
+            ret = CY_SD_HOST_SUCCESS;
+
+            for (block = 0UL; (block < numberOfBlocks) && (CY_SD_HOST_SUCCESS == ret); block++)
+            {
+                ret = Cy_SD_Host_PollBufferWriteReady(stream->base);
+
+                if (CY_SD_HOST_SUCCESS == ret)
+                {
+                    for (i = 0UL; i < (CY_SD_HOST_BLOCK_SIZE / 4UL); i++)
+                    {
+                        SDHC_CORE_BUF_DATA_R(stream->base) = *data;
+                        data++;
+                    }
+
+                    stream->address++;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_StreamFlush
+****************************************************************************//**
+*
+*  Finishes the stream write. The function requests the stop at the block gap,
+*  waits for the last block and sends CMD12. Then it waits until the card is
+*  not busy and resets the CMD and DAT lines.
+*
+* \param *stream
+*     The pointer to the stream structure opened by \ref Cy_SD_Host_StreamOpen.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_StreamFlush(cy_stc_sd_host_stream_t *stream)
+{
+    cy_en_sd_host_status_t      ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    cy_stc_sd_host_cmd_config_t cmd;
+
+    if ((NULL != stream) && (stream->open))
+    {
+        /* Stop the transfer after the last written block. */
+        Cy_SD_Host_StopAtBlockGap(stream->base);
+
+        ret = Cy_SD_Host_PollTransferComplete(stream->base);
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            /* Issue CMD12. */
+            cmd.commandIndex    = CY_SD_HOST_SD_CMD12;
+            cmd.commandArgument = 0UL;
+            cmd.dataPresent     = false;
+            cmd.enableAutoResponseErrorCheck = false;
+            cmd.respType        = CY_SD_HOST_RESPONSE_LEN_48B;
+            cmd.enableCrcCheck  = true;
+            cmd.enableIdxCheck  = true;
+            cmd.cmdType         = CY_SD_HOST_CMD_ABORT;
+
+            ret = Cy_SD_Host_SendCommand(stream->base, &cmd);
 
             if (CY_SD_HOST_SUCCESS == ret)
             {
                 /* Wait for the Command Complete event. */
-                ret = Cy_SD_Host_PollCmdComplete(base);
+                ret = Cy_SD_Host_PollCmdComplete(stream->base);
             }
 
-            /* Erase (CMD38) */
-            cmd.commandIndex = CY_SD_HOST_SD_CMD38;
-
-            switch (eraseType)
+            if (CY_SD_HOST_SUCCESS == ret)
             {
-                case CY_SD_HOST_ERASE_ERASE:
-                    cmd.commandArgument = CY_SD_HOST_ERASE;
-                    break;
-                case CY_SD_HOST_ERASE_DISCARD:
-                    if (CY_SD_HOST_EMMC == context->cardType)
-                    {
-                        cmd.commandArgument = CY_SD_HOST_EMMC_DISCARD;
-                    }
-                    else
-                    {
-                        cmd.commandArgument = CY_SD_HOST_SD_DISCARD;
-                    }
-                    break;
-                case CY_SD_HOST_ERASE_FULE:
-                    cmd.commandArgument = CY_SD_HOST_SD_FULE;
-                    break;
-                case CY_SD_HOST_ERASE_SECURE:
-                    cmd.commandArgument = CY_SD_HOST_EMMC_SECURE_ERASE;
-                    break;
-                case CY_SD_HOST_ERASE_SECURE_TRIM_STEP_2:
-                    cmd.commandArgument = CY_SD_HOST_EMMC_SECURE_TRIM_STEP_2;
-                    break;
-                case CY_SD_HOST_ERASE_SECURE_TRIM_STEP_1:
-                    cmd.commandArgument = CY_SD_HOST_EMMC_SECURE_TRIM_STEP_1;
-                    break;
-                case CY_SD_HOST_ERASE_TRIM:
-                    cmd.commandArgument = CY_SD_HOST_EMMC_TRIM;
-                    break;
-                default:
-                    ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
-                    break;
+                /* Wait for the end of the busy signal. */
+                ret = Cy_SD_Host_PollTransferComplete(stream->base);
             }
-
-            ret = Cy_SD_Host_SendCommand(base, &cmd);
         }
+
+        /* The reset also clears the Stop At Block Gap request. */
+        Cy_SD_Host_SoftwareReset(stream->base, CY_SD_HOST_RESET_CMD_LINE);
+        Cy_SD_Host_SoftwareReset(stream->base, CY_SD_HOST_RESET_DATALINE);
+
+        stream->open = false;
     }
 
     return ret;
 }
 
+
 /* The commands low level section */
 
 /*******************************************************************************
@@ -2356,6 +3403,59 @@ __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_OpsSetBlockCount(SDHC_Type *ba
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SD_Host_OpsSetWrBlkEraseCount
+****************************************************************************//**
+*
+*  Sends ACMD23 (Sends the Set Write Block Erase Count command).
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \param blockNum
+*     The number of blocks to pre-erase.
+*
+* \param context
+*     The pointer to the context structure.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+static cy_en_sd_host_status_t Cy_SD_Host_OpsSetWrBlkEraseCount(SDHC_Type *base,
+                                                               uint32_t blockNum,
+                                                               cy_stc_sd_host_context_t const *context)
+{
+    cy_stc_sd_host_cmd_config_t cmd;
+    cy_en_sd_host_status_t      ret;
+
+    cmd.commandIndex    = CY_SD_HOST_SD_ACMD23;
+    cmd.commandArgument = blockNum & CY_SD_HOST_ACMD23_BLOCKS_NUM_MASK;
+    cmd.dataPresent     = false;
+    cmd.enableAutoResponseErrorCheck = false;
+    cmd.respType        = CY_SD_HOST_RESPONSE_LEN_48;
+    cmd.enableCrcCheck  = true;
+    cmd.enableIdxCheck  = true;
+    cmd.cmdType         = CY_SD_HOST_CMD_NORMAL;
+
+    ret = Cy_SD_Host_OpsSendAppCmd(base, context);
+
+    if (CY_SD_HOST_SUCCESS == ret)
+    {
+        ret = Cy_SD_Host_SendCommand(base, &cmd);
+
+        if (CY_SD_HOST_SUCCESS == ret)
+        {
+            /* Wait for the Command Complete event. */
+            ret = Cy_SD_Host_PollCmdComplete(base);
+        }
+
+        Cy_SysLib_DelayUs(CY_SD_HOST_NCC_MIN_US);
+    }
+
+    return ret;
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SD_Host_OpsProgramCsd
 ****************************************************************************//**
@@ -2731,6 +3831,7 @@ cy_en_sd_host_status_t Cy_SD_Host_Init(SDHC_Type *base,
         SDHC_CORE_XFER_MODE_R(base) = 0U;
 
         context->dmaType = config->dmaType;
+        cy_sd_host_retuneNeeded[Cy_SD_Host_GetInstance(base)] = false;
 
         if (config->emmc)
         {
@@ -2882,7 +3983,10 @@ cy_en_sd_host_status_t  Cy_SD_Host_AbortTransfer(SDHC_Type *base,
 
             Cy_SysLib_DelayUs(CY_SD_HOST_NCC_MIN_US);
 
-            Cy_SD_Host_ErrorReset(base);
+            if (Cy_SD_Host_ErrorReset(base))
+            {
+                cy_sd_host_retuneNeeded[Cy_SD_Host_GetInstance(base)] = true;
+            }
 
             /* Issue CMD13. */
             cmd.commandIndex = CY_SD_HOST_SD_CMD13;
@@ -2917,7 +4021,10 @@ cy_en_sd_host_status_t  Cy_SD_Host_AbortTransfer(SDHC_Type *base,
 
                 Cy_SysLib_DelayUs(CY_SD_HOST_NCC_MIN_US);
 
-                Cy_SD_Host_ErrorReset(base);
+                if (Cy_SD_Host_ErrorReset(base))
+                {
+                    cy_sd_host_retuneNeeded[Cy_SD_Host_GetInstance(base)] = true;
+                }
 
                 /* Issue CMD13. */
                 cmd.commandIndex = CY_SD_HOST_SD_CMD13;
@@ -3465,6 +4572,33 @@ cy_en_sd_host_status_t Cy_SD_Host_GetExtCsd(SDHC_Type *base, uint32_t *extCsd,
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SD_Host_eMMC_GetMaxPackedWrites
+****************************************************************************//**
+*
+*  Returns the maximum number of entries in a packed write command
+*  (MAX_PACKED_WRITES [501] of the EXTCSD register).
+*
+* \param *extCsd
+*     The pointer to the EXTCSD register read by \ref Cy_SD_Host_GetExtCsd.
+*
+* \return uint32_t
+*     The maximum number of the packed write entries, limited by
+*     \ref CY_SD_HOST_PACKED_MAX_ENTRIES. Zero if packed commands are not
+*     supported.
+*
+*******************************************************************************/
+uint32_t Cy_SD_Host_eMMC_GetMaxPackedWrites(uint32_t const *extCsd)
+{
+    uint32_t maxPackedWrites;
+
+    maxPackedWrites = (extCsd[CY_SD_HOST_EXTCSD_MAX_PACKED_WRITES] >> CY_SD_HOST_EXTCSD_MAX_PACKED_WRITES_POS) &
+                      CY_SD_HOST_EXTCSD_MAX_PACKED_WRITES_MSK;
+
+    return ((CY_SD_HOST_PACKED_MAX_ENTRIES < maxPackedWrites) ? CY_SD_HOST_PACKED_MAX_ENTRIES : maxPackedWrites);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SD_Host_GetRca
 ****************************************************************************//**
@@ -3596,10 +4730,15 @@ cy_en_sd_host_status_t Cy_SD_Host_GetScr(SDHC_Type *base,
 * \param *base
 *     The SD host registers structure pointer.
 *
+* \return bool
+*     true - a CRC or tuning error was reset in the tuned mode, the sampling
+*     clock must be tuned again.
+*
 *******************************************************************************/
-static void Cy_SD_Host_ErrorReset(SDHC_Type *base)
+static bool Cy_SD_Host_ErrorReset(SDHC_Type *base)
 {
     uint32_t intError; /* The error events mask. */
+    bool     retune = false;
 
     intError = Cy_SD_Host_GetErrorInterruptStatus(base);
 
@@ -3610,7 +4749,71 @@ static void Cy_SD_Host_ErrorReset(SDHC_Type *base)
         Cy_SD_Host_ClearErrorInterruptStatus(base, intError);
 
         Cy_SD_Host_SoftwareReset(base, CY_SD_HOST_RESET_CMD_LINE);
+
+        /* The CRC and tuning errors in the tuned mode mean that
+        * the sampling point drifted. The tuning is executed later by
+        * Cy_SD_Host_Retune(), when the card is ready for it.
+        */
+        if (Cy_SD_Host_IsRetuneError(base, intError))
+        {
+            Cy_SD_Host_SoftwareReset(base, CY_SD_HOST_RESET_DATALINE);
+            retune = true;
+        }
+    }
+
+    return retune;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_GetInstance
+****************************************************************************//**
+*
+*  Returns the index of the SD host instance.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \return uint32_t
+*     The index of the instance, 0 for SDHC0.
+*
+*******************************************************************************/
+static uint32_t Cy_SD_Host_GetInstance(SDHC_Type const *base)
+{
+    uint32_t instance = 0UL;
+
+#if defined(SDHC1)
+    if (SDHC1 == base)
+    {
+        instance = 1UL;
     }
+#endif /* SDHC1 */
+
+    return instance;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_IsRetuneError
+****************************************************************************//**
+*
+*  Checks whether the error events require the sampling clock tuning again:
+*  a CRC or tuning error while the tuned sampling clock is in use.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \param intError
+*     The error events mask.
+*
+* \return bool
+*     true - the tuning is required.
+*
+*******************************************************************************/
+static bool Cy_SD_Host_IsRetuneError(SDHC_Type const *base, uint32_t intError)
+{
+    return ((0UL != (intError & (CY_SD_HOST_CMD_CRC_ERR | CY_SD_HOST_DATA_CRC_ERR | CY_SD_HOST_TUNING_ERR))) &&
+            (true == _FLD2BOOL(SDHC_CORE_HOST_CTRL2_R_SAMPLE_CLK_SEL, SDHC_CORE_HOST_CTRL2_R(base))));
 }
 
 
@@ -3706,7 +4909,7 @@ __STATIC_INLINE bool Cy_SD_Host_VoltageCheck(SDHC_Type *base)
     if (CY_SD_HOST_SUCCESS != ret)   /* The Idle state. */
     {
         /* Reset the error and the CMD line for the case of the SDIO card. */
-        Cy_SD_Host_ErrorReset(base);
+        (void)Cy_SD_Host_ErrorReset(base);
         Cy_SD_Host_NormalReset(base);
     }
 
@@ -3812,7 +5015,7 @@ __STATIC_INLINE cy_en_sd_host_status_t Cy_SD_Host_IoOcr(SDHC_Type *base,
         Cy_SD_Host_SoftwareReset(base, CY_SD_HOST_RESET_DATALINE);
 
         /* IO = 0. We have the SD memory card. Reset errors. */
-        Cy_SD_Host_ErrorReset(base);
+        (void)Cy_SD_Host_ErrorReset(base);
 
     }
 
@@ -4161,6 +5364,10 @@ cy_en_sd_host_status_t Cy_SD_Host_SetHostSpeedMode(SDHC_Type *base,
             case CY_SD_HOST_BUS_SPEED_SDR50:
                 ultraHighSpeed = CY_SD_HOST_SDR50_SPEED; /* Max clock = 100 MHz */
                 break;
+            case CY_SD_HOST_BUS_SPEED_SDR104:
+            case CY_SD_HOST_BUS_SPEED_EMMC_HS200:
+                ultraHighSpeed = CY_SD_HOST_SDR104_SPEED; /* Max clock = 208 MHz */
+                break;
             default:
                 ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
                 break;
@@ -4186,6 +5393,166 @@ cy_en_sd_host_status_t Cy_SD_Host_SetHostSpeedMode(SDHC_Type *base,
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SD_Host_ExecuteTuning
+****************************************************************************//**
+*
+*  Executes the sampling clock tuning required for the SDR104 and HS200 modes
+*  (and for SDR50 if the Use Tuning for SDR50 capability is set). Call this
+*  function after the bus speed mode and the SD clock frequency are changed.
+*  The card must be in the transfer state.
+*
+*  The function sends the tuning block command (CMD19 for SD, CMD21 for eMMC)
+*  up to 40 times while the SD host searches the sampling point. If the tuning
+*  fails, the fixed sampling clock is used.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_ExecuteTuning(SDHC_Type *base)
+{
+    cy_en_sd_host_status_t      ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    cy_stc_sd_host_cmd_config_t cmd;
+    uint32_t                    blockSize = CY_SD_HOST_TUNING_BLOCK_SIZE;
+    uint32_t                    retry = CY_SD_HOST_TUNING_RETRY;
+
+    if (NULL != base)
+    {
+        if (true == _FLD2BOOL(SDHC_CORE_HOST_CTRL1_R_EXT_DAT_XFER, SDHC_CORE_HOST_CTRL1_R(base)))
+        {
+            blockSize = CY_SD_HOST_TUNING_BLOCK_SIZE_8BIT;
+        }
+
+        cmd.commandIndex    = (true == _FLD2BOOL(SDHC_CORE_EMMC_CTRL_R_CARD_IS_EMMC, SDHC_CORE_EMMC_CTRL_R(base))) ?
+                              CY_SD_HOST_MMC_CMD21 : CY_SD_HOST_SD_CMD19;
+        cmd.commandArgument = 0UL;
+        cmd.dataPresent     = true;
+        cmd.enableAutoResponseErrorCheck = false;
+        cmd.respType        = CY_SD_HOST_RESPONSE_LEN_48;
+        cmd.enableCrcCheck  = true;
+        cmd.enableIdxCheck  = true;
+        cmd.cmdType         = CY_SD_HOST_CMD_NORMAL;
+
+        /* Start the tuning with the fixed sampling clock. */
+        SDHC_CORE_HOST_CTRL2_R(base) = (uint16_t)((SDHC_CORE_HOST_CTRL2_R(base) &
+                                                   (uint16_t)~SDHC_CORE_HOST_CTRL2_R_SAMPLE_CLK_SEL_Msk) |
+                                                  SDHC_CORE_HOST_CTRL2_R_EXEC_TUNING_Msk);
+
+        ret = CY_SD_HOST_SUCCESS;
+
+        while ((CY_SD_HOST_SUCCESS == ret) &&
+               (true == _FLD2BOOL(SDHC_CORE_HOST_CTRL2_R_EXEC_TUNING, SDHC_CORE_HOST_CTRL2_R(base))))
+        {
+            if (0UL == retry)
+            {
+                ret = CY_SD_HOST_ERROR_TIMEOUT;
+                break;
+            }
+            retry--;
+
+            /* The tuning block read. */
+            SDHC_CORE_BLOCKSIZE_R(base) = (uint16_t)_VAL2FLD(SDHC_CORE_BLOCKSIZE_R_XFER_BLOCK_SIZE, blockSize);
+            SDHC_CORE_XFER_MODE_R(base) = (uint16_t)_BOOL2FLD(SDHC_CORE_XFER_MODE_R_DATA_XFER_DIR, true);
+
+            ret = Cy_SD_Host_SendCommand(base, &cmd);
+
+            if (CY_SD_HOST_SUCCESS == ret)
+            {
+                /* The SD host reads the tuning block itself. */
+                ret = Cy_SD_Host_PollBufferReadReady(base);
+            }
+
+            Cy_SD_Host_ClearNormalInterruptStatus(base, CY_SD_HOST_CMD_COMPLETE);
+        }
+
+        if ((CY_SD_HOST_SUCCESS == ret) &&
+            (false == _FLD2BOOL(SDHC_CORE_HOST_CTRL2_R_SAMPLE_CLK_SEL, SDHC_CORE_HOST_CTRL2_R(base))))
+        {
+            /* The SD host did not find the sampling point. */
+            ret = CY_SD_HOST_ERROR;
+        }
+
+        if (CY_SD_HOST_SUCCESS != ret)
+        {
+            /* Abort the tuning and use the fixed sampling clock. */
+            SDHC_CORE_HOST_CTRL2_R(base) = (uint16_t)(SDHC_CORE_HOST_CTRL2_R(base) &
+                                                      (uint16_t)~(SDHC_CORE_HOST_CTRL2_R_EXEC_TUNING_Msk |
+                                                                  SDHC_CORE_HOST_CTRL2_R_SAMPLE_CLK_SEL_Msk));
+
+            Cy_SD_Host_SoftwareReset(base, CY_SD_HOST_RESET_CMD_LINE);
+            Cy_SD_Host_SoftwareReset(base, CY_SD_HOST_RESET_DATALINE);
+        }
+    }
+
+    return ret;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SD_Host_Retune
+****************************************************************************//**
+*
+*  Executes the sampling clock tuning again after \ref Cy_SD_Host_AbortTransfer
+*  detected a CRC or tuning error in the tuned mode. Does nothing if the
+*  tuning is not required. Call this function from the thread context before
+*  the next transfer.
+*
+*  The tuning is executed only when the card released the DAT0 line and
+*  is in the transfer state. Otherwise, the function returns
+*  \ref CY_SD_HOST_ERROR_OPERATION_IN_PROGRESS and must be called again.
+*
+* \param *base
+*     The SD host registers structure pointer.
+*
+* \param context
+* The pointer to the context structure \ref cy_stc_sd_host_context_t allocated
+* by the user. The structure is used during the SD host operation for internal
+* configuration and data retention. The user must not modify anything
+* in this structure.
+*
+* \return \ref cy_en_sd_host_status_t
+*
+*******************************************************************************/
+cy_en_sd_host_status_t Cy_SD_Host_Retune(SDHC_Type *base,
+                                         cy_stc_sd_host_context_t *context)
+{
+    cy_en_sd_host_status_t ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
+    uint32_t               cardStatus;
+
+    if ((NULL != base) && (NULL != context))
+    {
+        ret = CY_SD_HOST_SUCCESS;
+
+        if (cy_sd_host_retuneNeeded[Cy_SD_Host_GetInstance(base)])
+        {
+            ret = CY_SD_HOST_ERROR_OPERATION_IN_PROGRESS;
+
+            /* The card holds DAT0 low while it is busy. */
+            if (0UL != (Cy_SD_Host_GetPresentState(base) & (1UL << SDHC_CORE_PSTATE_REG_DAT_3_0_Pos)))
+            {
+                cardStatus = Cy_SD_Host_GetCardStatus(base, context);
+
+                if ((CY_SD_HOST_CARD_TRAN << CY_SD_HOST_CMD13_CURRENT_STATE) ==
+                    (cardStatus & CY_SD_HOST_CMD13_CURRENT_STATE_MSK))
+                {
+                    ret = Cy_SD_Host_ExecuteTuning(base);
+
+                    if (CY_SD_HOST_SUCCESS == ret)
+                    {
+                        cy_sd_host_retuneNeeded[Cy_SD_Host_GetInstance(base)] = false;
+                    }
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SD_Host_SetBusSpeedMode
 ****************************************************************************//**
@@ -4246,6 +5613,14 @@ cy_en_sd_host_status_t Cy_SD_Host_SetBusSpeedMode(SDHC_Type *base,
                 case CY_SD_HOST_BUS_SPEED_SDR50:
                     highSpeedValue = CY_SD_HOST_SDR50_SPEED; /* Max clock = 100 MHz */
                     break;
+                case CY_SD_HOST_BUS_SPEED_SDR104:
+                    /* The eMMC has no SDR104, the same clock is HS200 */
+                    highSpeedValue = (CY_SD_HOST_EMMC == context->cardType) ?
+                                     CY_SD_HOST_EMMC_HS200_TIMING : CY_SD_HOST_SDR104_SPEED; /* Max clock = 208 MHz */
+                    break;
+                case CY_SD_HOST_BUS_SPEED_EMMC_HS200:
+                    highSpeedValue = CY_SD_HOST_EMMC_HS200_TIMING; /* Max clock = 200 MHz */
+                    break;
                 default:
                     ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
                     break;
@@ -4305,6 +5680,9 @@ cy_en_sd_host_status_t Cy_SD_Host_SetBusSpeedMode(SDHC_Type *base,
                     case CY_SD_HOST_BUS_SPEED_SDR50:
                         response[0] |= CY_SD_HOST_CCCR_SPEED_BSS1_MASK;
                         break;
+                    case CY_SD_HOST_BUS_SPEED_SDR104:
+                        response[0] |= CY_SD_HOST_CCCR_SPEED_BSS0_MASK | CY_SD_HOST_CCCR_SPEED_BSS1_MASK;
+                        break;
                     default:
                         ret = CY_SD_HOST_ERROR_INVALID_PARAMETER;
                         break;
@@ -4315,6 +5693,7 @@ cy_en_sd_host_status_t Cy_SD_Host_SetBusSpeedMode(SDHC_Type *base,
                 {
                     highSpeedValue = response[0] & (CY_SD_HOST_CCCR_SPEED_BSS0_MASK |
                                              CY_SD_HOST_CCCR_SPEED_BSS1_MASK |
+                                             CY_SD_HOST_CCCR_SPEED_BSS2_MASK |
                                              CY_SD_HOST_CCCR_SPEED_SHS_MASK);
 
                     ret = Cy_SD_Host_OpsSendIoRwDirectCmd(base,
@@ -4328,6 +5707,7 @@ cy_en_sd_host_status_t Cy_SD_Host_SetBusSpeedMode(SDHC_Type *base,
 
                     response[0] = response[0] & (CY_SD_HOST_CCCR_SPEED_BSS0_MASK |
                                    CY_SD_HOST_CCCR_SPEED_BSS1_MASK |
+                                   CY_SD_HOST_CCCR_SPEED_BSS2_MASK |
                                    CY_SD_HOST_CCCR_SPEED_SHS_MASK);
 
                     if(highSpeedValue != response[0])
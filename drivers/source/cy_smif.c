@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_smif.c
-* \version 1.50.1
+* \version 1.60
 *
 * \brief
 *  This file provides the source code for the SMIF driver APIs.
@@ -33,6 +33,21 @@
 extern "C" {
 #endif
 
+#if defined(CY_IP_M4CPUSS_DMA)
+#define DMA_BYTES_IN_WORD       (4UL)
+#define DMA_RX_TRIGGER_LEVEL    (3UL)   /* The RX trigger is active when at least one word is received */
+#define DMA_TX_TRIGGER_LEVEL    (4UL)   /* The TX trigger is active when at least one word is free */
+#define DMA_RX_TRIGGER_LEVEL_BYTE   (0UL)   /* The RX trigger is active when at least one byte is received */
+#define DMA_TX_TRIGGER_LEVEL_BYTE   (7UL)   /* The TX trigger is active when at least one byte is free */
+#define DMA_WORD_ALIGNED(value) (0UL == ((value) & (DMA_BYTES_IN_WORD - 1UL)))
+
+static void DmaSetDescriptors(cy_stc_smif_dma_t *dma, void const *fifo,
+                              uint8_t const *buffer, uint32_t size, bool isRx, bool isWord);
+#endif /* CY_IP_M4CPUSS_DMA */
+
+/* The XIP cache statistics registered by Cy_SMIF_CacheStatsInit() */
+static cy_stc_smif_cache_stats_t *smifCacheStats = NULL;
+
 
 /*******************************************************************************
 * Function Name: Cy_SMIF_Init
@@ -1196,10 +1211,646 @@ cy_en_smif_status_t Cy_SMIF_CacheInvalidate(SMIF_Type *base,
             status = CY_SMIF_BAD_PARAM;
             break;
     }
+
+    if ((CY_SMIF_SUCCESS == status) && (NULL != smifCacheStats))
+    {
+        smifCacheStats->invalidations++;
+    }
+    return (status);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_CacheInvalidateRange
+****************************************************************************//**
+*
+* This function is used to invalidate the fast cache, the slow cache or both
+* after the external memory range was modified in the MMIO mode.
+*
+* The SMIF caches do not support the invalidation of the individual cache
+* lines. The function invalidates the whole cache when the range overlaps the
+* XIP memory region of any enabled device, and does nothing otherwise. This
+* keeps the cached code when the memory that is not executed in place (for
+* example, a firmware update slot or a data storage) is modified.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param cacheType
+* Holds the type of the cache to be modified. \ref cy_en_smif_cache_t
+*
+* \param address
+* The start address of the modified range in the XIP memory space
+* (the device base address \ref cy_stc_smif_mem_config_t::baseAddress plus
+* the offset in the memory).
+*
+* \param size
+* The size of the modified range in bytes.
+*
+* \return A status of function completion.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_CacheInvalidateRange(SMIF_Type *base,
+                                            cy_en_smif_cache_t cacheType,
+                                            uint32_t address, uint32_t size)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+    uint32_t endAddress = address + (size - 1UL);
+    uint32_t regionStart;
+    uint32_t regionEnd;
+    uint32_t idx;
+    bool isMapped = false;
+
+    /* Check for the empty range and the address overflow */
+    if ((0UL != size) && (endAddress >= address))
+    {
+        for(idx = 0UL; (idx < SMIF_DEVICE_NR) && (!isMapped); idx++)
+        {
+            if (0UL != (SMIF_DEVICE_IDX_CTL(base, idx) & SMIF_DEVICE_CTL_ENABLED_Msk))
+            {
+                regionStart = SMIF_DEVICE_IDX_ADDR(base, idx) & SMIF_DEVICE_ADDR_ADDR_Msk;
+                regionEnd   = regionStart | (~(SMIF_DEVICE_IDX_MASK(base, idx) & SMIF_DEVICE_MASK_MASK_Msk));
+
+                isMapped = ((address <= regionEnd) && (endAddress >= regionStart));
+            }
+        }
+
+        if (isMapped)
+        {
+            status = Cy_SMIF_CacheInvalidate(base, cacheType);
+        }
+        else if ((CY_SMIF_CACHE_SLOW == cacheType) ||
+                 (CY_SMIF_CACHE_FAST == cacheType) ||
+                 (CY_SMIF_CACHE_BOTH == cacheType))
+        {
+            status = CY_SMIF_SUCCESS;
+
+            if (NULL != smifCacheStats)
+            {
+                smifCacheStats->invalidationsSkipped++;
+            }
+        }
+        else
+        {
+            /* A user error */
+        }
+    }
+    return (status);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_CacheStatsInit
+****************************************************************************//**
+*
+* Clears and registers the structure where the driver collects the XIP cache
+* statistics. The driver counts the cache invalidations in software; the SPI
+* transfer and the busy cycle counts are collected by the Energy Profiler after
+* \ref Cy_SMIF_CacheStatsStart is called.
+*
+* \param stats
+* The pointer to the statistics structure. The structure must be allocated by
+* the user and must be kept while the statistics are collected. Pass NULL to
+* stop collecting the statistics. Call \ref Cy_SMIF_CacheStatsStop before
+* unregistering the structure if the profiler counters are in use.
+*
+*******************************************************************************/
+void Cy_SMIF_CacheStatsInit(cy_stc_smif_cache_stats_t *stats)
+{
+    if (NULL != stats)
+    {
+        stats->invalidations = 0UL;
+        stats->invalidationsSkipped = 0UL;
+        stats->transfers = 0ULL;
+        stats->busyCycles = 0ULL;
+    #if defined(CY_IP_MXPROFILE)
+        stats->transferCtr = NULL;
+        stats->busyCtr = NULL;
+    #endif /* CY_IP_MXPROFILE */
+    }
+
+    smifCacheStats = stats;
+}
+
+
+#if defined(CY_IP_MXPROFILE)
+/*******************************************************************************
+* Function Name: Cy_SMIF_CacheStatsStart
+****************************************************************************//**
+*
+* Assigns two Energy Profiler counters to the slave select monitor: one counts
+* the SPI transfers and the other counts the clk_hf cycles the slave select is
+* active. In XIP mode every transfer is a cache line fill or a prefetch, so the
+* transfer count estimates the cache misses, and the busy cycles estimate the
+* time the CPUs wait for the external memory.
+*
+* The profiler must be initialized with \ref Cy_Profile_Init and started
+* with \ref Cy_Profile_StartProfiling by the user. The statistics structure
+* must be registered with \ref Cy_SMIF_CacheStatsInit.
+*
+* \param monitor
+* The SMIF profiler monitor, for example SMIF_MONITOR_SMIF_SPI_SELECT0 for the
+* memory on slave select 0 or SMIF_MONITOR_SMIF_SPI_SELECT_ANY for all
+* memories.
+*
+* \return A status of function completion.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM - the statistics are not registered, already
+*         started or no free profiler counters are available.
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_CacheStatsStart(en_ep_mon_sel_t monitor)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != smifCacheStats);
+
+    if ((NULL != smifCacheStats) && (NULL == smifCacheStats->transferCtr))
+    {
+        smifCacheStats->transferCtr = Cy_Profile_ConfigureCounter(monitor, CY_PROFILE_EVENT,
+                                                                  CY_PROFILE_CLK_HF, 1UL);
+        smifCacheStats->busyCtr = Cy_Profile_ConfigureCounter(monitor, CY_PROFILE_DURATION,
+                                                              CY_PROFILE_CLK_HF, 1UL);
+
+        if ((NULL != smifCacheStats->transferCtr) && (NULL != smifCacheStats->busyCtr))
+        {
+            (void)Cy_Profile_EnableCounter(smifCacheStats->transferCtr);
+            (void)Cy_Profile_EnableCounter(smifCacheStats->busyCtr);
+            status = CY_SMIF_SUCCESS;
+        }
+        else
+        {
+            /* Release the counter that has been assigned */
+            Cy_SMIF_CacheStatsStop();
+        }
+    }
     return (status);
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SMIF_CacheStatsUpdate
+****************************************************************************//**
+*
+* Reads the profiler counters into the transfers and busyCycles fields of the
+* registered statistics structure. The profiler counts are cumulative since
+* the last \ref Cy_Profile_ClearCounters call.
+*
+*******************************************************************************/
+void Cy_SMIF_CacheStatsUpdate(void)
+{
+    if ((NULL != smifCacheStats) && (NULL != smifCacheStats->transferCtr))
+    {
+        (void)Cy_Profile_GetRawCount(smifCacheStats->transferCtr, &smifCacheStats->transfers);
+        (void)Cy_Profile_GetRawCount(smifCacheStats->busyCtr, &smifCacheStats->busyCycles);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_CacheStatsStop
+****************************************************************************//**
+*
+* Disables and frees the profiler counters assigned by
+* \ref Cy_SMIF_CacheStatsStart. The collected values remain in the statistics
+* structure.
+*
+*******************************************************************************/
+void Cy_SMIF_CacheStatsStop(void)
+{
+    if (NULL != smifCacheStats)
+    {
+        if (NULL != smifCacheStats->transferCtr)
+        {
+            (void)Cy_Profile_DisableCounter(smifCacheStats->transferCtr);
+            (void)Cy_Profile_FreeCounter(smifCacheStats->transferCtr);
+            smifCacheStats->transferCtr = NULL;
+        }
+
+        if (NULL != smifCacheStats->busyCtr)
+        {
+            (void)Cy_Profile_DisableCounter(smifCacheStats->busyCtr);
+            (void)Cy_Profile_FreeCounter(smifCacheStats->busyCtr);
+            smifCacheStats->busyCtr = NULL;
+        }
+    }
+}
+#endif /* CY_IP_MXPROFILE */
+
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SMIF_DmaInit
+****************************************************************************//**
+*
+* Initializes the DW channels which move the data between the SMIF data FIFOs
+* and the memory buffers for \ref Cy_SMIF_ReceiveDataDma and
+* \ref Cy_SMIF_TransmitDataDma, unmasks the channel interrupts and enables
+* the DW block.
+*
+* The RX channel moves one word from the RX FIFO when at least four bytes are
+* received, and the TX channel moves one word to the TX FIFO when at least four
+* bytes are free. When the buffer or the size is not word-aligned, the channels
+* move one byte per trigger instead. The interrupts of both channels are raised
+* at the end of the transfer and must call \ref Cy_SMIF_DmaInterrupt.
+*
+* \param dma
+* The DMA configuration \ref cy_stc_smif_dma_t allocated by the user in SRAM.
+* The dwBase, rxChannel, txChannel and priority fields must be set.
+*
+* \return A status of the initialization.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_DmaInit(cy_stc_smif_dma_t *dma)
+{
+    cy_en_smif_status_t result = CY_SMIF_BAD_PARAM;
+    cy_stc_dma_channel_config_t channelConfig;
+
+    CY_ASSERT_L1(NULL != dma);
+
+    if ((NULL != dma->dwBase) && (dma->rxChannel != dma->txChannel))
+    {
+        channelConfig.descriptor  = &dma->descriptor[0U];
+        channelConfig.preemptable = false;
+        channelConfig.priority    = dma->priority;
+        channelConfig.enable      = false;
+        channelConfig.bufferable  = false;
+
+        if ((CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->rxChannel, &channelConfig)) &&
+            (CY_DMA_SUCCESS == Cy_DMA_Channel_Init(dma->dwBase, dma->txChannel, &channelConfig)))
+        {
+            Cy_DMA_Channel_SetInterruptMask(dma->dwBase, dma->rxChannel, CY_DMA_INTR_MASK);
+            Cy_DMA_Channel_SetInterruptMask(dma->dwBase, dma->txChannel, CY_DMA_INTR_MASK);
+            Cy_DMA_Enable(dma->dwBase);
+
+            result = CY_SMIF_SUCCESS;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_ReceiveDataDma
+****************************************************************************//**
+*
+* This function implements the receive data phase in the memory command like
+* \ref Cy_SMIF_ReceiveData, but the data is moved from the RX Data FIFO to the
+* rxBuffer by the DMA. The CPU is not involved until the end of the reception,
+* when \ref Cy_SMIF_DmaInterrupt calls the RxCompleteCb.
+*
+* \note This function is to be preceded by \ref Cy_SMIF_TransmitCommand. The
+* slave select is de-asserted at the end of the receive. The DMA moves full
+* words when rxBuffer and size are aligned to four bytes, otherwise it moves
+* single bytes, which takes more DW transfers.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param rxBuffer
+* The pointer to the variable where the receive data is stored.
+*
+* \param size
+* The size of data to be received. Must be > 0 and not greater than 65536.
+*
+* \param transferWidth
+* The width of transfer \ref cy_en_smif_txfr_width_t.
+*
+* \param RxCompleteCb
+* The callback executed at the end of a reception. NULL interpreted as no
+* callback.
+*
+* \param dma
+* The DMA configuration initialized by \ref Cy_SMIF_DmaInit.
+*
+* \param context
+* Passes a configuration structure that contains the transfer parameters of the
+* SMIF block.
+*
+* \return A status of a reception.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_CMD_FIFO_FULL
+*       - \ref CY_SMIF_BAD_PARAM
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_ReceiveDataDma(SMIF_Type *base,
+                            uint8_t *rxBuffer,
+                            uint32_t size,
+                            cy_en_smif_txfr_width_t transferWidth,
+                            cy_smif_event_cb_t RxCompleteCb,
+                            cy_stc_smif_dma_t *dma,
+                            cy_stc_smif_context_t *context)
+{
+    /* The return variable */
+    cy_en_smif_status_t result = CY_SMIF_BAD_PARAM;
+    uint32_t transferStatus;
+
+    /* Check input values */
+    CY_ASSERT_L1(NULL != dma);
+    CY_ASSERT_L3(CY_SMIF_TXFR_WIDTH_VALID(transferWidth));
+
+    if ((NULL != rxBuffer) && CY_SMIF_BUF_SIZE_VALID(size))
+    {
+        bool isWord = DMA_WORD_ALIGNED(size) && DMA_WORD_ALIGNED((uint32_t)rxBuffer);
+
+        DmaSetDescriptors(dma, isWord ? (void const *)&SMIF_RX_DATA_FIFO_RD4(base) :
+                                        (void const *)&SMIF_RX_DATA_FIFO_RD1(base),
+                          rxBuffer, size, true, isWord);
+        Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->rxChannel, &dma->descriptor[0U]);
+
+        /* Move the parameters to the global variables before the transfer
+         * is started, as it may complete before this function returns.
+         */
+        transferStatus = context->transferStatus;
+        context->rxBufferAddress = rxBuffer;
+        context->rxBufferSize = size;
+        context->rxBufferCounter = size;
+        context->rxCompleteCb = RxCompleteCb;
+        context->transferStatus = (uint32_t) CY_SMIF_RX_BUSY;
+
+        /* Save the trigger level used by the interrupt-driven transfers */
+        dma->rxTriggerLevel = _FLD2VAL(SMIF_RX_DATA_FIFO_CTL_TRIGGER_LEVEL, SMIF_RX_DATA_FIFO_CTL(base));
+        Cy_SMIF_SetRxFifoTriggerLevel(base, isWord ? DMA_RX_TRIGGER_LEVEL : DMA_RX_TRIGGER_LEVEL_BYTE);
+        Cy_DMA_Channel_Enable(dma->dwBase, dma->rxChannel);
+
+        /* Enter the receiving mode without the TR_RX_REQ interrupt */
+        result = Cy_SMIF_ReceiveData(base, NULL, size, transferWidth, NULL, context);
+
+        if (CY_SMIF_SUCCESS != result)
+        {
+            Cy_DMA_Channel_Disable(dma->dwBase, dma->rxChannel);
+            Cy_SMIF_SetRxFifoTriggerLevel(base, dma->rxTriggerLevel);
+            context->transferStatus = transferStatus;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_TransmitDataDma
+****************************************************************************//**
+*
+* This function implements the transmit data phase in the memory command like
+* \ref Cy_SMIF_TransmitData, but the data is moved from the txBuffer to the
+* TX Data FIFO by the DMA. The CPU is not involved until the last word is
+* written into the FIFO, when \ref Cy_SMIF_DmaInterrupt calls the TxCompleteCb.
+*
+* \note This function is to be preceded by \ref Cy_SMIF_TransmitCommand where
+* the slave select is selected. The slave is de-asserted at the end of a
+* transmit. The DMA moves full words when txBuffer and size are aligned to
+* four bytes, otherwise it moves single bytes, which takes more DW transfers.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param txBuffer
+* The pointer to the data to be transferred.
+*
+* \param size
+* The size of txBuffer. Must be > 0 and not greater than 65536.
+*
+* \param transferWidth
+* The width of transfer \ref cy_en_smif_txfr_width_t.
+*
+* \param TxCompleteCb
+* The callback executed at the end of a transmission. NULL interpreted as no
+* callback.
+*
+* \param dma
+* The DMA configuration initialized by \ref Cy_SMIF_DmaInit.
+*
+* \param context
+* Passes a configuration structure that contains the transfer parameters of the
+* SMIF block.
+*
+* \return A status of a transmission.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_CMD_FIFO_FULL
+*       - \ref CY_SMIF_BAD_PARAM
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_TransmitDataDma(SMIF_Type *base,
+                            uint8_t const *txBuffer,
+                            uint32_t size,
+                            cy_en_smif_txfr_width_t transferWidth,
+                            cy_smif_event_cb_t TxCompleteCb,
+                            cy_stc_smif_dma_t *dma,
+                            cy_stc_smif_context_t *context)
+{
+    /* The return variable */
+    cy_en_smif_status_t result = CY_SMIF_BAD_PARAM;
+    uint32_t transferStatus;
+
+    /* Check input values */
+    CY_ASSERT_L1(NULL != dma);
+    CY_ASSERT_L3(CY_SMIF_TXFR_WIDTH_VALID(transferWidth));
+
+    if ((NULL != txBuffer) && CY_SMIF_BUF_SIZE_VALID(size))
+    {
+        bool isWord = DMA_WORD_ALIGNED(size) && DMA_WORD_ALIGNED((uint32_t)txBuffer);
+
+        DmaSetDescriptors(dma, isWord ? (void const *)&SMIF_TX_DATA_FIFO_WR4(base) :
+                                        (void const *)&SMIF_TX_DATA_FIFO_WR1(base),
+                          txBuffer, size, false, isWord);
+        Cy_DMA_Channel_SetDescriptor(dma->dwBase, dma->txChannel, &dma->descriptor[0U]);
+
+        /* Move the parameters to the global variables before the transfer
+         * is started, as it may complete before this function returns.
+         */
+        transferStatus = context->transferStatus;
+        context->txBufferAddress = txBuffer;
+        context->txBufferSize = size;
+        context->txBufferCounter = size;
+        context->txCompleteCb = TxCompleteCb;
+        context->transferStatus = (uint32_t) CY_SMIF_SEND_BUSY;
+
+        /* Save the trigger level used by the interrupt-driven transfers */
+        dma->txTriggerLevel = _FLD2VAL(SMIF_TX_DATA_FIFO_CTL_TRIGGER_LEVEL, SMIF_TX_DATA_FIFO_CTL(base));
+        Cy_SMIF_SetTxFifoTriggerLevel(base, isWord ? DMA_TX_TRIGGER_LEVEL : DMA_TX_TRIGGER_LEVEL_BYTE);
+        Cy_DMA_Channel_Enable(dma->dwBase, dma->txChannel);
+
+        /* Enter the transmitting mode without the TR_TX_REQ interrupt */
+        result = Cy_SMIF_TransmitData(base, NULL, size, transferWidth, NULL, context);
+
+        if (CY_SMIF_SUCCESS != result)
+        {
+            Cy_DMA_Channel_Disable(dma->dwBase, dma->txChannel);
+            Cy_SMIF_SetTxFifoTriggerLevel(base, dma->txTriggerLevel);
+            context->transferStatus = transferStatus;
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_DmaInterrupt
+****************************************************************************//**
+*
+* The DMA completion handler. It must be called from the interrupt handlers of
+* both DW channels of \ref cy_stc_smif_dma_t. It clears the channel interrupt,
+* restores the FIFO trigger levels saved when the transfer was started, updates the
+* transfer status and executes the RxCompleteCb or TxCompleteCb.
+*
+* The callback receives \ref CY_SMIF_RX_COMPLETE or \ref CY_SMIF_SEND_COMPLETE
+* on success, and \ref CY_SMIF_RX_ERROR or \ref CY_SMIF_TX_ERROR when the DW
+* channel reported an error. After an error, the memory command is not
+* completed, and the SMIF block must be re-initialized.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param dma
+* The DMA configuration initialized by \ref Cy_SMIF_DmaInit.
+*
+* \param context
+* Passes a configuration structure that contains the transfer parameters of the
+* SMIF block.
+*
+*******************************************************************************/
+void Cy_SMIF_DmaInterrupt(SMIF_Type *base, cy_stc_smif_dma_t const *dma,
+                            cy_stc_smif_context_t *context)
+{
+    uint32_t event;
+
+    CY_ASSERT_L1(NULL != dma);
+
+    if (0UL != Cy_DMA_Channel_GetInterruptStatus(dma->dwBase, dma->rxChannel))
+    {
+        event = (CY_DMA_INTR_CAUSE_COMPLETION == Cy_DMA_Channel_GetStatus(dma->dwBase, dma->rxChannel)) ?
+                (uint32_t) CY_SMIF_RX_COMPLETE : (uint32_t) CY_SMIF_RX_ERROR;
+
+        Cy_DMA_Channel_ClearInterrupt(dma->dwBase, dma->rxChannel);
+        Cy_DMA_Channel_Disable(dma->dwBase, dma->rxChannel);
+        Cy_SMIF_SetRxFifoTriggerLevel(base, dma->rxTriggerLevel);
+
+        context->rxBufferCounter = 0UL;
+        context->transferStatus = event;
+
+        if (NULL != context->rxCompleteCb)
+        {
+            context->rxCompleteCb(event);
+        }
+    }
+
+    if (0UL != Cy_DMA_Channel_GetInterruptStatus(dma->dwBase, dma->txChannel))
+    {
+        event = (CY_DMA_INTR_CAUSE_COMPLETION == Cy_DMA_Channel_GetStatus(dma->dwBase, dma->txChannel)) ?
+                (uint32_t) CY_SMIF_SEND_COMPLETE : (uint32_t) CY_SMIF_TX_ERROR;
+
+        Cy_DMA_Channel_ClearInterrupt(dma->dwBase, dma->txChannel);
+        Cy_DMA_Channel_Disable(dma->dwBase, dma->txChannel);
+        Cy_SMIF_SetTxFifoTriggerLevel(base, dma->txTriggerLevel);
+
+        context->txBufferCounter = 0UL;
+        context->transferStatus = event;
+
+        if (NULL != context->txCompleteCb)
+        {
+            context->txCompleteCb(event);
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: DmaSetDescriptors
+****************************************************************************//**
+*
+* Builds the descriptor chain which moves size bytes between the SMIF data
+* FIFO and the buffer one element (word or byte) per trigger. The first
+* descriptor moves the rows of 256 elements with a 2D transfer, and the second
+* one moves the remaining elements. Each descriptor is used only when it has
+* elements to move.
+*
+* \param dma
+* The DMA configuration.
+*
+* \param fifo
+* The address of the RX_DATA_FIFO_RD4 or TX_DATA_FIFO_WR4 register for the
+* words, or RX_DATA_FIFO_RD1 or TX_DATA_FIFO_WR1 register for the bytes.
+*
+* \param buffer
+* The buffer, word-aligned for the words.
+*
+* \param size
+* The number of bytes to move, a multiple of four for the words.
+*
+* \param isRx
+* True - the data is moved from the FIFO to the buffer, false - from the
+* buffer to the FIFO.
+*
+* \param isWord
+* True - the elements are words, false - bytes.
+*
+*******************************************************************************/
+static void DmaSetDescriptors(cy_stc_smif_dma_t *dma, void const *fifo,
+                              uint8_t const *buffer, uint32_t size, bool isRx, bool isWord)
+{
+    cy_stc_dma_descriptor_config_t descrConfig;
+    cy_stc_dma_descriptor_t *descriptor = &dma->descriptor[0U];
+    uint32_t elementSize = isWord ? DMA_BYTES_IN_WORD : 1UL;
+    uint32_t elements = size / elementSize;
+    uint32_t rows = elements / CY_DMA_LOOP_COUNT_MAX;
+    uint32_t rest = elements % CY_DMA_LOOP_COUNT_MAX;
+    uint32_t offset = 0UL;
+
+    descrConfig.retrigger       = CY_DMA_RETRIG_4CYC;
+    descrConfig.interruptType   = CY_DMA_DESCR_CHAIN;
+    descrConfig.triggerOutType  = CY_DMA_DESCR_CHAIN;
+    descrConfig.triggerInType   = CY_DMA_1ELEMENT;
+    descrConfig.dataSize        = isWord ? CY_DMA_WORD : CY_DMA_BYTE;
+    /* The FIFO registers are always accessed as words */
+    descrConfig.srcTransferSize = (isWord || isRx) ? CY_DMA_TRANSFER_SIZE_WORD : CY_DMA_TRANSFER_SIZE_DATA;
+    descrConfig.dstTransferSize = (isWord || !isRx) ? CY_DMA_TRANSFER_SIZE_WORD : CY_DMA_TRANSFER_SIZE_DATA;
+    descrConfig.srcAddress      = NULL;
+    descrConfig.dstAddress      = NULL;
+    /* The FIFO address is fixed, the buffer address is incremented */
+    descrConfig.srcXincrement   = isRx ? 0L : 1L;
+    descrConfig.dstXincrement   = isRx ? 1L : 0L;
+    descrConfig.srcYincrement   = isRx ? 0L : (int32_t)CY_DMA_LOOP_COUNT_MAX;
+    descrConfig.dstYincrement   = isRx ? (int32_t)CY_DMA_LOOP_COUNT_MAX : 0L;
+
+    if (0UL != rows)
+    {
+        descrConfig.descriptorType = CY_DMA_2D_TRANSFER;
+        descrConfig.xCount         = CY_DMA_LOOP_COUNT_MAX;
+        descrConfig.yCount         = rows;
+        descrConfig.channelState   = (0UL != rest) ? CY_DMA_CHANNEL_ENABLED : CY_DMA_CHANNEL_DISABLED;
+        descrConfig.nextDescriptor = (0UL != rest) ? &dma->descriptor[1U] : NULL;
+
+        (void)Cy_DMA_Descriptor_Init(descriptor, &descrConfig);
+        Cy_DMA_Descriptor_SetSrcAddress(descriptor, isRx ? fifo : (void const *)buffer);
+        Cy_DMA_Descriptor_SetDstAddress(descriptor, isRx ? (void const *)buffer : fifo);
+
+        descriptor = &dma->descriptor[1U];
+        offset = rows * CY_DMA_LOOP_COUNT_MAX * elementSize;
+    }
+
+    if (0UL != rest)
+    {
+        descrConfig.descriptorType = CY_DMA_1D_TRANSFER;
+        descrConfig.xCount         = rest;
+        descrConfig.yCount         = 1UL;
+        descrConfig.channelState   = CY_DMA_CHANNEL_DISABLED;
+        descrConfig.nextDescriptor = NULL;
+
+        (void)Cy_DMA_Descriptor_Init(descriptor, &descrConfig);
+        Cy_DMA_Descriptor_SetSrcAddress(descriptor, isRx ? fifo : (void const *)&buffer[offset]);
+        Cy_DMA_Descriptor_SetDstAddress(descriptor, isRx ? (void const *)&buffer[offset] : fifo);
+    }
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
 /*******************************************************************************
 * Function Name: Cy_SMIF_DeepSleepCallback
 ****************************************************************************//**
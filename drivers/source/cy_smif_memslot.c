@@ -1,6 +1,6 @@
 /***************************************************************************//**
 * \file cy_smif_memslot.c
-* \version 1.50.1
+* \version 1.60
 *
 * \brief
 *  This file provides the source code for the memory-level APIs of the SMIF driver.
@@ -39,6 +39,9 @@ extern "C" {
 ***************************************/
 
 #define READ_ENHANCED_MODE_DISABLED (0xFFU)
+#define CONTINUOUS_READ_MODE_A5     (0xA5U)  /* The mode byte that enters the continuous read mode: A5h */
+#define CONTINUOUS_READ_MODE_AX     (0xA0U)  /* The mode byte that enters the continuous read mode: Axh */
+#define CONTINUOUS_READ_EXIT        (0xFFU)  /* Fh on DQ0-DQ3 that exits the continuous read mode */
 #define BITS_IN_BYTE                (8U)
 #define BYTES_IN_DWORD              (4U)
 #define FOUR_BYTE_ADDRESS           (4U)     /* 4 byte addressing mode */
@@ -155,6 +158,23 @@ extern "C" {
 #define MEM_MAPPED_SIZE_VALID(size) (((size) >= 0x10000U) && (0U == ((size)&((size)-1U))) )
 #define MEM_ADDR_SIZE_VALID(addrSize)  ((0U < (addrSize)) && ((addrSize) <= CY_SMIF_FOUR_BYTES_ADDR))
 
+/* The states of the asynchronous write and erase operations */
+#define ASYNC_IDLE                  (0UL)    /* No write or erase is in progress */
+#define ASYNC_PROGRAM               (1UL)    /* The page data is transmitted */
+#define ASYNC_PROGRAM_WAIT          (2UL)    /* Polling the memory for the page program completion */
+#define ASYNC_ERASE_WAIT            (3UL)    /* Polling the memory for the sector erase completion */
+#define ASYNC_SUSPEND_WAIT          (4UL)    /* Polling the memory for the erase suspend completion */
+#define ASYNC_SUSPENDED             (5UL)    /* The erase is suspended, the read is in progress */
+#define ASYNC_PAUSED                (6UL)    /* The read is in progress between the pages or sectors */
+#define ASYNC_ERROR                 (7UL)    /* The DMA failed to transmit the page data */
+
+/* The states of the asynchronous read operation */
+#define ASYNC_READ_IDLE             (0UL)    /* No read is in progress */
+#define ASYNC_READ_PENDING          (1UL)    /* The read waits until the memory is available */
+#define ASYNC_READ_BUSY             (2UL)    /* The read chunk is received */
+#define ASYNC_READ_DONE             (3UL)    /* The read chunk is completed */
+#define ASYNC_READ_ERROR            (4UL)    /* The DMA failed to receive the read chunk */
+
 
 /***************************************
 *     Internal enums
@@ -203,6 +223,12 @@ typedef struct
 ***************************************/
 static void XipRegInit(SMIF_DEVICE_Type volatile *dev,
                             cy_stc_smif_mem_config_t const * memCfg);
+static void XipReadCmdInit(SMIF_DEVICE_Type volatile *dev, cy_stc_smif_mem_cmd_t const *read,
+                           uint32_t continuousReadMode);
+static cy_en_smif_status_t LeaveContinuousRead(SMIF_Type *base, cy_stc_smif_mem_config_t const *memConfig,
+                                               cy_stc_smif_context_t const *context);
+static void SfdpGetContinuousReadMode(cy_stc_smif_mem_device_cfg_t *device,
+                                      uint8_t const sfdpBuffer[], uint32_t tableLength);
 static cy_en_smif_status_t SfdpReadBuffer(SMIF_Type *base, 
                                          cy_stc_smif_mem_cmd_t const *cmdSfdp,
                                          uint8_t const sfdpAddress[],
@@ -265,10 +291,38 @@ static cy_en_smif_status_t SfdpPopulateRegionInfo(SMIF_Type *base, uint8_t const
                                     cy_en_smif_slave_select_t slaveSelect, const cy_stc_smif_context_t *context,
                                     cy_stc_smif_erase_type_t eraseType[]);
 static void SfdpSetWipStatusRegisterCommand(cy_stc_smif_mem_cmd_t* readStsRegWipCmd);
+static void SfdpGetEraseSuspendParameters(cy_stc_smif_mem_device_cfg_t *device,
+                                          uint8_t const sfdpBuffer[], uint32_t tableLength);
+static cy_en_smif_status_t TransmitMemCmd(SMIF_Type *base, cy_stc_smif_mem_cmd_t const *cmd,
+                                          uint8_t const *addr, uint32_t addrSize,
+                                          cy_en_smif_slave_select_t slaveSelect,
+                                          cy_stc_smif_context_t const *context);
 static cy_en_smif_status_t PollTransferStatus(SMIF_Type const *base, cy_en_smif_txfr_status_t transferStatus,
                                               cy_stc_smif_context_t const *context);
+static void SfdpSetEraseTypes(cy_stc_smif_mem_device_cfg_t *device, uint8_t const sfdpBuffer[],
+                              cy_stc_smif_erase_type_t const eraseType[]);
+static cy_en_smif_status_t TransmitEraseCmd(SMIF_Type *base, cy_stc_smif_mem_config_t const *memDevice,
+                                            uint32_t command, uint8_t const *addr,
+                                            cy_stc_smif_context_t const *context);
 static void ValueToByteArray(uint32_t value, uint8_t *byteArray, uint32_t startPos, uint32_t size);
 static uint32_t ByteArrayToValue(uint8_t const *byteArray, uint32_t size);
+static cy_en_smif_status_t AsyncStep(cy_stc_smif_mem_async_t *async);
+static cy_en_smif_status_t AsyncReadStep(cy_stc_smif_mem_async_t *async);
+static cy_en_smif_status_t AsyncSendCommand(cy_stc_smif_mem_async_t const *async, uint32_t command);
+static void AsyncComplete(cy_stc_smif_mem_async_t *async, cy_en_smif_status_t status);
+#if defined(CY_IP_M4CPUSS_DMA)
+static bool AsyncDmaChunk(cy_stc_smif_mem_async_t const *async, uint32_t bufferAddress, uint32_t *chunk);
+static cy_en_smif_status_t AsyncDmaRead(cy_stc_smif_mem_async_t const *async, uint8_t const *addr,
+                                        uint8_t *rxBuffer, uint32_t size);
+static cy_en_smif_status_t AsyncDmaProgram(cy_stc_smif_mem_async_t const *async, uint8_t const *addr,
+                                           uint8_t const *txBuffer, uint32_t size);
+#endif /* CY_IP_M4CPUSS_DMA */
+static void AsyncPollTimeout(cy_stc_smif_mem_async_t *async);
+static void AsyncTxComplete(uint32_t event);
+static void AsyncRxComplete(uint32_t event);
+
+/* The asynchronous operations context used by the SMIF interrupt callbacks */
+static cy_stc_smif_mem_async_t *memAsync = NULL;
 
 /*******************************************************************************
 * Function Name: Cy_SMIF_MemInit
@@ -295,6 +349,12 @@ static uint32_t ByteArrayToValue(uint8_t const *byteArray, uint32_t size);
 * \note 4-byte addressing mode is set when the memory device supports 
 *       3- or 4-byte addressing mode.
 *
+* \note When \ref CY_SMIF_FLAG_CONTINUOUS_READ is set and the quad mode of the
+*       memory is enabled, the memory enters the continuous read mode (see
+*       \ref Cy_SMIF_MemEnterContinuousRead). Otherwise, enable the quad mode
+*       with \ref Cy_SMIF_MemEnableQuadMode and then call
+*       \ref Cy_SMIF_MemEnterContinuousRead.
+*
 * \param base
 * The address of the slave-slot device register to initialize.
 *
@@ -382,6 +442,29 @@ cy_en_smif_status_t Cy_SMIF_MemInit(SMIF_Type *base,
                                       (memCfg->flags & CY_SMIF_FLAG_CRYPTO_ENABLE) |
                                       _VAL2FLD(SMIF_DEVICE_CTL_DATA_SEL,  (uint32_t)memCfg->dataSelect) |
                                       SMIF_DEVICE_CTL_ENABLED_Msk;
+
+                        if ((0U != (memCfg->flags & CY_SMIF_FLAG_CONTINUOUS_READ)) &&
+                            (0UL != memCfg->deviceCfg->continuousReadMode))
+                        {
+                            /* The continuous read mode requires the quad mode */
+                            bool isQuadEnabled = true;
+                            cy_en_smif_status_t crStatus = CY_SMIF_SUCCESS;
+
+                            if (NULL != memCfg->deviceCfg->readStsRegQeCmd)
+                            {
+                                crStatus = Cy_SMIF_MemIsQuadEnabled(base, memCfg, &isQuadEnabled, context);
+                            }
+
+                            if ((CY_SMIF_SUCCESS == crStatus) && isQuadEnabled)
+                            {
+                                crStatus = Cy_SMIF_MemEnterContinuousRead(base, memCfg, context);
+                            }
+
+                            if (CY_SMIF_SUCCESS != crStatus)
+                            {
+                                result = (uint32_t)crStatus;
+                            }
+                        }
                     }
                 }
                 else
@@ -432,20 +515,10 @@ static void XipRegInit(SMIF_DEVICE_Type volatile *dev, cy_stc_smif_mem_config_t
 
     if(NULL != read)
     {
-        SMIF_DEVICE_RD_CMD_CTL(dev) = (CY_SMIF_NO_COMMAND_OR_MODE != read->command) ?
-                                    (_VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_CODE,  (uint32_t)read->command)  |
-                                    _VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_WIDTH, (uint32_t)read->cmdWidth) |
-                                    SMIF_DEVICE_RD_CMD_CTL_PRESENT_Msk)
-                                    : 0U;
+        XipReadCmdInit(dev, read, 0UL);
 
         SMIF_DEVICE_RD_ADDR_CTL(dev) = _VAL2FLD(SMIF_DEVICE_RD_ADDR_CTL_WIDTH, (uint32_t)read->addrWidth);
 
-        SMIF_DEVICE_RD_MODE_CTL(dev) = (CY_SMIF_NO_COMMAND_OR_MODE != read->mode) ?
-                                    (_VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_CODE,  (uint32_t)read->mode)     |
-                                        _VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_WIDTH, (uint32_t)read->modeWidth)|
-                                        SMIF_DEVICE_RD_CMD_CTL_PRESENT_Msk)
-                                    : 0U;
-
         SMIF_DEVICE_RD_DUMMY_CTL(dev) = (0UL != read->dummyCycles)?
                                         (_VAL2FLD(SMIF_DEVICE_RD_DUMMY_CTL_SIZE5, (read->dummyCycles - 1UL)) |
                                         SMIF_DEVICE_RD_DUMMY_CTL_PRESENT_Msk)
@@ -480,6 +553,44 @@ static void XipRegInit(SMIF_DEVICE_Type volatile *dev, cy_stc_smif_mem_config_t
 }
 
 
+/*******************************************************************************
+* Function Name: XipReadCmdInit
+****************************************************************************//**
+*
+* \internal
+* This function initializes the command and mode registers of the XIP read.
+*
+* \param dev
+* The SMIF memory device registers structure. \ref SMIF_DEVICE_Type
+*
+* \param read
+* The Read command parameters.
+*
+* \param continuousReadMode
+* The mode byte that keeps the memory in the continuous read mode. The XIP read
+* is sent without the command. 0 - the command and mode of the Read command are
+* used.
+*
+*******************************************************************************/
+static void XipReadCmdInit(SMIF_DEVICE_Type volatile *dev, cy_stc_smif_mem_cmd_t const *read,
+                           uint32_t continuousReadMode)
+{
+    uint32_t mode = (0UL != continuousReadMode) ? continuousReadMode : read->mode;
+
+    SMIF_DEVICE_RD_CMD_CTL(dev) = ((0UL == continuousReadMode) && (CY_SMIF_NO_COMMAND_OR_MODE != read->command)) ?
+                                (_VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_CODE,  (uint32_t)read->command)  |
+                                _VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_WIDTH, (uint32_t)read->cmdWidth) |
+                                SMIF_DEVICE_RD_CMD_CTL_PRESENT_Msk)
+                                : 0U;
+
+    SMIF_DEVICE_RD_MODE_CTL(dev) = (CY_SMIF_NO_COMMAND_OR_MODE != mode) ?
+                                (_VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_CODE,  mode)     |
+                                    _VAL2FLD(SMIF_DEVICE_RD_CMD_CTL_WIDTH, (uint32_t)read->modeWidth)|
+                                    SMIF_DEVICE_RD_CMD_CTL_PRESENT_Msk)
+                                : 0U;
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SMIF_MemDeInit
 ****************************************************************************//**
@@ -516,6 +627,202 @@ void Cy_SMIF_MemDeInit(SMIF_Type *base)
 }
 
 
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemEnterContinuousRead
+****************************************************************************//**
+*
+* This function puts the memory into the continuous read (0-4-4) mode and
+* configures the XIP reads of the memory device without the command.
+*
+* The function sends the Read command with the continuousReadMode byte of
+* \ref cy_stc_smif_mem_device_cfg_t. The memory stays in the continuous read
+* mode while the mode byte is sent, so the next reads start with the address.
+* This saves the 8 or 16 command clocks of every XIP access.
+*
+* \note While the memory is in the continuous read mode, it interprets any
+* transfer as the address of the next read. The Cy_SMIF_MemCmd functions (and
+* the functions that use them, for example \ref Cy_SMIF_MemWrite or
+* \ref Cy_SMIF_MemEraseSector) exit this mode before sending their commands.
+* Call \ref Cy_SMIF_MemExitContinuousRead before sending the commands with
+* the low-level functions, for example \ref Cy_SMIF_TransmitCommand.
+*
+* \note The quad mode of the memory must be enabled. The SMIF must be in the
+* normal (MMIO) mode, see \ref Cy_SMIF_SetMode.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param memConfig
+* The SMIF memory device configuration structure. The memory device must be
+* initialized by \ref Cy_SMIF_MemInit.
+*
+* \param context
+* The internal SMIF context data. \ref cy_stc_smif_context_t
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM - the memory does not support the continuous
+*         read mode or the device is not memory-mapped.
+*       - \ref CY_SMIF_EXCEED_TIMEOUT
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemEnterContinuousRead(SMIF_Type *base, cy_stc_smif_mem_config_t const *memConfig,
+                                    cy_stc_smif_context_t const *context)
+{
+    cy_en_smif_status_t result = CY_SMIF_BAD_PARAM;
+    SMIF_DEVICE_Type volatile * device;
+    cy_stc_smif_mem_device_cfg_t const *devCfg;
+    cy_stc_smif_mem_cmd_t enterCmd;
+    cy_en_smif_slave_select_t slaveSelected;
+    uint8_t addr[CY_SMIF_FOUR_BYTES_ADDR] = {0U};
+    uint8_t readByte = 0U;
+
+    CY_ASSERT_L1(NULL != memConfig);
+    devCfg = memConfig->deviceCfg;
+    device = Cy_SMIF_GetDeviceBySlot(base, memConfig->slaveSelect);
+
+    if ((NULL != device) && (NULL != devCfg->readCmd) && (0UL != devCfg->continuousReadMode) &&
+        (CY_SMIF_NO_COMMAND_OR_MODE != devCfg->readCmd->mode) &&
+        (0U != (memConfig->flags & CY_SMIF_FLAG_MEMORY_MAPPED)))
+    {
+        /* The Read command with the mode byte that enters the continuous read mode */
+        enterCmd = *devCfg->readCmd;
+        enterCmd.mode = devCfg->continuousReadMode;
+
+        slaveSelected = (0U == memConfig->dualQuadSlots)?  memConfig->slaveSelect :
+                               (cy_en_smif_slave_select_t)memConfig->dualQuadSlots;
+
+        result = TransmitMemCmd(base, &enterCmd, addr, devCfg->numOfAddrBytes,
+                                slaveSelected, context);
+
+        if (CY_SMIF_SUCCESS == result)
+        {
+            result = Cy_SMIF_ReceiveDataBlocking(base, &readByte, CY_SMIF_READ_ONE_BYTE,
+                                                 enterCmd.dataWidth, context);
+        }
+
+        if (CY_SMIF_SUCCESS == result)
+        {
+            /* The XIP reads keep the memory in the continuous read mode */
+            XipReadCmdInit(device, devCfg->readCmd, devCfg->continuousReadMode);
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemExitContinuousRead
+****************************************************************************//**
+*
+* This function takes the memory out of the continuous read mode entered by
+* \ref Cy_SMIF_MemEnterContinuousRead and restores the command of the XIP reads
+* of the memory device.
+*
+* The function sends Fh on DQ0-DQ3 for 8 clocks (3-byte addressing) or 10 clocks
+* (4-byte addressing). The memory that is not in the continuous read mode
+* ignores this sequence.
+*
+* \note The SMIF must be in the normal (MMIO) mode, see \ref Cy_SMIF_SetMode.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param memConfig
+* The SMIF memory device configuration structure.
+*
+* \param context
+* The internal SMIF context data. \ref cy_stc_smif_context_t
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM
+*       - \ref CY_SMIF_EXCEED_TIMEOUT
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemExitContinuousRead(SMIF_Type *base, cy_stc_smif_mem_config_t const *memConfig,
+                                    cy_stc_smif_context_t const *context)
+{
+    cy_en_smif_status_t result = CY_SMIF_BAD_PARAM;
+    SMIF_DEVICE_Type volatile * device;
+    cy_stc_smif_mem_device_cfg_t const *devCfg;
+    cy_en_smif_slave_select_t slaveSelected;
+    uint8_t exitParam[CY_SMIF_FOUR_BYTES_ADDR] = {CONTINUOUS_READ_EXIT, CONTINUOUS_READ_EXIT,
+                                                  CONTINUOUS_READ_EXIT, CONTINUOUS_READ_EXIT};
+
+    CY_ASSERT_L1(NULL != memConfig);
+    devCfg = memConfig->deviceCfg;
+    device = Cy_SMIF_GetDeviceBySlot(base, memConfig->slaveSelect);
+
+    if ((NULL != device) && (NULL != devCfg->readCmd) && (CY_SMIF_FOUR_BYTES_ADDR >= devCfg->numOfAddrBytes))
+    {
+        slaveSelected = (0U == memConfig->dualQuadSlots)?  memConfig->slaveSelect :
+                               (cy_en_smif_slave_select_t)memConfig->dualQuadSlots;
+
+        /* One clock pair per byte: the Fh byte and one Fh byte for each address byte */
+        result = Cy_SMIF_TransmitCommand(base, CONTINUOUS_READ_EXIT, CY_SMIF_WIDTH_QUAD,
+                    exitParam, devCfg->numOfAddrBytes, CY_SMIF_WIDTH_QUAD,
+                    slaveSelected, CY_SMIF_TX_LAST_BYTE, context);
+
+        if (0U != (memConfig->flags & CY_SMIF_FLAG_MEMORY_MAPPED))
+        {
+            /* The XIP reads send the Read command again */
+            XipReadCmdInit(device, devCfg->readCmd, 0UL);
+        }
+    }
+
+    return (result);
+}
+
+
+/*******************************************************************************
+* Function Name: LeaveContinuousRead
+****************************************************************************//**
+*
+* Takes the memory out of the continuous read mode before another command is
+* sent. The memory is in the continuous read mode when
+* \ref Cy_SMIF_MemEnterContinuousRead configured the XIP reads of the memory
+* device without the command and with the mode byte.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param memConfig
+* The SMIF memory device configuration structure.
+*
+* \param context
+* The internal SMIF context data. \ref cy_stc_smif_context_t
+*
+* \return The status of the operation. \ref CY_SMIF_SUCCESS when the memory is
+* not in the continuous read mode.
+*
+*******************************************************************************/
+static cy_en_smif_status_t LeaveContinuousRead(SMIF_Type *base, cy_stc_smif_mem_config_t const *memConfig,
+                                               cy_stc_smif_context_t const *context)
+{
+    cy_en_smif_status_t result = CY_SMIF_SUCCESS;
+    SMIF_DEVICE_Type volatile * device;
+    cy_stc_smif_mem_device_cfg_t const *devCfg = memConfig->deviceCfg;
+
+    if ((0UL != devCfg->continuousReadMode) && (NULL != devCfg->readCmd) &&
+        (CY_SMIF_NO_COMMAND_OR_MODE != devCfg->readCmd->command) &&
+        (0U != (memConfig->flags & CY_SMIF_FLAG_MEMORY_MAPPED)))
+    {
+        device = Cy_SMIF_GetDeviceBySlot(base, memConfig->slaveSelect);
+
+        if ((NULL != device) &&
+            (0UL == (SMIF_DEVICE_RD_CMD_CTL(device) & SMIF_DEVICE_RD_CMD_CTL_PRESENT_Msk)) &&
+            (0UL != (SMIF_DEVICE_RD_MODE_CTL(device) & SMIF_DEVICE_RD_CMD_CTL_PRESENT_Msk)))
+        {
+            result = Cy_SMIF_MemExitContinuousRead(base, memConfig, context);
+        }
+    }
+
+    return (result);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SMIF_MemCmdWriteEnable
 ****************************************************************************//**
@@ -554,6 +861,11 @@ cy_en_smif_status_t Cy_SMIF_MemCmdWriteEnable(SMIF_Type *base,
     cy_en_smif_status_t result = CY_SMIF_CMD_NOT_FOUND;
     
     if(NULL != writeEn)
+    {
+        result = LeaveContinuousRead(base, memDevice, context);
+    }
+
+    if((NULL != writeEn) && (CY_SMIF_SUCCESS == result))
     {
         result = Cy_SMIF_TransmitCommand( base, (uint8_t) writeEn->command,
                                         writeEn->cmdWidth,
@@ -606,6 +918,11 @@ cy_en_smif_status_t Cy_SMIF_MemCmdWriteDisable(SMIF_Type *base,
     cy_en_smif_status_t result = CY_SMIF_CMD_NOT_FOUND;
     
     if(NULL != writeDis)
+    {
+        result = LeaveContinuousRead(base, memDevice, context);
+    }
+
+    if((NULL != writeDis) && (CY_SMIF_SUCCESS == result))
     {
         /* The memory write disable */
         result = Cy_SMIF_TransmitCommand( base, (uint8_t)writeDis->command,
@@ -821,11 +1138,16 @@ cy_en_smif_status_t Cy_SMIF_MemCmdReadStatus(SMIF_Type *base,
 {
     cy_en_smif_status_t result = CY_SMIF_CMD_NOT_FOUND;
 
+    result = LeaveContinuousRead(base, memDevice, context);
+
     /* Read the memory status register */
-    result = Cy_SMIF_TransmitCommand( base, command, CY_SMIF_WIDTH_SINGLE,
-                CY_SMIF_CMD_WITHOUT_PARAM, CY_SMIF_CMD_WITHOUT_PARAM,
-                CY_SMIF_WIDTH_NA, memDevice->slaveSelect, 
-                CY_SMIF_TX_NOT_LAST_BYTE, context);
+    if (CY_SMIF_SUCCESS == result)
+    {
+        result = Cy_SMIF_TransmitCommand( base, command, CY_SMIF_WIDTH_SINGLE,
+                    CY_SMIF_CMD_WITHOUT_PARAM, CY_SMIF_CMD_WITHOUT_PARAM,
+                    CY_SMIF_WIDTH_NA, memDevice->slaveSelect, 
+                    CY_SMIF_TX_NOT_LAST_BYTE, context);
+    }
 
     if (CY_SMIF_SUCCESS == result)
     {
@@ -937,6 +1259,11 @@ cy_en_smif_status_t Cy_SMIF_MemCmdChipErase(SMIF_Type *base,
 
     cy_stc_smif_mem_cmd_t *cmdErase = memDevice->deviceCfg->chipEraseCmd;
     if(NULL != cmdErase)
+    {
+        result = LeaveContinuousRead(base, memDevice, context);
+    }
+
+    if((NULL != cmdErase) && (CY_SMIF_SUCCESS == result))
     {
         result = Cy_SMIF_TransmitCommand( base, (uint8_t)cmdErase->command,
                 cmdErase->cmdWidth, CY_SMIF_CMD_WITHOUT_PARAM,
@@ -1001,11 +1328,14 @@ cy_en_smif_status_t Cy_SMIF_MemCmdSectorErase(SMIF_Type *base,
 
         if ((NULL != cmdErase) && (CY_SMIF_WIDTH_NA != cmdErase->cmdWidth) && (result != CY_SMIF_BAD_PARAM))
         {
-            uint8_t eraseCommand = (uint8_t)((result == CY_SMIF_SUCCESS) ? (hybrInfo->eraseCmd) : (cmdErase->command));
-            result = Cy_SMIF_TransmitCommand( base, eraseCommand,
-                    cmdErase->cmdWidth, sectorAddr, device->numOfAddrBytes,
-                    cmdErase->cmdWidth, memDevice->slaveSelect,
-                    CY_SMIF_TX_LAST_BYTE, context);
+            uint32_t eraseCommand = (result == CY_SMIF_SUCCESS) ? (hybrInfo->eraseCmd) : (cmdErase->command);
+
+            result = LeaveContinuousRead(base, memDevice, context);
+
+            if (CY_SMIF_SUCCESS == result)
+            {
+                result = TransmitEraseCmd(base, memDevice, eraseCommand, sectorAddr, context);
+            }
         }
         else
         {
@@ -1094,24 +1424,13 @@ cy_en_smif_status_t Cy_SMIF_MemCmdProgram(SMIF_Type *base,
         slaveSelected = (0U == memDevice->dualQuadSlots)?  memDevice->slaveSelect :
                                                         (cy_en_smif_slave_select_t)memDevice->dualQuadSlots;
                                                       
-        /* The page program command */
-        result = Cy_SMIF_TransmitCommand( base, (uint8_t)cmdProg->command,
-                cmdProg->cmdWidth, addr, device->numOfAddrBytes,
-                cmdProg->addrWidth, slaveSelected, CY_SMIF_TX_NOT_LAST_BYTE,
-                context);
-
-        if((CY_SMIF_SUCCESS == result) && (CY_SMIF_NO_COMMAND_OR_MODE != cmdProg->mode))
-        {
-            result = Cy_SMIF_TransmitCommand(base, (uint8_t)cmdProg->mode,
-                        cmdProg->modeWidth, CY_SMIF_CMD_WITHOUT_PARAM,
-                        CY_SMIF_CMD_WITHOUT_PARAM, CY_SMIF_WIDTH_NA,
-                        (cy_en_smif_slave_select_t)slaveSelected,
-                        CY_SMIF_TX_NOT_LAST_BYTE, context);
-        }
+        result = LeaveContinuousRead(base, memDevice, context);
 
-        if((CY_SMIF_SUCCESS == result) && (cmdProg->dummyCycles > 0U))
+        /* The page program command */
+        if(CY_SMIF_SUCCESS == result)
         {
-            result = Cy_SMIF_SendDummyCycles(base, cmdProg->dummyCycles);
+            result = TransmitMemCmd(base, cmdProg, addr, device->numOfAddrBytes,
+                                    slaveSelected, context);
         }
 
         if(CY_SMIF_SUCCESS == result)
@@ -1202,24 +1521,16 @@ cy_en_smif_status_t Cy_SMIF_MemCmdRead(SMIF_Type *base,
     {
         slaveSelected = (0U == memDevice->dualQuadSlots)?  memDevice->slaveSelect :
                                (cy_en_smif_slave_select_t)memDevice->dualQuadSlots;
-                               
-        result = Cy_SMIF_TransmitCommand( base, (uint8_t)cmdRead->command,
-                    cmdRead->cmdWidth, addr, device->numOfAddrBytes,
-                    cmdRead->addrWidth, slaveSelected, CY_SMIF_TX_NOT_LAST_BYTE,
-                    context);
 
-        if((CY_SMIF_SUCCESS == result) && (CY_SMIF_NO_COMMAND_OR_MODE != cmdRead->mode))
-        {
-            result = Cy_SMIF_TransmitCommand(base, (uint8_t)cmdRead->mode,
-                        cmdRead->modeWidth, CY_SMIF_CMD_WITHOUT_PARAM,
-                        CY_SMIF_CMD_WITHOUT_PARAM, CY_SMIF_WIDTH_NA,
-                        (cy_en_smif_slave_select_t)slaveSelected,
-                        CY_SMIF_TX_NOT_LAST_BYTE, context);
-        }
+        /* The MMIO read sends the command, which the memory in the continuous
+         * read mode takes as the address.
+         */
+        result = LeaveContinuousRead(base, memDevice, context);
 
-        if((CY_SMIF_SUCCESS == result) && (0U < cmdRead->dummyCycles))
+        if(CY_SMIF_SUCCESS == result)
         {
-            result = Cy_SMIF_SendDummyCycles(base, cmdRead->dummyCycles);
+            result = TransmitMemCmd(base, cmdRead, addr, device->numOfAddrBytes,
+                                    slaveSelected, context);
         }
 
         if(CY_SMIF_SUCCESS == result)
@@ -1233,6 +1544,110 @@ cy_en_smif_status_t Cy_SMIF_MemCmdRead(SMIF_Type *base,
 }
 
 
+/*******************************************************************************
+* Function Name: TransmitMemCmd
+****************************************************************************//**
+*
+* Transmits the instruction, address, mode and dummy cycles of the memory
+* command that is followed by the data phase. The slave select stays active.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param cmd
+* The memory command.
+*
+* \param addr
+* The address array.
+*
+* \param addrSize
+* The number of the address bytes.
+*
+* \param slaveSelect
+* The slave select of the memory device(s).
+*
+* \param context
+* The SMIF driver context.
+*
+* \return The status of the command transmission.
+*
+*******************************************************************************/
+static cy_en_smif_status_t TransmitMemCmd(SMIF_Type *base, cy_stc_smif_mem_cmd_t const *cmd,
+                                          uint8_t const *addr, uint32_t addrSize,
+                                          cy_en_smif_slave_select_t slaveSelect,
+                                          cy_stc_smif_context_t const *context)
+{
+    cy_en_smif_status_t result;
+
+    result = Cy_SMIF_TransmitCommand(base, (uint8_t)cmd->command,
+                cmd->cmdWidth, addr, addrSize,
+                cmd->addrWidth, slaveSelect, CY_SMIF_TX_NOT_LAST_BYTE,
+                context);
+
+    if((CY_SMIF_SUCCESS == result) && (CY_SMIF_NO_COMMAND_OR_MODE != cmd->mode))
+    {
+        result = Cy_SMIF_TransmitCommand(base, (uint8_t)cmd->mode,
+                    cmd->modeWidth, CY_SMIF_CMD_WITHOUT_PARAM,
+                    CY_SMIF_CMD_WITHOUT_PARAM, CY_SMIF_WIDTH_NA,
+                    slaveSelect, CY_SMIF_TX_NOT_LAST_BYTE, context);
+    }
+
+    if((CY_SMIF_SUCCESS == result) && (0U < cmd->dummyCycles))
+    {
+        result = Cy_SMIF_SendDummyCycles(base, cmd->dummyCycles);
+    }
+
+    return(result);
+}
+
+
+/*******************************************************************************
+* Function Name: TransmitEraseCmd
+****************************************************************************//**
+*
+* Transmits the erase instruction with the address. The instruction and the
+* address use the command width of the Erase command.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param memDevice
+* The device to which the command is sent.
+*
+* \param command
+* The 8-bit erase instruction.
+*
+* \param addr
+* The address array.
+*
+* \param context
+* The SMIF driver context.
+*
+* \return The status of the command transmission.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_EXCEED_TIMEOUT
+*       - \ref CY_SMIF_CMD_NOT_FOUND
+*
+*******************************************************************************/
+static cy_en_smif_status_t TransmitEraseCmd(SMIF_Type *base, cy_stc_smif_mem_config_t const *memDevice,
+                                            uint32_t command, uint8_t const *addr,
+                                            cy_stc_smif_context_t const *context)
+{
+    cy_en_smif_status_t result = CY_SMIF_CMD_NOT_FOUND;
+    cy_stc_smif_mem_cmd_t const *cmdErase = memDevice->deviceCfg->eraseCmd;
+
+    if ((NULL != cmdErase) && (CY_SMIF_WIDTH_NA != cmdErase->cmdWidth))
+    {
+        result = Cy_SMIF_TransmitCommand(base, (uint8_t)command,
+                    cmdErase->cmdWidth, addr, memDevice->deviceCfg->numOfAddrBytes,
+                    cmdErase->cmdWidth, memDevice->slaveSelect,
+                    CY_SMIF_TX_LAST_BYTE, context);
+    }
+
+    return(result);
+}
+
+
 /*******************************************************************************
 * Function Name: Cy_SMIF_MemLocateHybridRegion
 ****************************************************************************//**
@@ -1300,32 +1715,222 @@ cy_en_smif_status_t Cy_SMIF_MemLocateHybridRegion(cy_stc_smif_mem_config_t const
 
 
 /*******************************************************************************
-* Function Name: SfdpReadBuffer
+* Function Name: Cy_SMIF_MemGetEraseStep
 ****************************************************************************//**
 *
-* This function reads the tables in the SDFP database into the buffer.
+* Selects the largest erase that starts at the address and does not exceed the
+* length. The candidates are the Erase command of the device (or the erase of
+* the hybrid region) and the erase types in
+* \ref cy_stc_smif_mem_device_cfg_t::eraseTypes that are supported at the
+* address (see \ref cy_stc_smif_hybrid_region_info_t::eraseTypeMask).
+* An erase type is used only when the address is aligned to its size and the
+* erased block does not cross the end of the hybrid region.
 *
-* \note This function is a blocking function and blocks until the structure data
-* is read and returned. This function uses \ref Cy_SMIF_TransmitCommand()
+* Calling this function for the remaining range after every step gives the
+* minimal number of the erases, because the erase sizes are powers of two.
 *
-* \param *base
-* Holds the base address of the SMIF block registers.
+* \param memConfig
+* The memory device configuration.
 *
-* \param *cmdSfdp
-*  The command structure to store the Read/Write command
-*  configuration.
+* \param address
+* The start address of the range to be erased.
 *
-* \param sfdpAddress
-* The pointer to an array with the address bytes
-* associated with the memory command.
+* \param length
+* The size of the range to be erased.
 *
-* \param slaveSelect
-* Denotes the number of the slave device to which the transfer is made.
-* (0, 1, 2 or 4 - the bit defines which slave to enable). The two-bit enable
-* is possible only for the double quad SPI mode.
+* \param step
+* The selected erase.
 *
-* \param size
-* The size of data to be received. Must be > 0 and not greater than 65536.
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM - the address is not aligned to any supported
+*         erase, or the remaining length is smaller than the smallest erase.
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemGetEraseStep(cy_stc_smif_mem_config_t const *memConfig,
+                                            uint32_t address, uint32_t length,
+                                            cy_stc_smif_mem_erase_step_t *step)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+    cy_stc_smif_hybrid_region_info_t* hybrInfo = NULL;
+    cy_stc_smif_mem_erase_type_t const *eraseType;
+    cy_stc_smif_mem_device_cfg_t *device;
+    uint32_t endAddress = address + length;
+    uint32_t regionStart = 0UL;
+    uint32_t eraseTypeMask = (1UL << CY_SMIF_MEM_ERASE_TYPE_COUNT) - 1UL;
+
+    CY_ASSERT_L1(NULL != memConfig);
+    CY_ASSERT_L1(NULL != step);
+
+    device = memConfig->deviceCfg;
+    step->eraseSize = 0UL;
+
+    if (endAddress > address)
+    {
+        /* The Erase command of the device */
+        step->eraseCmd = (NULL != device->eraseCmd) ? device->eraseCmd->command : CY_SMIF_NO_COMMAND_OR_MODE;
+        step->eraseSize = device->eraseSize;
+        step->eraseTime = device->eraseTime;
+
+        status = Cy_SMIF_MemLocateHybridRegion(memConfig, &hybrInfo, address);
+        if (CY_SMIF_SUCCESS == status)
+        {
+            /* The erase of the hybrid region. The erases must not cross the region end */
+            regionStart = hybrInfo->regionAddress;
+            step->eraseCmd = hybrInfo->eraseCmd;
+            step->eraseSize = hybrInfo->eraseSize;
+            step->eraseTime = hybrInfo->eraseTime;
+            eraseTypeMask = hybrInfo->eraseTypeMask;
+
+            if (endAddress > (regionStart + (hybrInfo->sectorsCount * hybrInfo->eraseSize)))
+            {
+                endAddress = regionStart + (hybrInfo->sectorsCount * hybrInfo->eraseSize);
+            }
+        }
+
+        if ((CY_SMIF_BAD_PARAM == status) || (0UL == step->eraseSize) ||
+            (0UL != ((address - regionStart) % step->eraseSize)) ||
+            ((endAddress - address) < step->eraseSize))
+        {
+            step->eraseSize = 0UL;
+        }
+
+        if ((CY_SMIF_BAD_PARAM != status) && (NULL != device->eraseTypes))
+        {
+            for (uint32_t idx = 0UL; idx < CY_SMIF_MEM_ERASE_TYPE_COUNT; idx++)
+            {
+                eraseType = &device->eraseTypes[idx];
+
+                if ((0UL != (eraseTypeMask & (1UL << idx))) &&
+                    (eraseType->eraseSize > step->eraseSize) &&
+                    (0UL == (address % eraseType->eraseSize)) &&
+                    ((endAddress - address) >= eraseType->eraseSize))
+                {
+                    step->eraseCmd = eraseType->eraseCmd;
+                    step->eraseSize = eraseType->eraseSize;
+                    step->eraseTime = eraseType->eraseTime;
+                }
+            }
+        }
+
+        status = CY_SMIF_BAD_PARAM;
+        if (0UL != step->eraseSize)
+        {
+            step->address = address;
+            status = CY_SMIF_SUCCESS;
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemGetErasePlan
+****************************************************************************//**
+*
+* Builds the list of the erases for the range with
+* \ref Cy_SMIF_MemGetEraseStep. The plan mixes the erase types supported by the
+* memory, so a large range is erased by the large blocks, and the unaligned
+* start and end of the range are erased by the smaller sectors.
+* \ref Cy_SMIF_MemEraseSector and \ref Cy_SMIF_MemAsyncEraseSector follow the
+* same plan.
+*
+* \param memConfig
+* The memory device configuration.
+*
+* \param address
+* The start address of the range to be erased.
+*
+* \param length
+* The size of the range to be erased.
+*
+* \param steps
+* The array for the erases. NULL - the erases are only counted.
+*
+* \param maxSteps
+* The number of the elements in the steps array.
+*
+* \param stepCount
+* The number of the erases in the plan.
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM - the range cannot be erased with the supported
+*         erases, or the steps array is too small.
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemGetErasePlan(cy_stc_smif_mem_config_t const *memConfig,
+                                            uint32_t address, uint32_t length,
+                                            cy_stc_smif_mem_erase_step_t steps[], uint32_t maxSteps,
+                                            uint32_t *stepCount)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+    cy_stc_smif_mem_erase_step_t step;
+    uint32_t currAddress = address;
+    uint32_t remaining = length;
+
+    CY_ASSERT_L1(NULL != stepCount);
+
+    *stepCount = 0UL;
+
+    while (0UL != remaining)
+    {
+        status = Cy_SMIF_MemGetEraseStep(memConfig, currAddress, remaining, &step);
+
+        if ((CY_SMIF_SUCCESS == status) && (NULL != steps))
+        {
+            if (*stepCount < maxSteps)
+            {
+                steps[*stepCount] = step;
+            }
+            else
+            {
+                status = CY_SMIF_BAD_PARAM;
+            }
+        }
+
+        if (CY_SMIF_SUCCESS != status)
+        {
+            break;
+        }
+
+        (*stepCount)++;
+        currAddress += step.eraseSize;
+        remaining -= step.eraseSize;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: SfdpReadBuffer
+****************************************************************************//**
+*
+* This function reads the tables in the SDFP database into the buffer.
+*
+* \note This function is a blocking function and blocks until the structure data
+* is read and returned. This function uses \ref Cy_SMIF_TransmitCommand()
+*
+* \param *base
+* Holds the base address of the SMIF block registers.
+*
+* \param *cmdSfdp
+*  The command structure to store the Read/Write command
+*  configuration.
+*
+* \param sfdpAddress
+* The pointer to an array with the address bytes
+* associated with the memory command.
+*
+* \param slaveSelect
+* Denotes the number of the slave device to which the transfer is made.
+* (0, 1, 2 or 4 - the bit defines which slave to enable). The two-bit enable
+* is possible only for the double quad SPI mode.
+*
+* \param size
+* The size of data to be received. Must be > 0 and not greater than 65536.
 *
 * \param sfdpBuffer
 * The pointer to an array with the SDFP buffer.
@@ -2376,6 +2981,130 @@ static void SfdpSetWipStatusRegisterCommand(cy_stc_smif_mem_cmd_t* readStsRegWip
 }
 
 
+/*******************************************************************************
+* Function Name: SfdpGetContinuousReadMode
+****************************************************************************//**
+*
+* Reads the continuous read (0-4-4) mode parameters from the JEDEC basic flash
+* parameter table. The mode is used only with the quad I/O Read command, when
+* the mode byte enters the mode and the Fh sequence exits it.
+*
+* \param device
+* The device structure instance declared by the user. This is where the detected
+* parameters are stored and returned.
+*
+* \param sfdpBuffer
+* The pointer to an array with the SDFP buffer.
+*
+* \param tableLength
+* The length of the JEDEC basic flash parameter table in bytes.
+*
+*******************************************************************************/
+static void SfdpGetContinuousReadMode(cy_stc_smif_mem_device_cfg_t *device,
+                                      uint8_t const sfdpBuffer[], uint32_t tableLength)
+{
+    cy_stc_smif_mem_cmd_t const *cmdRead = device->readCmd;
+    uint32_t modeParams;
+    uint32_t entryMethod;
+    uint32_t exitMethod;
+
+    device->continuousReadMode = 0UL;
+
+    /* The 15th DWORD is present starting from JESD216B */
+    if ((tableLength > (CY_SMIF_JEDEC_BFPT_15TH_DWORD * BYTES_IN_DWORD)) &&
+        (CY_SMIF_WIDTH_QUAD == cmdRead->addrWidth) &&
+        (CY_SMIF_NO_COMMAND_OR_MODE != cmdRead->mode))
+    {
+        modeParams = ((uint32_t*)sfdpBuffer)[CY_SMIF_JEDEC_BFPT_15TH_DWORD];
+        entryMethod = _FLD2VAL(CY_SMIF_SFDP_0_4_4_ENTRY, modeParams);
+        exitMethod = _FLD2VAL(CY_SMIF_SFDP_0_4_4_EXIT, modeParams);
+
+        if ((0UL != (modeParams & CY_SMIF_SFDP_0_4_4_SUPPORTED_Msk)) &&
+            (0UL != (exitMethod & (CY_SMIF_SFDP_0_4_4_EXIT_FH_ADDR_CLOCKS | CY_SMIF_SFDP_0_4_4_EXIT_FH_8_CLOCKS))))
+        {
+            if (0UL != (entryMethod & CY_SMIF_SFDP_0_4_4_ENTRY_MODE_AX))
+            {
+                device->continuousReadMode = CONTINUOUS_READ_MODE_AX;
+            }
+            else if (0UL != (entryMethod & CY_SMIF_SFDP_0_4_4_ENTRY_MODE_A5))
+            {
+                device->continuousReadMode = CONTINUOUS_READ_MODE_A5;
+            }
+            else
+            {
+                /* The entry methods with the configuration register writes are not supported */
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: SfdpGetEraseSuspendParameters
+****************************************************************************//**
+*
+* Gets the Erase Suspend and Resume instructions and the maximum erase suspend
+* latency from the 12th and 13th DWORDs of the JEDEC basic flash parameter
+* table.
+*
+* \param device
+* The device structure instance declared by the user. This is where the detected
+* parameters are stored and returned.
+*
+* \param sfdpBuffer
+* The pointer to an array with the SDFP buffer.
+*
+* \param tableLength
+* The length of the JEDEC basic flash parameter table in bytes.
+*
+*******************************************************************************/
+static void SfdpGetEraseSuspendParameters(cy_stc_smif_mem_device_cfg_t *device,
+                                          uint8_t const sfdpBuffer[], uint32_t tableLength)
+{
+    uint32_t suspendParams;
+    uint32_t suspendCmds;
+    uint32_t suspendUnits;
+    uint32_t suspendUs;
+
+    device->eraseSuspendCmd = 0UL;
+    device->eraseResumeCmd = 0UL;
+    device->eraseSuspendTime = 0UL;
+    device->eraseResumeTime = 0UL;
+
+    /* The 12th and 13th DWORDs are present starting from JESD216A */
+    if (tableLength > (CY_SMIF_JEDEC_BFPT_13TH_DWORD * BYTES_IN_DWORD))
+    {
+        suspendParams = ((uint32_t*)sfdpBuffer)[CY_SMIF_JEDEC_BFPT_12TH_DWORD];
+        suspendCmds = ((uint32_t*)sfdpBuffer)[CY_SMIF_JEDEC_BFPT_13TH_DWORD];
+
+        if (0UL == (suspendParams & CY_SMIF_SFDP_SUSPEND_NOT_SUPPORTED_Msk))
+        {
+            suspendUnits = _FLD2VAL(CY_SMIF_SFDP_ERASE_SUSPEND_UNITS, suspendParams);
+
+            switch (suspendUnits)
+            {
+                case CY_SMIF_SFDP_UNIT_0:
+                case CY_SMIF_SFDP_UNIT_1:
+                    suspendUs = CY_SMIF_SFDP_SUSPEND_TIME_1US;
+                    break;
+                case CY_SMIF_SFDP_UNIT_2:
+                    suspendUs = CY_SMIF_SFDP_SUSPEND_TIME_8US;
+                    break;
+                default:
+                    suspendUs = CY_SMIF_SFDP_SUSPEND_TIME_64US;
+                    break;
+            }
+
+            device->eraseSuspendCmd = _FLD2VAL(CY_SMIF_SFDP_ERASE_SUSPEND_CMD, suspendCmds);
+            device->eraseResumeCmd = _FLD2VAL(CY_SMIF_SFDP_ERASE_RESUME_CMD, suspendCmds);
+            device->eraseSuspendTime = (_FLD2VAL(CY_SMIF_SFDP_ERASE_SUSPEND_COUNT, suspendParams) + 1UL) * suspendUs;
+            device->eraseResumeTime = (_FLD2VAL(CY_SMIF_SFDP_ERASE_RESUME_COUNT, suspendParams) + 1UL) *
+                                      CY_SMIF_SFDP_RESUME_INTERVAL_64US;
+        }
+    }
+}
+
+
 /*******************************************************************************
 * Function Name: SfdpGetQuadEnableParameters
 ****************************************************************************//**
@@ -2746,6 +3475,46 @@ static void SfdpGetEraseSizeAndCmd(uint8_t const sfdpBuffer[],
 }
 
 
+/*******************************************************************************
+* Function Name: SfdpSetEraseTypes
+****************************************************************************//**
+*
+* Copies the supported erase types into the device structure for
+* \ref Cy_SMIF_MemGetEraseStep. An erase type is not supported when its size
+* in the JEDEC basic flash parameter table is zero.
+*
+* \param device
+* The device structure instance declared by the user.
+*
+* \param sfdpBuffer
+* The pointer to an array with the SDFP buffer.
+*
+* \param eraseType
+* The erase types with the commands for the current addressing mode and the
+* erase times.
+*
+*******************************************************************************/
+static void SfdpSetEraseTypes(cy_stc_smif_mem_device_cfg_t *device, uint8_t const sfdpBuffer[],
+                              cy_stc_smif_erase_type_t const eraseType[])
+{
+    if (NULL != device->eraseTypes)
+    {
+        for (uint32_t currET = 0UL; currET < ERASE_TYPE_COUNT; currET++)
+        {
+            device->eraseTypes[currET].eraseCmd = (uint32_t)eraseType[currET].eraseCmd;
+            device->eraseTypes[currET].eraseTime = eraseType[currET].eraseTime;
+            device->eraseTypes[currET].eraseSize = 0UL;
+
+            if ((0U != sfdpBuffer[CY_SMIF_SFDP_BFPT_BYTE_1C + (currET * TYPE_STEP)]) &&
+                (INSTRUCTION_NOT_SUPPORTED != eraseType[currET].eraseCmd))
+            {
+                device->eraseTypes[currET].eraseSize = eraseType[currET].eraseSize;
+            }
+        }
+    }
+}
+
+
 /*******************************************************************************
 * Function Name: SfdpPopulateRegionInfo
 ****************************************************************************//**
@@ -2916,6 +3685,7 @@ static cy_en_smif_status_t SfdpPopulateRegionInfo(SMIF_Type *base,
                 currRegionPtr->regionAddress = currRegionAddr;
                 currRegionPtr->eraseCmd = (uint32_t)eraseType[supportedEraseType].eraseCmd;
                 currRegionPtr->eraseTime = eraseType[supportedEraseType].eraseTime;
+                currRegionPtr->eraseTypeMask = (uint32_t)eraseTypeCode;
                 if(regionSize < eraseType[supportedEraseType].eraseSize)
                 {
                     /* One region with a single sector */
@@ -3119,9 +3889,15 @@ cy_en_smif_status_t Cy_SMIF_MemSfdpDetect(SMIF_Type *base,
                 /* Page Program Time */
                 device->programTime = SfdpGetPageProgramTime(sfdpBuffer);
 
+                /* The Erase Suspend and Resume commands */
+                SfdpGetEraseSuspendParameters(device, sfdpBuffer, basicSpiTableLength);
+
                 /* The Read command for 3-byte addressing. The preference order quad > dual > single SPI */
                 cy_stc_smif_mem_cmd_t *cmdRead = device->readCmd;
                 cy_en_smif_protocol_mode_t pMode = SfdpGetReadCmdParams(sfdpBuffer, dataSelect, cmdRead);
+
+                /* The mode byte of the continuous read (0-4-4) mode */
+                SfdpGetContinuousReadMode(device, sfdpBuffer, basicSpiTableLength);
                 
                 /* Read, Erase, and Program commands */
                 uint32_t eraseTypeOffset = 1UL;
@@ -3164,6 +3940,9 @@ cy_en_smif_status_t Cy_SMIF_MemSfdpDetect(SMIF_Type *base,
 
                     /* Erase Time Type (from the JEDEC basic flash parameter table) */
                     device->eraseTime = SfdpGetEraseTime(eraseTypeOffset, sfdpBuffer, eraseType);
+
+                    /* All erase types for the erase planning */
+                    SfdpSetEraseTypes(device, sfdpBuffer, eraseType);
                 }
 
                 if (NULL != device->hybridRegionInfo)
@@ -3698,6 +4477,11 @@ cy_en_smif_status_t Cy_SMIF_MemWrite(SMIF_Type *base, cy_stc_smif_mem_config_t c
 * \note Memories like hybrid have sectors of different sizes. \n
 * Check the adress and length parameters before calling this function.
 *
+* \note When \ref cy_stc_smif_mem_device_cfg_t::eraseTypes is set, the range
+* is erased with the largest erase types that fit it
+* (see \ref Cy_SMIF_MemGetErasePlan), for example, 64 KB blocks in the middle
+* and 4 KB sectors at the unaligned start and end.
+*
 * \funcusage 
 * \snippet smif/snippet/main.c snippet_Cy_SMIF_MemEraseSector
 *
@@ -3706,101 +4490,44 @@ cy_en_smif_status_t Cy_SMIF_MemEraseSector(SMIF_Type *base, cy_stc_smif_mem_conf
                                            uint32_t address, uint32_t length,
                                            cy_stc_smif_context_t const *context)
 {
-    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
-    uint32_t endAddress = address + length;
-    uint32_t eraseEnd = 0UL;
-    uint32_t hybridRegionStart = 0UL;
+    cy_en_smif_status_t status;
+    uint32_t stepCount = 0UL;
     uint8_t addrArray[CY_SMIF_FOUR_BYTES_ADDR] = {0U};
-    cy_stc_smif_hybrid_region_info_t* hybrInfo = NULL;
+    cy_stc_smif_mem_erase_step_t step;
     CY_ASSERT_L1(NULL != memConfig);
     cy_stc_smif_mem_device_cfg_t *device = memConfig->deviceCfg;
-    uint32_t eraseSectorSize = device->eraseSize;
-    uint32_t maxEraseTime = device->eraseTime;
-
-    /* In case of hybrid memory - update sector size and offset for first sector */
-    status = Cy_SMIF_MemLocateHybridRegion(memConfig, &hybrInfo, address);
-    if (CY_SMIF_SUCCESS == status)
-    {
-        hybridRegionStart = hybrInfo->regionAddress;
-        eraseSectorSize = hybrInfo->eraseSize;
-        eraseEnd = (hybrInfo->sectorsCount * eraseSectorSize) + hybridRegionStart;
-    }
 
-    /* Check if the end address not equal to start address */
-    if(length == 0UL)
-    {
-        status = CY_SMIF_BAD_PARAM;
-    }
+    /* Check that the whole range can be erased before the first erase */
+    status = Cy_SMIF_MemGetErasePlan(memConfig, address, length, NULL, 0UL, &stepCount);
 
-    /* Check if the start address and the sector size are aligned */
-    if((0UL == ((address - hybridRegionStart) % eraseSectorSize)) && (status != CY_SMIF_BAD_PARAM))
+    while ((CY_SMIF_SUCCESS == status) && (length > 0UL))
     {
-        /* If the memory is hybrid and there is more than one region to
-         * erase - update the sector size and offset for the last sector */
-        if(endAddress < eraseEnd)
+        /* Select the largest erase for the rest of the range */
+        status = Cy_SMIF_MemGetEraseStep(memConfig, address, length, &step);
+        if(CY_SMIF_SUCCESS == status)
         {
-            status = Cy_SMIF_MemLocateHybridRegion(memConfig, &hybrInfo, (endAddress - 1UL));
-            if (CY_SMIF_SUCCESS == status)
-            {
-                hybridRegionStart = hybrInfo->regionAddress;
-                eraseSectorSize = hybrInfo->eraseSize;
-            }
+            /* The Write Enable bit may be cleared by the memory after every successful
+            * operation of write/erase operations. Therefore, it must be set for
+            * every loop.
+            */
+            status = Cy_SMIF_MemCmdWriteEnable(base, memConfig, context);
         }
 
-        /* Check if the end address and the sector size are aligned */
-        if((0UL == ((endAddress - hybridRegionStart) % eraseSectorSize))  && (status != CY_SMIF_BAD_PARAM))
+        if(CY_SMIF_SUCCESS == status)
         {
-            while(length > 0UL)
-            {
-                /* In case of hybrid memory - update erase size and time for current region */
-                status = Cy_SMIF_MemLocateHybridRegion(memConfig, &hybrInfo, address);
-                if (CY_SMIF_SUCCESS == status)
-                {
-                    maxEraseTime =  hybrInfo->eraseTime;
-                    eraseSectorSize = hybrInfo->eraseSize;
-                    hybridRegionStart = hybrInfo->regionAddress;
-                    eraseEnd = (hybrInfo->sectorsCount * eraseSectorSize) + hybridRegionStart;
-                    if(endAddress < eraseEnd)
-                    {
-                        eraseEnd = endAddress;
-                    }
-                }
-                else
-                {
-                    eraseEnd = endAddress;
-                }
-
-                while (address < eraseEnd)
-                {
-                    /* The Write Enable bit may be cleared by the memory after every successful
-                    * operation of write/erase operations. Therefore, it must be set for
-                    * every loop.
-                    */
-                    status = Cy_SMIF_MemCmdWriteEnable(base, memConfig, context);
-                    if(CY_SMIF_SUCCESS == status)
-                    {
-                        ValueToByteArray(address, &addrArray[0], 0UL, device->numOfAddrBytes);
+            ValueToByteArray(address, &addrArray[0], 0UL, device->numOfAddrBytes);
 
-                        /* Send the command to erase one sector */
-                        status = Cy_SMIF_MemCmdSectorErase(base, (cy_stc_smif_mem_config_t* )memConfig,
-                                                           (const uint8_t *)addrArray, context);
-                        if(CY_SMIF_SUCCESS == status)
-                        {
-                            /* Wait until the erase operation is completed or a timeout occurs.
-                             * Note: eraseTime is in milliseconds */
-                            status = Cy_SMIF_MemIsReady(base, memConfig, (maxEraseTime * ONE_MILLI_IN_MICRO), context);
-
-                            /* Recalculate the next sector address offset */
-                            address += eraseSectorSize;
-                            length -= eraseSectorSize;
-                        }
-                    }
+            /* Send the command to erase one sector or block */
+            status = TransmitEraseCmd(base, memConfig, step.eraseCmd, (const uint8_t *)addrArray, context);
+            if(CY_SMIF_SUCCESS == status)
+            {
+                /* Wait until the erase operation is completed or a timeout occurs.
+                 * Note: eraseTime is in milliseconds */
+                status = Cy_SMIF_MemIsReady(base, memConfig, (step.eraseTime * ONE_MILLI_IN_MICRO), context);
 
-                    if(CY_SMIF_SUCCESS != status)
-                    {
-                        break;
-                    }
-                }
+                /* Recalculate the next sector address offset */
+                address += step.eraseSize;
+                length -= step.eraseSize;
             }
         }
     }
@@ -3864,6 +4591,968 @@ cy_en_smif_status_t Cy_SMIF_MemEraseChip(SMIF_Type *base, cy_stc_smif_mem_config
     return status;
 }
 
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemAsyncInit
+****************************************************************************//**
+*
+* Initializes the context of the asynchronous memory operations.
+*
+* The asynchronous functions split a long operation into page programs, sector
+* erases and read chunks. The data transfers are done by the SMIF interrupt
+* (or by the DMA, see \ref Cy_SMIF_MemAsyncSetDma), and the memory status is
+* polled by \ref Cy_SMIF_MemAsyncProcess, which must be called periodically
+* (for example, from a timer interrupt or the main loop) while
+* \ref Cy_SMIF_MemAsyncIsBusy returns true. The completion callback is
+* called from \ref Cy_SMIF_MemAsyncProcess.
+*
+* A read can be requested while a write or erase is in progress. The read
+* runs between the page programs or sector erases. When the memory supports
+* the erase suspend (see \ref cy_stc_smif_mem_device_cfg_t::eraseSuspendCmd),
+* the sector erase in progress is suspended for the read and resumed after it.
+*
+* \note The SMIF interrupt must be enabled and must call \ref Cy_SMIF_Interrupt.
+* Only one context can be used at a time. Do not use other SMIF and memory
+* slot API while an asynchronous operation is in progress.
+*
+* \param async
+* The context of the asynchronous operations allocated by the user.
+*
+* \param base
+* Holds the base address of the SMIF block registers.
+*
+* \param memConfig
+* The memory device configuration.
+*
+* \param pollPeriodUs
+* The period of the \ref Cy_SMIF_MemAsyncProcess calls in microseconds. It is
+* used to convert the program, erase and suspend times of the memory into the
+* number of the status polls before the timeout.
+*
+* \param callback
+* The completion callback. Can be NULL.
+*
+* \param context
+* This is the pointer to the context structure \ref cy_stc_smif_context_t
+* allocated by the user. The structure is used during the SMIF
+* operation for internal configuration and data retention. The user must not
+* modify anything in this structure.
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemAsyncInit(cy_stc_smif_mem_async_t *async, SMIF_Type *base,
+                                         cy_stc_smif_mem_config_t const *memConfig,
+                                         uint32_t pollPeriodUs, cy_smif_mem_async_cb_t callback,
+                                         cy_stc_smif_context_t *context)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+
+    CY_ASSERT_L1(NULL != async);
+    CY_ASSERT_L1(NULL != memConfig);
+    CY_ASSERT_L1(NULL != context);
+
+    if ((NULL != async) && (NULL != memConfig) && (NULL != context) && (0UL != pollPeriodUs))
+    {
+        async->base = base;
+        async->memConfig = memConfig;
+        async->context = context;
+        async->callback = callback;
+        async->pollPeriodUs = pollPeriodUs;
+        async->operation = CY_SMIF_MEM_ASYNC_WRITE;
+        async->state = ASYNC_IDLE;
+        async->pollCount = 0UL;
+        async->erasePolls = 0UL;
+        async->resumePolls = 0UL;
+        async->stepPolls = 0UL;
+        async->length = 0UL;
+        async->readState = ASYNC_READ_IDLE;
+        async->readLength = 0UL;
+#if defined(CY_IP_M4CPUSS_DMA)
+        async->dma = NULL;
+#endif /* CY_IP_M4CPUSS_DMA */
+
+        memAsync = async;
+
+        status = CY_SMIF_SUCCESS;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemAsyncRead
+****************************************************************************//**
+*
+* Starts reading data from the external memory. The read starts immediately
+* when no write or erase is in progress. Otherwise, it starts between the page
+* programs or sector erases, or when the sector erase is suspended.
+* The completion is reported by the callback with \ref CY_SMIF_MEM_ASYNC_READ.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param address
+* The address to read data from.
+*
+* \param rxBuffer
+* The buffer for storing the read data. It must be kept until the read is
+* completed.
+*
+* \param length
+* The size of data to read.
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM
+*       - \ref CY_SMIF_BUSY - another read is in progress.
+*       - \ref CY_SMIF_EXCEED_TIMEOUT
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemAsyncRead(cy_stc_smif_mem_async_t *async, uint32_t address,
+                                         uint8_t rxBuffer[], uint32_t length)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != async);
+    CY_ASSERT_L1(NULL != rxBuffer);
+
+    if ((0UL != length) && ((address + length) <= async->memConfig->deviceCfg->memSize))
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+
+        if (ASYNC_READ_IDLE != async->readState)
+        {
+            status = CY_SMIF_BUSY;
+        }
+        else
+        {
+            async->readAddress = address;
+            async->readLength = length;
+            async->rxBuffer = rxBuffer;
+            async->readState = ASYNC_READ_PENDING;
+            status = CY_SMIF_SUCCESS;
+
+            if (ASYNC_IDLE == async->state)
+            {
+                status = AsyncReadStep(async);
+            }
+        }
+
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemAsyncWrite
+****************************************************************************//**
+*
+* Starts writing data to the external memory. The data is programmed page by
+* page. The completion is reported by the callback with
+* \ref CY_SMIF_MEM_ASYNC_WRITE.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param address
+* The address to write data at.
+*
+* \param txBuffer
+* The buffer holding the data to write in the external memory. It must be kept
+* until the write is completed.
+*
+* \param length
+* The size of data to write.
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM
+*       - \ref CY_SMIF_BUSY - another operation is in progress.
+*       - \ref CY_SMIF_EXCEED_TIMEOUT
+*       - \ref CY_SMIF_CMD_NOT_FOUND
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemAsyncWrite(cy_stc_smif_mem_async_t *async, uint32_t address,
+                                          uint8_t const txBuffer[], uint32_t length)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != async);
+    CY_ASSERT_L1(NULL != txBuffer);
+
+    if ((0UL != length) && ((address + length) <= async->memConfig->deviceCfg->memSize))
+    {
+        interruptState = Cy_SysLib_EnterCriticalSection();
+
+        if ((ASYNC_IDLE != async->state) || (ASYNC_READ_IDLE != async->readState))
+        {
+            status = CY_SMIF_BUSY;
+        }
+        else
+        {
+            async->operation = CY_SMIF_MEM_ASYNC_WRITE;
+            async->address = address;
+            async->length = length;
+            async->txBuffer = txBuffer;
+
+            status = AsyncStep(async);
+        }
+
+        Cy_SysLib_ExitCriticalSection(interruptState);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemAsyncEraseSector
+****************************************************************************//**
+*
+* Starts erasing the sectors of the external memory. The sectors and blocks
+* are erased one by one in the order of \ref Cy_SMIF_MemGetErasePlan. The
+* completion is reported by the callback with \ref CY_SMIF_MEM_ASYNC_ERASE.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param address
+* The address of the first sector to be erased. The address should be aligned
+* with the start address of the sector.
+*
+* \param length
+* The size of data to erase. The length should be equal to the sum of all
+* sectors length to be erased.
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BAD_PARAM
+*       - \ref CY_SMIF_BUSY - another operation is in progress.
+*       - \ref CY_SMIF_EXCEED_TIMEOUT
+*       - \ref CY_SMIF_CMD_NOT_FOUND
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemAsyncEraseSector(cy_stc_smif_mem_async_t *async,
+                                                uint32_t address, uint32_t length)
+{
+    cy_en_smif_status_t status = CY_SMIF_BAD_PARAM;
+    uint32_t stepCount = 0UL;
+    uint32_t interruptState;
+
+    CY_ASSERT_L1(NULL != async);
+
+    if ((0UL != length) && ((address + length) <= async->memConfig->deviceCfg->memSize))
+    {
+        /* Check that the range can be erased with the supported erases */
+        if (CY_SMIF_SUCCESS == Cy_SMIF_MemGetErasePlan(async->memConfig, address, length, NULL, 0UL, &stepCount))
+        {
+            interruptState = Cy_SysLib_EnterCriticalSection();
+
+            if ((ASYNC_IDLE != async->state) || (ASYNC_READ_IDLE != async->readState))
+            {
+                status = CY_SMIF_BUSY;
+            }
+            else
+            {
+                async->operation = CY_SMIF_MEM_ASYNC_ERASE;
+                async->address = address;
+                async->length = length;
+
+                status = AsyncStep(async);
+            }
+
+            Cy_SysLib_ExitCriticalSection(interruptState);
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemAsyncProcess
+****************************************************************************//**
+*
+* Advances the asynchronous operations. Polls the memory status while a page
+* program or sector erase is in progress, starts the next page or sector,
+* suspends and resumes the erase for a pending read, and calls the completion
+* callback.
+*
+* Call this function every pollPeriodUs (see \ref Cy_SMIF_MemAsyncInit) from
+* one context while \ref Cy_SMIF_MemAsyncIsBusy returns true.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+*******************************************************************************/
+void Cy_SMIF_MemAsyncProcess(cy_stc_smif_mem_async_t *async)
+{
+    cy_en_smif_status_t status;
+    cy_en_smif_status_t readStatus = CY_SMIF_SUCCESS;
+    cy_stc_smif_mem_device_cfg_t *device;
+
+    CY_ASSERT_L1(NULL != async);
+
+    device = async->memConfig->deviceCfg;
+
+    /* Continue or complete the read */
+    if (ASYNC_READ_ERROR == async->readState)
+    {
+        async->readState = ASYNC_READ_IDLE;
+        async->readLength = 0UL;
+        readStatus = CY_SMIF_DMA_ERROR;
+    }
+    else if (ASYNC_READ_DONE == async->readState)
+    {
+        if (0UL != async->readLength)
+        {
+            readStatus = AsyncReadStep(async);
+        }
+        else
+        {
+            async->readState = ASYNC_READ_IDLE;
+
+            if (NULL != async->callback)
+            {
+                async->callback(CY_SMIF_MEM_ASYNC_READ, CY_SMIF_SUCCESS);
+            }
+        }
+    }
+
+    switch (async->state)
+    {
+        case ASYNC_PROGRAM_WAIT:
+        case ASYNC_ERASE_WAIT:
+            if (!Cy_SMIF_MemIsBusy(async->base, async->memConfig, async->context))
+            {
+                if (0UL == async->length)
+                {
+                    AsyncComplete(async, CY_SMIF_SUCCESS);
+                }
+                else if (ASYNC_READ_PENDING == async->readState)
+                {
+                    /* Run the read between the pages or sectors */
+                    async->state = ASYNC_PAUSED;
+                    readStatus = AsyncReadStep(async);
+                }
+                else
+                {
+                    status = AsyncStep(async);
+                    if (CY_SMIF_SUCCESS != status)
+                    {
+                        AsyncComplete(async, status);
+                    }
+                }
+            }
+            else if ((ASYNC_ERASE_WAIT == async->state) &&
+                     (ASYNC_READ_PENDING == async->readState) &&
+                     (0UL != device->eraseSuspendCmd) &&
+                     (0UL == async->resumePolls))
+            {
+                /* Suspend the erase to run the read. The remaining erase
+                 * polls are kept for the erase resume.
+                 */
+                status = AsyncSendCommand(async, device->eraseSuspendCmd);
+                if (CY_SMIF_SUCCESS == status)
+                {
+                    async->state = ASYNC_SUSPEND_WAIT;
+                    async->erasePolls = async->pollCount;
+                    async->pollCount = (device->eraseSuspendTime / async->pollPeriodUs) + 1UL;
+                }
+                else
+                {
+                    AsyncComplete(async, status);
+                }
+            }
+            else
+            {
+                /* The erase must progress for the resume to suspend interval
+                 * before it is suspended again.
+                 */
+                if (0UL != async->resumePolls)
+                {
+                    async->resumePolls--;
+                }
+
+                AsyncPollTimeout(async);
+            }
+            break;
+
+        case ASYNC_SUSPEND_WAIT:
+            if (!Cy_SMIF_MemIsBusy(async->base, async->memConfig, async->context))
+            {
+                async->state = ASYNC_SUSPENDED;
+                readStatus = AsyncReadStep(async);
+            }
+            else
+            {
+                AsyncPollTimeout(async);
+            }
+            break;
+
+        case ASYNC_SUSPENDED:
+            /* The read is completed, resume the erase. A read requested from
+             * the read callback is started by the next erase suspend.
+             */
+            if ((ASYNC_READ_IDLE == async->readState) || (ASYNC_READ_PENDING == async->readState))
+            {
+                status = AsyncSendCommand(async, device->eraseResumeCmd);
+                if (CY_SMIF_SUCCESS == status)
+                {
+                    async->state = ASYNC_ERASE_WAIT;
+                    async->pollCount = async->erasePolls;
+                    async->resumePolls = (device->eraseResumeTime / async->pollPeriodUs) + 1UL;
+                }
+                else
+                {
+                    AsyncComplete(async, status);
+                }
+            }
+            break;
+
+        case ASYNC_PAUSED:
+            /* The read is completed, start the next page or sector. A read
+             * requested from the read callback is started after it.
+             */
+            if ((ASYNC_READ_IDLE == async->readState) || (ASYNC_READ_PENDING == async->readState))
+            {
+                status = AsyncStep(async);
+                if (CY_SMIF_SUCCESS != status)
+                {
+                    AsyncComplete(async, status);
+                }
+            }
+            break;
+
+        case ASYNC_ERROR:
+            AsyncComplete(async, CY_SMIF_DMA_ERROR);
+            break;
+
+        default:
+            /* ASYNC_IDLE or ASYNC_PROGRAM: the page data is transmitted by the SMIF interrupt */
+            if ((ASYNC_IDLE == async->state) && (ASYNC_READ_PENDING == async->readState))
+            {
+                readStatus = AsyncReadStep(async);
+            }
+            break;
+    }
+
+    /* Report the read which failed */
+    if ((CY_SMIF_SUCCESS != readStatus) && (NULL != async->callback))
+    {
+        async->callback(CY_SMIF_MEM_ASYNC_READ, readStatus);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemAsyncIsBusy
+****************************************************************************//**
+*
+* Checks whether an asynchronous operation is in progress.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \return
+*       - True - A read, write or erase is in progress.
+*       - False - No operation is in progress.
+*
+*******************************************************************************/
+bool Cy_SMIF_MemAsyncIsBusy(cy_stc_smif_mem_async_t const *async)
+{
+    CY_ASSERT_L1(NULL != async);
+
+    return ((ASYNC_IDLE != async->state) || (ASYNC_READ_IDLE != async->readState));
+}
+
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: Cy_SMIF_MemAsyncSetDma
+****************************************************************************//**
+*
+* Makes the asynchronous read and write use the DMA instead of the SMIF
+* interrupt for the data transfers, which frees the CPU during the large
+* reads and writes.
+*
+* Every page program is transferred by the DMA in one memory command. The
+* DMA moves full words when the page data is word-aligned, otherwise single
+* bytes. Every read chunk is split into up to three memory commands: the head
+* bytes up to the word boundary of the buffer and the tail bytes are
+* transferred by the SMIF interrupt, and the word-aligned middle part is
+* transferred by the DMA in full words. Use word-aligned buffers and lengths
+* to transfer all data by the DMA in full words.
+*
+* \note The DMA must be initialized with \ref Cy_SMIF_DmaInit, and the
+* interrupts of both DW channels must call \ref Cy_SMIF_DmaInterrupt with the
+* context passed to \ref Cy_SMIF_MemAsyncInit. A DMA error completes the
+* operation with \ref CY_SMIF_DMA_ERROR, after which the SMIF block must be
+* re-initialized.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param dma
+* The DMA configuration. NULL disables the DMA transfers.
+*
+* \return The status of the operation.
+*       - \ref CY_SMIF_SUCCESS
+*       - \ref CY_SMIF_BUSY - an operation is in progress.
+*
+*******************************************************************************/
+cy_en_smif_status_t Cy_SMIF_MemAsyncSetDma(cy_stc_smif_mem_async_t *async, cy_stc_smif_dma_t *dma)
+{
+    cy_en_smif_status_t status = CY_SMIF_BUSY;
+
+    CY_ASSERT_L1(NULL != async);
+
+    if (!Cy_SMIF_MemAsyncIsBusy(async))
+    {
+        async->dma = dma;
+        status = CY_SMIF_SUCCESS;
+    }
+
+    return status;
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
+/*******************************************************************************
+* Function Name: AsyncStep
+****************************************************************************//**
+*
+* Starts programming the next page or erasing the next sector.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \return The status of the operation. See \ref cy_en_smif_status_t.
+*
+*******************************************************************************/
+static cy_en_smif_status_t AsyncStep(cy_stc_smif_mem_async_t *async)
+{
+    cy_en_smif_status_t status;
+    cy_stc_smif_mem_device_cfg_t *device = async->memConfig->deviceCfg;
+    cy_stc_smif_mem_erase_step_t eraseStep = {0UL, 0UL, 0UL, 0UL};
+    uint8_t addrArray[CY_SMIF_FOUR_BYTES_ADDR] = {0U};
+    uint8_t const *txBuffer = async->txBuffer;
+    uint32_t chunk;
+    uint32_t stepTimeUs;
+#if defined(CY_IP_M4CPUSS_DMA)
+    bool useDma = false;
+#endif /* CY_IP_M4CPUSS_DMA */
+
+    /* Select the largest erase for the rest of the range */
+    status = (CY_SMIF_MEM_ASYNC_ERASE == async->operation) ?
+             Cy_SMIF_MemGetEraseStep(async->memConfig, async->address, async->length, &eraseStep) :
+             CY_SMIF_SUCCESS;
+
+    if (CY_SMIF_SUCCESS == status)
+    {
+        /* The Write Enable bit is cleared by the memory after every page program
+         * or sector erase. Therefore, it must be set for every step.
+         */
+        status = Cy_SMIF_MemCmdWriteEnable(async->base, async->memConfig, async->context);
+    }
+
+    if (CY_SMIF_SUCCESS == status)
+    {
+        ValueToByteArray(async->address, &addrArray[0], 0UL, device->numOfAddrBytes);
+
+        if (CY_SMIF_MEM_ASYNC_WRITE == async->operation)
+        {
+            chunk = device->programSize - (async->address % device->programSize);
+            chunk = (chunk < async->length) ? chunk : async->length;
+            stepTimeUs = device->programTime;
+#if defined(CY_IP_M4CPUSS_DMA)
+            /* The page is not split, an unaligned one is moved by bytes */
+            useDma = (NULL != async->dma);
+#endif /* CY_IP_M4CPUSS_DMA */
+        }
+        else
+        {
+            chunk = eraseStep.eraseSize;
+            stepTimeUs = eraseStep.eraseTime * ONE_MILLI_IN_MICRO;
+        }
+
+        /* Update the context before the step is started, as the SMIF interrupt
+         * and Cy_SMIF_MemAsyncProcess() may preempt this function.
+         */
+        async->stepPolls = (stepTimeUs / async->pollPeriodUs) + 1UL;
+        async->pollCount = async->stepPolls;
+        async->resumePolls = 0UL;
+        async->address += chunk;
+        async->length -= chunk;
+
+        if (CY_SMIF_MEM_ASYNC_WRITE == async->operation)
+        {
+            async->txBuffer = &txBuffer[chunk];
+
+            /* The state is changed to ASYNC_PROGRAM_WAIT by AsyncTxComplete() */
+            async->state = ASYNC_PROGRAM;
+#if defined(CY_IP_M4CPUSS_DMA)
+            if (useDma)
+            {
+                status = AsyncDmaProgram(async, (const uint8_t *)addrArray, txBuffer, chunk);
+            }
+            else
+#endif /* CY_IP_M4CPUSS_DMA */
+            {
+                status = Cy_SMIF_MemCmdProgram(async->base, async->memConfig, (const uint8_t *)addrArray,
+                                               txBuffer, chunk, &AsyncTxComplete, async->context);
+            }
+        }
+        else
+        {
+            async->state = ASYNC_ERASE_WAIT;
+            status = TransmitEraseCmd(async->base, async->memConfig, eraseStep.eraseCmd,
+                                      (const uint8_t *)addrArray, async->context);
+        }
+    }
+
+    if (CY_SMIF_SUCCESS != status)
+    {
+        async->state = ASYNC_IDLE;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: AsyncReadStep
+****************************************************************************//**
+*
+* Starts reading the next chunk of data. SMIF can read only up to 65536 bytes
+* in one go.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \return The status of the operation. See \ref cy_en_smif_status_t.
+*
+*******************************************************************************/
+static cy_en_smif_status_t AsyncReadStep(cy_stc_smif_mem_async_t *async)
+{
+    cy_en_smif_status_t status;
+    uint8_t addrArray[CY_SMIF_FOUR_BYTES_ADDR] = {0U};
+    uint8_t *rxBuffer = async->rxBuffer;
+    uint32_t chunk = (async->readLength > SMIF_MAX_RX_COUNT) ? (SMIF_MAX_RX_COUNT) : async->readLength;
+#if defined(CY_IP_M4CPUSS_DMA)
+    bool useDma = AsyncDmaChunk(async, (uint32_t)rxBuffer, &chunk);
+#endif /* CY_IP_M4CPUSS_DMA */
+
+    ValueToByteArray(async->readAddress, &addrArray[0], 0UL,
+                     async->memConfig->deviceCfg->numOfAddrBytes);
+
+    async->readAddress += chunk;
+    async->readLength -= chunk;
+    async->rxBuffer = &rxBuffer[chunk];
+
+    /* The state is changed to ASYNC_READ_DONE by AsyncRxComplete() */
+    async->readState = ASYNC_READ_BUSY;
+#if defined(CY_IP_M4CPUSS_DMA)
+    if (useDma)
+    {
+        status = AsyncDmaRead(async, (const uint8_t *)addrArray, rxBuffer, chunk);
+    }
+    else
+#endif /* CY_IP_M4CPUSS_DMA */
+    {
+        status = Cy_SMIF_MemCmdRead(async->base, async->memConfig, (const uint8_t *)addrArray,
+                                    rxBuffer, chunk, &AsyncRxComplete, async->context);
+    }
+
+    if (CY_SMIF_SUCCESS != status)
+    {
+        async->readState = ASYNC_READ_IDLE;
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: AsyncSendCommand
+****************************************************************************//**
+*
+* Sends the Erase Suspend or Erase Resume instruction to the memory.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param command
+* The 8-bit instruction.
+*
+* \return The status of the command transmission.
+*
+*******************************************************************************/
+static cy_en_smif_status_t AsyncSendCommand(cy_stc_smif_mem_async_t const *async, uint32_t command)
+{
+    cy_en_smif_status_t status = LeaveContinuousRead(async->base, async->memConfig, async->context);
+
+    if (CY_SMIF_SUCCESS == status)
+    {
+        /* The suspend and resume instructions use the width of the Write Enable command */
+        status = Cy_SMIF_TransmitCommand(async->base, (uint8_t)command,
+                                         async->memConfig->deviceCfg->writeEnCmd->cmdWidth,
+                                         CY_SMIF_CMD_WITHOUT_PARAM,
+                                         CY_SMIF_CMD_WITHOUT_PARAM,
+                                         CY_SMIF_WIDTH_NA,
+                                         async->memConfig->slaveSelect,
+                                         CY_SMIF_TX_LAST_BYTE,
+                                         async->context);
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: AsyncComplete
+****************************************************************************//**
+*
+* Completes the write or erase operation and calls the completion callback.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param status
+* The status of the operation.
+*
+*******************************************************************************/
+static void AsyncComplete(cy_stc_smif_mem_async_t *async, cy_en_smif_status_t status)
+{
+    async->state = ASYNC_IDLE;
+    async->length = 0UL;
+
+    if (NULL != async->callback)
+    {
+        async->callback(async->operation, status);
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: AsyncPollTimeout
+****************************************************************************//**
+*
+* Counts the status polls and completes the operation with
+* \ref CY_SMIF_EXCEED_TIMEOUT when the memory stays busy longer than the
+* program, erase or suspend time.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+*******************************************************************************/
+static void AsyncPollTimeout(cy_stc_smif_mem_async_t *async)
+{
+    if (0UL != async->pollCount)
+    {
+        async->pollCount--;
+    }
+    else
+    {
+        AsyncComplete(async, CY_SMIF_EXCEED_TIMEOUT);
+    }
+}
+
+
+#if defined(CY_IP_M4CPUSS_DMA)
+/*******************************************************************************
+* Function Name: AsyncDmaChunk
+****************************************************************************//**
+*
+* Limits the read chunk to the part of the buffer that can be transferred in
+* one go: the head bytes up to the word boundary, the word-aligned part for
+* the DMA, or the tail bytes.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param bufferAddress
+* The address of the buffer for the chunk.
+*
+* \param chunk
+* The size of the chunk. Updated to the size which can be transferred.
+*
+* \return True if the chunk is transferred by the DMA.
+*
+*******************************************************************************/
+static bool AsyncDmaChunk(cy_stc_smif_mem_async_t const *async, uint32_t bufferAddress, uint32_t *chunk)
+{
+    bool useDma = false;
+    uint32_t misalignment = bufferAddress % BYTES_IN_DWORD;
+
+    if (NULL != async->dma)
+    {
+        if (0UL != misalignment)
+        {
+            /* The head bytes are transferred by the SMIF interrupt */
+            misalignment = BYTES_IN_DWORD - misalignment;
+            *chunk = (*chunk < misalignment) ? *chunk : misalignment;
+        }
+        else if (*chunk >= BYTES_IN_DWORD)
+        {
+            /* The tail bytes are left for the next chunk */
+            *chunk -= *chunk % BYTES_IN_DWORD;
+            useDma = true;
+        }
+        else
+        {
+            /* The tail bytes are transferred by the SMIF interrupt */
+        }
+    }
+
+    return useDma;
+}
+
+
+/*******************************************************************************
+* Function Name: AsyncDmaRead
+****************************************************************************//**
+*
+* Sends the read command and starts receiving the word-aligned chunk by the
+* DMA.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param addr
+* The address array.
+*
+* \param rxBuffer
+* The word-aligned buffer for the chunk.
+*
+* \param size
+* The size of the chunk, a multiple of four.
+*
+* \return The status of the operation. See \ref cy_en_smif_status_t.
+*
+*******************************************************************************/
+static cy_en_smif_status_t AsyncDmaRead(cy_stc_smif_mem_async_t const *async, uint8_t const *addr,
+                                        uint8_t *rxBuffer, uint32_t size)
+{
+    cy_en_smif_status_t status = CY_SMIF_CMD_NOT_FOUND;
+    cy_stc_smif_mem_config_t const *memConfig = async->memConfig;
+    cy_stc_smif_mem_cmd_t const *cmdRead = memConfig->deviceCfg->readCmd;
+    cy_en_smif_slave_select_t slaveSelected = (0U == memConfig->dualQuadSlots) ? memConfig->slaveSelect :
+                                              (cy_en_smif_slave_select_t)memConfig->dualQuadSlots;
+
+    if (NULL != cmdRead)
+    {
+        status = LeaveContinuousRead(async->base, memConfig, async->context);
+
+        if (CY_SMIF_SUCCESS == status)
+        {
+            status = TransmitMemCmd(async->base, cmdRead, addr, memConfig->deviceCfg->numOfAddrBytes,
+                                    slaveSelected, async->context);
+        }
+
+        if (CY_SMIF_SUCCESS == status)
+        {
+            status = Cy_SMIF_ReceiveDataDma(async->base, rxBuffer, size, cmdRead->dataWidth,
+                                            &AsyncRxComplete, async->dma, async->context);
+        }
+    }
+
+    return status;
+}
+
+
+/*******************************************************************************
+* Function Name: AsyncDmaProgram
+****************************************************************************//**
+*
+* Sends the program command and starts transmitting the page data by the
+* DMA.
+*
+* \param async
+* The context of the asynchronous operations.
+*
+* \param addr
+* The address array.
+*
+* \param txBuffer
+* The page data.
+*
+* \param size
+* The size of the page data.
+*
+* \return The status of the operation. See \ref cy_en_smif_status_t.
+*
+*******************************************************************************/
+static cy_en_smif_status_t AsyncDmaProgram(cy_stc_smif_mem_async_t const *async, uint8_t const *addr,
+                                           uint8_t const *txBuffer, uint32_t size)
+{
+    cy_en_smif_status_t status = CY_SMIF_CMD_NOT_FOUND;
+    cy_stc_smif_mem_config_t const *memConfig = async->memConfig;
+    cy_stc_smif_mem_cmd_t const *cmdProg = memConfig->deviceCfg->programCmd;
+    cy_en_smif_slave_select_t slaveSelected = (0U == memConfig->dualQuadSlots) ? memConfig->slaveSelect :
+                                              (cy_en_smif_slave_select_t)memConfig->dualQuadSlots;
+
+    if (NULL != cmdProg)
+    {
+        status = TransmitMemCmd(async->base, cmdProg, addr, memConfig->deviceCfg->numOfAddrBytes,
+                                slaveSelected, async->context);
+
+        if (CY_SMIF_SUCCESS == status)
+        {
+            status = Cy_SMIF_TransmitDataDma(async->base, txBuffer, size, cmdProg->dataWidth,
+                                             &AsyncTxComplete, async->dma, async->context);
+        }
+    }
+
+    return status;
+}
+#endif /* CY_IP_M4CPUSS_DMA */
+
+
+/*******************************************************************************
+* Function Name: AsyncTxComplete
+****************************************************************************//**
+*
+* The SMIF or DMA callback called when the page data is transmitted.
+*
+* \param event
+* The event which caused a callback call.
+*
+*******************************************************************************/
+static void AsyncTxComplete(uint32_t event)
+{
+    if (ASYNC_PROGRAM == memAsync->state)
+    {
+        memAsync->state = ((uint32_t)CY_SMIF_TX_ERROR == event) ? ASYNC_ERROR : ASYNC_PROGRAM_WAIT;
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: AsyncRxComplete
+****************************************************************************//**
+*
+* The SMIF or DMA callback called when the read chunk is received. The next chunk is
+* started by \ref Cy_SMIF_MemAsyncProcess, because the SMIF context is updated
+* after this callback returns.
+*
+* \param event
+* The event which caused a callback call.
+*
+*******************************************************************************/
+static void AsyncRxComplete(uint32_t event)
+{
+    memAsync->readState = ((uint32_t)CY_SMIF_RX_ERROR == event) ? ASYNC_READ_ERROR : ASYNC_READ_DONE;
+}
+
 #if defined(__cplusplus)
 }
 #endif